@@ -30,6 +30,7 @@ enum class BufferType
     Constant,       //!< Constant buffer type (also called "Uniform Buffer Object").
     Storage,        //!< Storage buffer type (also called "Shader Storage Buffer Object" or "Read/Write Buffer").
     StreamOutput,   //!< Stream output buffer type (also called "Transform Feedback Buffer").
+    Indirect,       //!< Indirect argument buffer type (also called "Draw Indirect Buffer"). \see DrawIndirectArguments.
 };
 
 /**
@@ -85,6 +86,45 @@ struct BufferFlags
     };
 };
 
+/**
+\brief Buffer range mapping flags enumeration.
+\see RenderSystem::MapBufferRange
+*/
+struct BufferMapFlags
+{
+    enum
+    {
+        //! CPU read access. This must not be combined with WriteDiscard or NoOverwrite.
+        Read            = (1 << 0),
+
+        //! CPU write access.
+        Write           = (1 << 1),
+
+        /**
+        \brief CPU write access, whereas the previous content of the mapped range is discarded.
+        \remarks The renderer can provide new storage for the mapped range, while the GPU still reads the previous content,
+        so no synchronization is required. If the range covers the entire buffer, the entire buffer storage is discarded.
+        With Direct3D 11, the entire buffer is always discarded (if it has been created with BufferFlags::DynamicUsage),
+        so the content outside of the mapped range must be considered undefined as well.
+        */
+        WriteDiscard    = (1 << 2),
+
+        /**
+        \brief CPU write access without any synchronization with the GPU.
+        \remarks The client programmer must ensure that the GPU no longer reads from the mapped range,
+        e.g. by only writing into ranges that have not been used since the last WriteDiscard mapping.
+        */
+        NoOverwrite     = (1 << 3),
+
+        /**
+        \brief Modifications of the mapped range are only visible to the GPU after they have been flushed with RenderSystem::FlushMappedRange.
+        \remarks This must be combined with a write access flag.
+        This allows to map a large range once, but only to transfer the sub-ranges that have actually been written.
+        */
+        ExplicitFlush   = (1 << 4),
+    };
+};
+
 
 /* ----- Structures ----- */
 
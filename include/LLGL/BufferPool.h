@@ -0,0 +1,187 @@
+/*
+ * BufferPool.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_BUFFER_POOL_H__
+#define __LLGL_BUFFER_POOL_H__
+
+
+#include "Export.h"
+#include "Buffer.h"
+#include <map>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+
+
+/* ----- Structures ----- */
+
+//! Buffer pool descriptor structure.
+struct BufferPoolDescriptor
+{
+    //! Vertex format of all meshes within the buffer pool.
+    VertexFormat    vertexFormat;
+
+    //! Index format of all meshes within the buffer pool.
+    IndexFormat     indexFormat;
+
+    //! Capacity (in number of vertices) of the shared vertex buffer. This must be greater than 0. By default 0.
+    unsigned int    numVertices = 0;
+
+    /**
+    \brief Capacity (in number of indices) of the shared index buffer. By default 0.
+    \remarks If this is 0, no index buffer is created and only non-indexed meshes can be allocated.
+    */
+    unsigned int    numIndices  = 0;
+
+    /**
+    \brief Specifies the buffer creation flags for the vertex and index buffer. By default 0.
+    \see BufferDescriptor::flags
+    */
+    long            flags       = 0;
+};
+
+//! Range of a single mesh within a buffer pool.
+struct BufferPoolRange
+{
+    //! Index of the first vertex within the shared vertex buffer. This is the base vertex for indexed draw calls.
+    unsigned int firstVertex    = 0;
+
+    //! Number of vertices of this range.
+    unsigned int numVertices    = 0;
+
+    //! Index of the first index within the shared index buffer.
+    unsigned int firstIndex     = 0;
+
+    //! Number of indices of this range.
+    unsigned int numIndices     = 0;
+};
+
+
+/* ----- Classes ----- */
+
+/**
+\brief Buffer pool which sub-allocates the vertex and index ranges of many meshes from a single vertex and index buffer.
+\remarks All meshes of a buffer pool share the same vertex format, so the vertex and index buffer only need to be set once
+for all these meshes. With the OpenGL render system, this also avoids a vertex-array-object (VAO) switch for each draw call.
+The indices of each mesh remain relative to its own vertices, because the base vertex is passed as vertex offset to the draw call.
+Here is an example of how to use a buffer pool:
+\code
+LLGL::BufferPoolDescriptor bufferPoolDesc;
+bufferPoolDesc.vertexFormat = vertexFormat;
+bufferPoolDesc.indexFormat  = LLGL::DataType::UInt16;
+bufferPoolDesc.numVertices  = 1000000;
+bufferPoolDesc.numIndices   = 3000000;
+
+LLGL::BufferPool bufferPool(*renderer, bufferPoolDesc);
+
+for (auto& mesh : meshes)
+    mesh.range = bufferPool.Alloc(mesh.numVertices, mesh.vertices, mesh.numIndices, mesh.indices);
+
+// Per frame:
+commands->SetVertexBuffer(bufferPool.GetVertexBuffer());
+commands->SetIndexBuffer(*bufferPool.GetIndexBuffer());
+
+for (const auto& mesh : meshes)
+    commands->DrawIndexed(mesh.range.numIndices, mesh.range.firstIndex, static_cast<int>(mesh.range.firstVertex));
+\endcode
+\note The buffer pool must be destroyed before the render system it was created with.
+*/
+class LLGL_EXPORT BufferPool
+{
+
+    public:
+
+        /**
+        \brief Creates the shared vertex buffer and (optional) the shared index buffer with the specified render system.
+        \throw std::invalid_argument If 'desc.numVertices' is 0, if the vertex format has a stride of 0,
+        or if the size of the vertex or index buffer exceeds the range of BufferDescriptor::size.
+        */
+        BufferPool(RenderSystem& renderSystem, const BufferPoolDescriptor& desc);
+
+        //! Releases the shared vertex and index buffer.
+        ~BufferPool();
+
+        BufferPool(const BufferPool&) = delete;
+        BufferPool& operator = (const BufferPool&) = delete;
+
+        /**
+        \brief Allocates a vertex range and index range and writes the specified data into them.
+        \param[in] numVertices Specifies the number of vertices. This must be greater than 0.
+        \param[in] vertexData Optional raw pointer to the vertex data. This must contain 'numVertices' vertices of the vertex format of this pool.
+        If this is null, the vertex range is only allocated.
+        \param[in] numIndices Specifies the number of indices. This must be 0, if the buffer pool has no index buffer. By default 0.
+        \param[in] indexData Optional raw pointer to the index data. If this is null, the index range is only allocated. By default null.
+        \return Allocated range, which must be released with "Free" when it is no longer used.
+        \throw std::invalid_argument If 'numVertices' is 0, or if 'numIndices' is greater than 0 but the buffer pool has no index buffer.
+        \throw std::out_of_range If there is no free contiguous vertex or index range which is large enough.
+        */
+        BufferPoolRange Alloc(unsigned int numVertices, const void* vertexData, unsigned int numIndices = 0, const void* indexData = nullptr);
+
+        /**
+        \brief Releases the specified range, so it can be re-used by subsequent allocations.
+        \remarks The range must have been returned by this buffer pool and must no longer be used by any pending draw call.
+        */
+        void Free(const BufferPoolRange& range);
+
+        //! Returns the shared vertex buffer.
+        inline Buffer& GetVertexBuffer() const
+        {
+            return *vertexBuffer_;
+        }
+
+        //! Returns the shared index buffer, or null if the buffer pool has no index buffer.
+        inline Buffer* GetIndexBuffer() const
+        {
+            return indexBuffer_;
+        }
+
+        //! Returns the number of vertices which are currently not allocated.
+        inline unsigned int GetNumFreeVertices() const
+        {
+            return numFreeVertices_;
+        }
+
+        //! Returns the number of indices which are currently not allocated.
+        inline unsigned int GetNumFreeIndices() const
+        {
+            return numFreeIndices_;
+        }
+
+    private:
+
+        // Map of free ranges (first element, number of elements) in the order of the first element.
+        using FreeRangeMap = std::map<unsigned int, unsigned int>;
+
+        RenderSystem&   renderSystem_;
+
+        unsigned int    vertexStride_       = 0;
+        unsigned int    indexStride_        = 0;
+
+        Buffer*         vertexBuffer_       = nullptr;
+        Buffer*         indexBuffer_        = nullptr;
+
+        FreeRangeMap    freeVertexRanges_;
+        FreeRangeMap    freeIndexRanges_;
+
+        unsigned int    numFreeVertices_    = 0;
+        unsigned int    numFreeIndices_     = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
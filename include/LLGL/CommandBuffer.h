@@ -12,6 +12,7 @@
 #include "Export.h"
 #include "RenderContextFlags.h"
 #include "RenderSystemFlags.h"
+#include "CommandBufferFlags.h"
 #include "ColorRGBA.h"
 
 #include "Buffer.h"
@@ -171,6 +172,21 @@ class LLGL_EXPORT CommandBuffer
         */
         virtual void SetConstantBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) = 0;
 
+        /**
+        \brief Sets a range of the specified constant buffer as active constant buffer at the specified slot index.
+        \param[in] buffer Specifies the constant buffer to set. This buffer must have been created with the buffer type: BufferType::Constant.
+        \param[in] slot Specifies the slot index where to put the constant buffer.
+        \param[in] offset Specifies the offset (in bytes) of the buffer range. This must be a multiple of RenderingCaps::constantBufferOffsetAlignment.
+        \param[in] size Specifies the size (in bytes) of the buffer range. This must be greater than 0.
+        Some render systems round this size up to a multiple of RenderingCaps::constantBufferOffsetAlignment.
+        \param[in] shaderStageFlags Specifies at which shader stages the constant buffer is to be set. By default all shader stages are affected.
+        \remarks This is primarily used to bind the data written into a streaming buffer.
+        \throws std::runtime_error If the render system does not support constant buffer ranges.
+        \see RenderSystem::WriteStreamingBuffer
+        \see SetConstantBuffer
+        */
+        virtual void SetConstantBufferRange(Buffer& buffer, unsigned int slot, std::size_t offset, std::size_t size, long shaderStageFlags = ShaderStageFlags::AllStages) = 0;
+
         /**
         \brief Sets the active storage buffer of the specified slot index for subsequent drawing and compute operations.
         \param[in] buffer Specifies the storage buffer to set. This buffer must have been created with the buffer type: BufferType::Storage.
@@ -219,6 +235,17 @@ class LLGL_EXPORT CommandBuffer
         */
         virtual void EndStreamOutput() = 0;
 
+        /**
+        \brief Copies a range of the source buffer into the destination buffer on the GPU.
+        \param[in] dstBuffer Specifies the destination buffer.
+        \param[in] dstOffset Specifies the offset (in bytes) at which the destination range begins.
+        \param[in] srcBuffer Specifies the source buffer.
+        \param[in] srcOffset Specifies the offset (in bytes) at which the source range begins.
+        \param[in] size Specifies the size (in bytes) of the range which is to be copied.
+        \remarks The buffer data is never transferred to the CPU. If source and destination are the same buffer, the ranges must not overlap.
+        */
+        virtual void CopyBuffer(Buffer& dstBuffer, std::size_t dstOffset, Buffer& srcBuffer, std::size_t srcOffset, std::size_t size) = 0;
+
         /* ----- Textures ----- */
 
         /**
@@ -234,6 +261,33 @@ class LLGL_EXPORT CommandBuffer
         */
         virtual void SetTextureArray(TextureArray& textureArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) = 0;
 
+        /**
+        \brief Copies all MIP-map levels and array layers of the source texture into the destination texture on the GPU.
+        \param[in] dstTexture Specifies the destination texture.
+        \param[in] srcTexture Specifies the source texture.
+        This must have the same type, format, size, and number of MIP-map levels as the destination texture.
+        \see CopyTextureRegion
+        */
+        virtual void CopyTexture(Texture& dstTexture, Texture& srcTexture) = 0;
+
+        /**
+        \brief Copies a region of the source texture into the destination texture on the GPU.
+        \param[in] dstTexture Specifies the destination texture.
+        \param[in] dstLocation Specifies the MIP-map level, first array layer, and texel offset of the destination region.
+        \param[in] srcTexture Specifies the source texture.
+        \param[in] srcLocation Specifies the MIP-map level, first array layer, and texel offset of the source region.
+        \param[in] extent Specifies the size of the region (width, height, and depth). The depth is only used for 3D textures.
+        \param[in] numLayers Specifies the number of array layers (or cube faces) to copy. By default 1.
+        \remarks Source and destination texture must have compatible formats (i.e. the same texel size).
+        For compressed formats, the offset and extent must be multiples of the 4x4 block size.
+        \see TextureLocation
+        */
+        virtual void CopyTextureRegion(
+            Texture& dstTexture, const TextureLocation& dstLocation,
+            Texture& srcTexture, const TextureLocation& srcLocation,
+            const Gs::Vector3ui& extent, unsigned int numLayers = 1
+        ) = 0;
+
         /* ----- Samplers ----- */
 
         /**
@@ -392,6 +446,68 @@ class LLGL_EXPORT CommandBuffer
         */
         virtual void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset) = 0;
 
+        /**
+        \brief Draws several batches of primitives from the currently set vertex buffer with a single command.
+        \param[in] argsArray Pointer to the array of draw arguments. This must not be null if 'numDraws' is greater than zero.
+        \param[in] numDraws Specifies the number of draw commands, i.e. the number of elements in the array 'argsArray'.
+        \remarks This is equivalent to calling "Draw" for each element in the array,
+        but it is intended for many sub-meshes which share the same pipeline state and buffers.
+        \see Draw
+        */
+        virtual void MultiDraw(const DrawArguments* argsArray, unsigned int numDraws) = 0;
+
+        /**
+        \brief Draws several batches of primitives from the currently set vertex- and index buffers with a single command.
+        \param[in] argsArray Pointer to the array of indexed draw arguments. This must not be null if 'numDraws' is greater than zero.
+        \param[in] numDraws Specifies the number of draw commands, i.e. the number of elements in the array 'argsArray'.
+        \remarks This is equivalent to calling "DrawIndexed" for each element in the array,
+        but it is intended for many sub-meshes which share the same pipeline state and buffers.
+        \see DrawIndexed(unsigned int, unsigned int, int)
+        */
+        virtual void MultiDrawIndexed(const DrawIndexedArguments* argsArray, unsigned int numDraws) = 0;
+
+        /**
+        \brief Draws primitives from the currently set vertex buffer with the arguments taken from the specified indirect buffer.
+        \param[in] buffer Specifies the buffer which holds the arguments. This buffer must have been created with the buffer type: BufferType::Indirect.
+        \param[in] offset Specifies the offset (in bytes) of the DrawIndirectArguments structure within the buffer. This must be a multiple of 4.
+        \see DrawIndirectArguments
+        \see RenderingCaps::hasIndirectDrawing
+        */
+        virtual void DrawIndirect(Buffer& buffer, std::size_t offset) = 0;
+
+        /**
+        \brief Draws primitives from the currently set vertex- and index buffers with the arguments taken from the specified indirect buffer.
+        \param[in] buffer Specifies the buffer which holds the arguments. This buffer must have been created with the buffer type: BufferType::Indirect.
+        \param[in] offset Specifies the offset (in bytes) of the DrawIndexedIndirectArguments structure within the buffer. This must be a multiple of 4.
+        \see DrawIndexedIndirectArguments
+        \see RenderingCaps::hasIndirectDrawing
+        */
+        virtual void DrawIndexedIndirect(Buffer& buffer, std::size_t offset) = 0;
+
+        /**
+        \brief Draws several batches of primitives from the currently set vertex buffer with the arguments taken from the specified indirect buffer.
+        \param[in] buffer Specifies the buffer which holds the arguments. This buffer must have been created with the buffer type: BufferType::Indirect.
+        \param[in] offset Specifies the offset (in bytes) of the first DrawIndirectArguments structure within the buffer. This must be a multiple of 4.
+        \param[in] numCommands Specifies the number of draw commands.
+        \param[in] stride Specifies the distance (in bytes) between two consecutive argument structures.
+        If this is zero, the argument structures are tightly packed, i.e. the stride is sizeof(DrawIndirectArguments). Otherwise, it must be a multiple of 4.
+        \remarks If the render system does not support multi-draw-indirect natively, the commands are submitted one by one.
+        \see DrawIndirect
+        */
+        virtual void MultiDrawIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride = 0) = 0;
+
+        /**
+        \brief Draws several batches of primitives from the currently set vertex- and index buffers with the arguments taken from the specified indirect buffer.
+        \param[in] buffer Specifies the buffer which holds the arguments. This buffer must have been created with the buffer type: BufferType::Indirect.
+        \param[in] offset Specifies the offset (in bytes) of the first DrawIndexedIndirectArguments structure within the buffer. This must be a multiple of 4.
+        \param[in] numCommands Specifies the number of draw commands.
+        \param[in] stride Specifies the distance (in bytes) between two consecutive argument structures.
+        If this is zero, the argument structures are tightly packed, i.e. the stride is sizeof(DrawIndexedIndirectArguments). Otherwise, it must be a multiple of 4.
+        \remarks If the render system does not support multi-draw-indirect natively, the commands are submitted one by one.
+        \see DrawIndexedIndirect
+        */
+        virtual void MultiDrawIndexedIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride = 0) = 0;
+
         /* ----- Compute ----- */
 
         /**
@@ -404,6 +520,15 @@ class LLGL_EXPORT CommandBuffer
         */
         virtual void Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ) = 0;
 
+        /**
+        \brief Dispatches a compute command with the number of thread groups taken from the specified indirect buffer.
+        \param[in] buffer Specifies the buffer which holds the arguments. This buffer must have been created with the buffer type: BufferType::Indirect.
+        \param[in] offset Specifies the offset (in bytes) of the DispatchIndirectArguments structure within the buffer. This must be a multiple of 4.
+        \see DispatchIndirectArguments
+        \see Dispatch
+        */
+        virtual void DispatchIndirect(Buffer& buffer, std::size_t offset) = 0;
+
         /* ----- Misc ----- */
 
         //! Synchronizes the GPU, i.e. waits until the GPU has completed all pending commands.
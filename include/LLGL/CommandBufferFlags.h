@@ -0,0 +1,87 @@
+/*
+ * CommandBufferFlags.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_COMMAND_BUFFER_FLAGS_H__
+#define __LLGL_COMMAND_BUFFER_FLAGS_H__
+
+
+namespace LLGL
+{
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Arguments structure for a single draw command of a multi-draw call.
+\see CommandBuffer::MultiDraw
+*/
+struct DrawArguments
+{
+    unsigned int    numVertices = 0; //!< Number of vertices to generate.
+    unsigned int    firstVertex = 0; //!< Zero-based offset of the first vertex from the vertex buffer.
+};
+
+/**
+\brief Arguments structure for a single indexed draw command of a multi-draw call.
+\see CommandBuffer::MultiDrawIndexed
+*/
+struct DrawIndexedArguments
+{
+    unsigned int    numIndices      = 0; //!< Number of indices to generate.
+    unsigned int    firstIndex      = 0; //!< Zero-based offset of the first index from the index buffer.
+    int             vertexOffset    = 0; //!< Base vertex offset (positive or negative) which is added to each index from the index buffer.
+};
+
+/**
+\brief Arguments structure for an indirect draw command, as it is stored in an indirect buffer.
+\remarks The memory layout of this structure is equal to "DrawArraysIndirectCommand" in OpenGL and "D3D11_DRAW_INSTANCED_INDIRECT_ARGS" in Direct3D.
+\see CommandBuffer::DrawIndirect
+\see CommandBuffer::MultiDrawIndirect
+*/
+struct DrawIndirectArguments
+{
+    unsigned int    numVertices     = 0; //!< Number of vertices to generate.
+    unsigned int    numInstances    = 0; //!< Number of instances to generate.
+    unsigned int    firstVertex     = 0; //!< Zero-based offset of the first vertex from the vertex buffer.
+    unsigned int    firstInstance   = 0; //!< Zero-based instance offset which is added to each instance ID.
+};
+
+/**
+\brief Arguments structure for an indirect indexed draw command, as it is stored in an indirect buffer.
+\remarks The memory layout of this structure is equal to "DrawElementsIndirectCommand" in OpenGL and "D3D11_DRAW_INDEXED_INSTANCED_INDIRECT_ARGS" in Direct3D.
+\see CommandBuffer::DrawIndexedIndirect
+\see CommandBuffer::MultiDrawIndexedIndirect
+*/
+struct DrawIndexedIndirectArguments
+{
+    unsigned int    numIndices      = 0; //!< Number of indices to generate.
+    unsigned int    numInstances    = 0; //!< Number of instances to generate.
+    unsigned int    firstIndex      = 0; //!< Zero-based offset of the first index from the index buffer.
+    int             vertexOffset    = 0; //!< Base vertex offset (positive or negative) which is added to each index from the index buffer.
+    unsigned int    firstInstance   = 0; //!< Zero-based instance offset which is added to each instance ID.
+};
+
+/**
+\brief Arguments structure for an indirect compute command, as it is stored in an indirect buffer.
+\see CommandBuffer::DispatchIndirect
+*/
+struct DispatchIndirectArguments
+{
+    unsigned int    numGroupsX = 0; //!< Number of thread groups in the X-dimension.
+    unsigned int    numGroupsY = 0; //!< Number of thread groups in the Y-dimension.
+    unsigned int    numGroupsZ = 0; //!< Number of thread groups in the Z-dimension.
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,232 @@
+/*
+ * DeferredCommandBuffer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_DEFERRED_COMMAND_BUFFER_H__
+#define __LLGL_DEFERRED_COMMAND_BUFFER_H__
+
+
+#include "Export.h"
+#include "CommandBuffer.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Deferred command buffer which records commands into a binary command stream instead of submitting them to the GPU.
+\remarks The commands are encoded into memory chunks, which are allocated by the command buffer itself (arena allocation),
+i.e. recording neither accesses the render system nor the graphics API. Hence, several deferred command buffers can be recorded
+in parallel on worker threads, even for the OpenGL render system, as long as each command buffer is only used by one thread at a time.
+The recorded commands are then replayed in order with "Execute" on the thread which owns the command buffer of the render system.
+Here is an example of how to use deferred command buffers:
+\code
+std::vector<LLGL::DeferredCommandBuffer> deferredCommands(numThreads);
+
+// On each worker thread:
+deferredCommands[threadIndex].Reset();
+deferredCommands[threadIndex].SetGraphicsPipeline(*pipeline);
+for (const auto& mesh : visibleMeshes[threadIndex])
+    deferredCommands[threadIndex].DrawIndexed(mesh.numIndices, mesh.firstIndex, mesh.vertexOffset);
+
+// On the render thread (after all worker threads have finished):
+for (const auto& deferred : deferredCommands)
+    deferred.Execute(*commands);
+\endcode
+\note All objects which are passed to a deferred command buffer (buffers, textures, pipelines etc.) must not be released
+before the recorded commands have been executed. Array arguments (e.g. viewports or multi-draw arguments) are copied into the command stream.
+\see Execute
+*/
+class LLGL_EXPORT DeferredCommandBuffer : public CommandBuffer
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        /**
+        \brief Initializes the deferred command buffer without allocating any memory.
+        \param[in] chunkSize Specifies the size (in bytes) of each memory chunk of the command stream. By default 16384.
+        Commands which are larger than this size (e.g. with large multi-draw arrays) are stored in a chunk of their own.
+        \throw std::invalid_argument If 'chunkSize' is 0.
+        */
+        DeferredCommandBuffer(std::size_t chunkSize = 16384);
+
+        DeferredCommandBuffer(DeferredCommandBuffer&& rhs);
+        DeferredCommandBuffer& operator = (DeferredCommandBuffer&& rhs);
+
+        DeferredCommandBuffer(const DeferredCommandBuffer&) = delete;
+        DeferredCommandBuffer& operator = (const DeferredCommandBuffer&) = delete;
+
+        /**
+        \brief Replays all recorded commands in the order they were recorded on the specified command buffer.
+        \param[in] commandBuffer Specifies the command buffer (usually the one created by the render system) on which the commands are submitted.
+        \remarks The recorded commands are kept, so the same command stream can be executed several times.
+        \see Reset
+        */
+        void Execute(CommandBuffer& commandBuffer) const;
+
+        /**
+        \brief Discards all recorded commands.
+        \remarks The memory chunks of the command stream are kept and re-used for the subsequently recorded commands.
+        */
+        void Reset();
+
+        //! Returns the number of recorded commands.
+        inline std::size_t GetNumCommands() const
+        {
+            return numCommands_;
+        }
+
+        /* ----- Configuration ----- */
+
+        void SetGraphicsAPIDependentState(const GraphicsAPIDependentStateDescriptor& state) override;
+
+        void SetViewport(const Viewport& viewport) override;
+        void SetViewportArray(unsigned int numViewports, const Viewport* viewportArray) override;
+
+        void SetScissor(const Scissor& scissor) override;
+        void SetScissorArray(unsigned int numScissors, const Scissor* scissorArray) override;
+
+        void SetClearColor(const ColorRGBAf& color) override;
+        void SetClearDepth(float depth) override;
+        void SetClearStencil(int stencil) override;
+
+        void Clear(long flags) override;
+
+        /* ----- Buffers ------ */
+
+        void SetVertexBuffer(Buffer& buffer) override;
+        void SetVertexBufferArray(BufferArray& bufferArray) override;
+
+        void SetIndexBuffer(Buffer& buffer) override;
+
+        void SetConstantBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetConstantBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetConstantBufferRange(Buffer& buffer, unsigned int slot, std::size_t offset, std::size_t size, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+
+        void SetStorageBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetStorageBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+
+        void SetStreamOutputBuffer(Buffer& buffer) override;
+        void SetStreamOutputBufferArray(BufferArray& bufferArray) override;
+
+        void BeginStreamOutput(const PrimitiveType primitiveType) override;
+        void EndStreamOutput() override;
+
+        void CopyBuffer(Buffer& dstBuffer, std::size_t dstOffset, Buffer& srcBuffer, std::size_t srcOffset, std::size_t size) override;
+
+        /* ----- Textures ----- */
+
+        void SetTexture(Texture& texture, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetTextureArray(TextureArray& textureArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+
+        void CopyTexture(Texture& dstTexture, Texture& srcTexture) override;
+
+        void CopyTextureRegion(
+            Texture& dstTexture, const TextureLocation& dstLocation,
+            Texture& srcTexture, const TextureLocation& srcLocation,
+            const Gs::Vector3ui& extent, unsigned int numLayers = 1
+        ) override;
+
+        /* ----- Samplers ----- */
+
+        void SetSampler(Sampler& sampler, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetSamplerArray(SamplerArray& samplerArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+
+        /* ----- Render Targets ----- */
+
+        void SetRenderTarget(RenderTarget& renderTarget) override;
+        void SetRenderTarget(RenderContext& renderContext) override;
+
+        /* ----- Pipeline States ----- */
+
+        void SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline) override;
+        void SetComputePipeline(ComputePipeline& computePipeline) override;
+
+        /* ----- Queries ----- */
+
+        void BeginQuery(Query& query) override;
+        void EndQuery(Query& query) override;
+
+        /**
+        \brief Query results can not be recorded, since they must be returned immediately.
+        \throw std::runtime_error Always, since this function is not supported by deferred command buffers.
+        */
+        bool QueryResult(Query& query, std::uint64_t& result) override;
+
+        void BeginRenderCondition(Query& query, const RenderConditionMode mode) override;
+        void EndRenderCondition() override;
+
+        /* ----- Drawing ----- */
+
+        void Draw(unsigned int numVertices, unsigned int firstVertex) override;
+
+        void DrawIndexed(unsigned int numVertices, unsigned int firstIndex) override;
+        void DrawIndexed(unsigned int numVertices, unsigned int firstIndex, int vertexOffset) override;
+
+        void DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances) override;
+        void DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int instanceOffset) override;
+
+        void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex) override;
+        void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset) override;
+        void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset) override;
+
+        void MultiDraw(const DrawArguments* argsArray, unsigned int numDraws) override;
+        void MultiDrawIndexed(const DrawIndexedArguments* argsArray, unsigned int numDraws) override;
+
+        void DrawIndirect(Buffer& buffer, std::size_t offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::size_t offset) override;
+
+        void MultiDrawIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride = 0) override;
+        void MultiDrawIndexedIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride = 0) override;
+
+        /* ----- Compute ----- */
+
+        void Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, std::size_t offset) override;
+
+        /* ----- Misc ----- */
+
+        void SyncGPU() override;
+
+    private:
+
+        // Memory chunk of the command stream.
+        struct Chunk
+        {
+            std::unique_ptr<char[]> data;
+            std::size_t             capacity    = 0;
+            std::size_t             size        = 0;
+        };
+
+        // Allocates a new command with the specified opcode and returns the address where its arguments (of the specified size) are to be stored.
+        char* AllocCommand(std::uint8_t opcode, std::size_t argsSize, std::size_t argsAlignment);
+
+        // Allocates a new command and copies the specified arguments structure into the command stream.
+        template <typename T>
+        T* WriteCommand(std::uint8_t opcode, const T& args, std::size_t payloadSize = 0);
+
+        std::size_t         chunkSize_      = 0;
+        std::vector<Chunk>  chunks_;
+        std::size_t         currentChunk_   = 0;
+        std::size_t         numCommands_    = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -32,6 +32,8 @@ enum class DataType
     
     Float,  //!< 32-bit floating-point (float).
     Double, //!< 64-bit real type (double).
+
+    Float16,//!< 16-bit floating-point (half precision, IEEE 754).
 };
 
 //! Renderer vector types enumeration.
@@ -53,6 +55,10 @@ enum class VectorType
     UInt2,      //!< 2-Dimensional unsigned integer vector (uvec2 in GLSL, uint2 in HLSL).
     UInt3,      //!< 3-Dimensional unsigned integer vector (uvec3 in GLSL, uint3 in HLSL).
     UInt4,      //!< 4-Dimensional unsigned integer vector (uvec4 in GLSL, uint4 in HLSL).
+    Half,       //!< 1-Dimensional half precision floating-point vector (float in GLSL, half in HLSL). Only supported as vertex attribute.
+    Half2,      //!< 2-Dimensional half precision floating-point vector (vec2 in GLSL, half2 in HLSL). Only supported as vertex attribute.
+    Half3,      //!< 3-Dimensional half precision floating-point vector (vec3 in GLSL, half3 in HLSL). Only supported as vertex attribute with OpenGL.
+    Half4,      //!< 4-Dimensional half precision floating-point vector (vec4 in GLSL, half4 in HLSL). Only supported as vertex attribute.
 };
 
 /*
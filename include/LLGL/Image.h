@@ -14,6 +14,7 @@
 #include "RenderSystemFlags.h"
 #include "TextureFlags.h"
 #include <memory>
+#include <cstddef>
 
 
 namespace LLGL
@@ -54,6 +55,18 @@ enum class ImageFormat
     CompressedRGBA, //!< Generic compressed format with four color components: Red, Green, Blue, Alpha.
 };
 
+/**
+\brief Color space conversion of the color components during an image conversion.
+\remarks Alpha components (i.e. the fourth component of ImageFormat::RGBA and ImageFormat::BGRA) are never converted.
+\see ConvertImageBuffer
+*/
+enum class ColorSpaceConversion
+{
+    Disabled,       //!< No color space conversion.
+    SRGBToLinear,   //!< Converts the color components from sRGB to linear color space.
+    LinearToSRGB,   //!< Converts the color components from linear to sRGB color space.
+};
+
 
 /* ----- Structures ----- */
 
@@ -90,10 +103,60 @@ struct LLGL_EXPORT ImageDescriptor
     */
     unsigned int GetElementSize() const;
 
+    /**
+    \brief Returns the size (in bytes) between the beginning of two consecutive rows in the image buffer.
+    \param[in] width Specifies the width (in pixels) of the image region. This is only used if 'rowLength' is 0.
+    \remarks The row size is rounded up to a multiple of 'alignment'.
+    \see rowLength
+    \see alignment
+    */
+    std::size_t GetRowStride(unsigned int width) const;
+
+    /**
+    \brief Returns the size (in bytes) between the beginning of two consecutive array layers, cube faces, or depth slices in the image buffer.
+    \param[in] width Specifies the width (in pixels) of the image region. This is only used if 'rowLength' is 0.
+    \param[in] height Specifies the height (in pixels) of the image region. This is only used if 'imageHeight' is 0.
+    \see GetRowStride
+    \see imageHeight
+    */
+    std::size_t GetImageStride(unsigned int width, unsigned int height) const;
+
     ImageFormat     format          = ImageFormat::RGBA;    //!< Specifies the image format. By default ImageFormat::RGBA.
     DataType        dataType        = DataType::UInt8;      //!< Specifies the image data type. This must be DataType::UInt8 for compressed images.
     const void*     buffer          = nullptr;              //!< Pointer to the image buffer.
     unsigned int    compressedSize  = 0;                    //!< Specifies the size (in bytes) of a compressed image. This must be 0 for uncompressed images.
+
+    /**
+    \brief Specifies the number of pixels between the beginning of two consecutive rows in the image buffer. By default 0.
+    \remarks If this is 0, the rows are tightly packed, i.e. the row length is equal to the width of the image region.
+    This can be used to upload a sub-rectangle of a larger image without repacking it, e.g. by setting this to the width of the entire image
+    and offsetting the 'buffer' pointer to the first pixel of the sub-rectangle. This is ignored for compressed images.
+    */
+    unsigned int    rowLength       = 0;
+
+    /**
+    \brief Specifies the number of rows between the beginning of two consecutive array layers, cube faces, or depth slices in the image buffer. By default 0.
+    \remarks If this is 0, the images are tightly packed, i.e. the image height is equal to the height of the image region. This is ignored for compressed images.
+    */
+    unsigned int    imageHeight     = 0;
+
+    /**
+    \brief Specifies the alignment (in bytes) of the beginning of each row in the image buffer. By default 1.
+    \remarks This must be 1, 2, 4, or 8. This is ignored for compressed images.
+    */
+    unsigned int    alignment       = 1;
+};
+
+/**
+\brief Statistics of the internal worker thread pool used for multi-threaded image conversion.
+\see QueryImageThreadPoolStatistics
+*/
+struct ImageThreadPoolStatistics
+{
+    std::size_t numWorkerThreads    = 0; //!< Number of worker threads in the pool. This is 0 until the first multi-threaded conversion.
+    std::size_t numJobs             = 0; //!< Number of multi-threaded conversions that have been distributed over the pool.
+    std::size_t numChunks           = 0; //!< Number of work chunks that have been processed.
+    std::size_t numStolenChunks     = 0; //!< Number of work chunks that have been stolen by a thread that ran out of work.
 };
 
 
@@ -120,6 +183,17 @@ i.e. either ImageFormat::Depth or ImageFormat::DepthStencil.
 */
 LLGL_EXPORT bool IsDepthStencilFormat(const ImageFormat format);
 
+/**
+\brief Returns the statistics of the internal worker thread pool used by "ConvertImageBuffer".
+\remarks The worker threads are created once on the first multi-threaded conversion and are reused for all subsequent conversions.
+The number of worker threads is determined by the number of threads the system supports (see 'maxThreadCount').
+\see ConvertImageBuffer
+*/
+LLGL_EXPORT ImageThreadPoolStatistics QueryImageThreadPoolStatistics();
+
+//! Resets the job and chunk counters of the image thread pool statistics.
+LLGL_EXPORT void ResetImageThreadPoolStatistics();
+
 /**
 \brief Converts the image format and data type of the source image (only uncompressed color formats).
 \param[in] srcFormat Specifies the source image format.
@@ -131,6 +205,9 @@ LLGL_EXPORT bool IsDepthStencilFormat(const ImageFormat format);
 \param[in] threadCount Specifies the number of threads to use for conversion.
 If this is less than 2, no multi-threading is used. If this is 'maxThreadCount',
 the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
+The work is distributed over a persistent thread pool, so no threads are created per conversion (see QueryImageThreadPoolStatistics).
+\param[in] colorConversion Specifies the color space conversion of the color components. By default ColorSpaceConversion::Disabled.
+8-bit sources and destinations are converted with lookup tables (256 entries for sRGB to linear, 4096 entries for linear to sRGB).
 \return Byte buffer with the converted image data or null if no conversion is necessary.
 This can be casted to the respective target data type (e.g. "unsigned char", "int", "float" etc.).
 \remarks Compressed images and depth-stencil images can not be converted.
@@ -149,10 +226,51 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
     std::size_t srcBufferSize,
     ImageFormat dstFormat,
     DataType    dstDataType,
-    std::size_t threadCount = 0
+    std::size_t threadCount = 0,
+    ColorSpaceConversion colorConversion = ColorSpaceConversion::Disabled
 );
 
 
+/**
+\brief Converts the image format and data type of the source image into the specified destination buffer (only uncompressed color formats).
+\param[in] srcFormat Specifies the source image format.
+\param[in] srcDataType Specifies the source data type.
+\param[in] srcBuffer Pointer to the source image buffer which is to be converted.
+\param[in] srcRowPitch Specifies the size (in bytes) between two consecutive rows in the source image.
+If this is 0, the rows are assumed to be tightly packed.
+\param[in] dstFormat Specifies the destination image format.
+\param[in] dstDataType Specifies the destination data type.
+\param[out] dstBuffer Pointer to the destination image buffer, e.g. mapped buffer memory. This must not overlap with the source buffer.
+\param[in] dstBufferSize Specifies the size (in bytes) of the destination image buffer.
+\param[in] dstRowPitch Specifies the size (in bytes) between two consecutive rows in the destination image.
+If this is 0, the rows are assumed to be tightly packed.
+\param[in] width Specifies the number of pixels in each image row.
+\param[in] height Specifies the number of image rows.
+\param[in] threadCount Specifies the number of threads to use for conversion. By default 0.
+\param[in] colorConversion Specifies the color space conversion of the color components. By default ColorSpaceConversion::Disabled.
+\remarks In contrast to the other overload, no intermediate buffer is allocated. The padding bytes between the destination rows are left unchanged.
+If source and destination have the same format and data type and no color space conversion is specified, the rows are copied.
+\throw std::invalid_argument If a compressed image format or a depth-stencil format is specified either as source or destination,
+if a row pitch is less than the size of an image row, if the destination buffer is too small,
+or if 'srcBuffer' or 'dstBuffer' is a null pointer.
+\see ConvertImageBuffer(ImageFormat, DataType, const void*, std::size_t, ImageFormat, DataType, std::size_t, ColorSpaceConversion)
+*/
+LLGL_EXPORT void ConvertImageBuffer(
+    ImageFormat srcFormat,
+    DataType    srcDataType,
+    const void* srcBuffer,
+    std::size_t srcRowPitch,
+    ImageFormat dstFormat,
+    DataType    dstDataType,
+    void*       dstBuffer,
+    std::size_t dstBufferSize,
+    std::size_t dstRowPitch,
+    std::size_t width,
+    std::size_t height,
+    std::size_t threadCount = 0,
+    ColorSpaceConversion colorConversion = ColorSpaceConversion::Disabled
+);
+
 } // /namespace LLGL
 
 
@@ -0,0 +1,141 @@
+/*
+ * ImageCompression.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_IMAGE_COMPRESSION_H__
+#define __LLGL_IMAGE_COMPRESSION_H__
+
+
+#include "Export.h"
+#include "Image.h"
+#include "TextureFlags.h"
+
+
+namespace LLGL
+{
+
+
+/* ----- Enumerations ----- */
+
+//! Image compression quality.
+enum class CompressionQuality
+{
+    /**
+    \brief Fast compression. The block end-points are derived from the bounding box of the block colors.
+    \remarks This is suitable for textures which are generated at runtime every frame or on loading.
+    */
+    Fast,
+
+    /**
+    \brief High quality compression. The block end-points are derived from the principal axis of the block colors
+    and refined with a least squares fit. For DXT5 alpha blocks, both interpolation modes are evaluated.
+    */
+    High,
+};
+
+
+/* ----- Structures ----- */
+
+//! Image compression descriptor structure.
+struct ImageCompressionDescriptor
+{
+    /**
+    \brief Compressed texture format. By default TextureFormat::RGBA_DXT5.
+    \remarks This must be TextureFormat::RGB_DXT1, TextureFormat::RGBA_DXT1, TextureFormat::RGBA_DXT3, or TextureFormat::RGBA_DXT5.
+    For TextureFormat::RGBA_DXT1, pixels with an alpha value less than 128 are encoded as transparent black.
+    */
+    TextureFormat       format      = TextureFormat::RGBA_DXT5;
+
+    //! Compression quality. By default CompressionQuality::High.
+    CompressionQuality  quality     = CompressionQuality::High;
+
+    //! Number of threads to compress the image. The blocks are distributed row by row. \see ConvertImageBuffer
+    std::size_t         threadCount = 0;
+};
+
+
+/* ----- Functions ----- */
+
+/**
+\brief Returns the size (in bytes) of an image with the specified compressed texture format and dimensions.
+\remarks The image is divided into blocks of 4x4 pixels, where each block occupies 8 bytes for DXT1,
+and 16 bytes for DXT3 and DXT5. Partial blocks at the right and bottom border count as entire blocks.
+\return Compressed image size, or 0 if 'format' is not a compressed format.
+*/
+LLGL_EXPORT std::size_t CompressedImageSize(const TextureFormat format, unsigned int width, unsigned int height);
+
+/**
+\brief Compresses the specified image into the S3TC (DXT) format.
+\param[in] srcFormat Specifies the source image format. This must be an uncompressed color format.
+\param[in] srcDataType Specifies the source data type.
+\param[in] srcBuffer Pointer to the source image buffer.
+\param[in] width Specifies the image width (in pixels).
+\param[in] height Specifies the image height (in pixels).
+\param[in] desc Specifies the compression descriptor.
+\return Byte buffer with the compressed image data. Its size is determined by "CompressedImageSize".
+The data can be passed to RenderSystem::CreateTexture or RenderSystem::WriteTexture with the compressed image descriptor:
+\code
+auto compressedSize = LLGL::CompressedImageSize(compressionDesc.format, width, height);
+auto compressedData = LLGL::CompressImageBuffer(LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, imageData, width, height, compressionDesc);
+LLGL::ImageDescriptor imageDesc(LLGL::ImageFormat::CompressedRGBA, compressedData.get(), static_cast<unsigned int>(compressedSize));
+\endcode
+\remarks Sources other than ImageFormat::RGBA with DataType::UInt8 are converted before compression.
+If the image dimensions are not a multiple of 4, the border pixels are replicated to fill the partial blocks.
+\throw std::invalid_argument If 'desc.format' is not a compressed format, if the source format is a compressed or depth-stencil format,
+or if 'srcBuffer' is a null pointer.
+\see CompressedImageSize
+*/
+LLGL_EXPORT ByteBuffer CompressImageBuffer(
+    ImageFormat                         srcFormat,
+    DataType                            srcDataType,
+    const void*                         srcBuffer,
+    unsigned int                        width,
+    unsigned int                        height,
+    const ImageCompressionDescriptor&   desc = {}
+);
+
+/**
+\brief Decompresses the specified S3TC (DXT) image into an uncompressed image format.
+\param[in] srcFormat Specifies the compressed texture format of the source image.
+This must be TextureFormat::RGB_DXT1, TextureFormat::RGBA_DXT1, TextureFormat::RGBA_DXT3, or TextureFormat::RGBA_DXT5.
+\param[in] srcBuffer Pointer to the compressed source image buffer.
+\param[in] srcBufferSize Specifies the size (in bytes) of the source image buffer.
+This must be at least "CompressedImageSize(srcFormat, width, height) * layers".
+\param[in] dstFormat Specifies the destination image format. This must be an uncompressed color format.
+\param[in] dstDataType Specifies the destination data type.
+\param[in] width Specifies the image width (in pixels).
+\param[in] height Specifies the image height (in pixels).
+\param[in] layers Specifies the number of array layers (or cube faces). The compressed layers must be tightly packed one after another.
+\param[in] threadCount Specifies the number of threads to decompress the image. The blocks are distributed row by row. \see ConvertImageBuffer
+\return Byte buffer with the decompressed image data, where the layers are tightly packed one after another.
+\remarks This is used as software fallback for renderers without support for compressed textures,
+and to read back compressed textures into uncompressed image formats.
+The blocks are decompressed into ImageFormat::RGBA with DataType::UInt8 and then converted to the destination format if necessary.
+\throw std::invalid_argument If 'srcFormat' is not a compressed format, if the destination format is a compressed or depth-stencil format,
+if 'srcBufferSize' is too small, or if 'srcBuffer' is a null pointer.
+\see CompressImageBuffer
+*/
+LLGL_EXPORT ByteBuffer DecompressImageBuffer(
+    TextureFormat   srcFormat,
+    const void*     srcBuffer,
+    std::size_t     srcBufferSize,
+    ImageFormat     dstFormat,
+    DataType        dstDataType,
+    unsigned int    width,
+    unsigned int    height,
+    unsigned int    layers      = 1,
+    std::size_t     threadCount = 0
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
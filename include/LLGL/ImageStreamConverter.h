@@ -0,0 +1,163 @@
+/*
+ * ImageStreamConverter.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_IMAGE_STREAM_CONVERTER_H__
+#define __LLGL_IMAGE_STREAM_CONVERTER_H__
+
+
+#include "Export.h"
+#include "Image.h"
+#include <functional>
+
+
+namespace LLGL
+{
+
+
+/* ----- Structures ----- */
+
+//! Image stream converter descriptor structure.
+struct ImageStreamConverterDescriptor
+{
+    ImageFormat srcFormat           = ImageFormat::RGBA;    //!< Source image format.
+    DataType    srcDataType         = DataType::UInt8;      //!< Source data type.
+    ImageFormat dstFormat           = ImageFormat::RGBA;    //!< Destination image format.
+    DataType    dstDataType         = DataType::UInt8;      //!< Destination data type.
+
+    //! Width (in pixels) of the entire image. This is the size of each row passed to "ImageStreamConverter::WriteRows".
+    std::size_t width               = 0;
+
+    /**
+    \brief Size (in bytes) of the scratch buffer for converted image data. By default 4 MB.
+    \remarks This is the upper bound of the memory the converter allocates, unless a single destination row is larger than this.
+    Converted rows are collected in this buffer until it is full and then passed to the callback at once.
+    */
+    std::size_t scratchBufferSize   = (4 * 1024 * 1024);
+
+    //! Number of threads to convert each block of rows. \see ConvertImageBuffer
+    std::size_t threadCount         = 0;
+
+    //! Color space conversion of the color components. \see ConvertImageBuffer
+    ColorSpaceConversion colorConversion = ColorSpaceConversion::Disabled;
+};
+
+//! Image region of converted data passed to the image stream converter callback.
+struct ImageStreamRegion
+{
+    std::size_t x       = 0; //!< Left-most pixel of the region.
+    std::size_t y       = 0; //!< Top-most row of the region.
+    std::size_t width   = 0; //!< Width (in pixels) of the region.
+    std::size_t height  = 0; //!< Height (in rows) of the region.
+};
+
+
+/* ----- Classes ----- */
+
+/**
+\brief Converts large images block by block with a bounded amount of memory.
+\remarks Rows or tiles of the source image are passed in, and the converted data is passed out through a callback.
+This allows to pipeline decoding, conversion, and uploading (e.g. with RenderSystem::WriteTexture) of large images,
+without holding the entire source and destination image in memory at the same time.
+\code
+LLGL::ImageStreamConverterDescriptor desc;
+desc.srcFormat      = LLGL::ImageFormat::RGBA;
+desc.srcDataType    = LLGL::DataType::Float;
+desc.width          = 16384;
+LLGL::ImageStreamConverter converter(
+    desc,
+    [&](const LLGL::ImageStreamRegion& region, const void* data, std::size_t dataSize)
+    {
+        // Upload converted rows here ...
+    }
+);
+while (decoder.HasRows())
+    converter.WriteRows(decoder.NextRows(), decoder.NumRows());
+converter.Flush();
+\endcode
+\see ConvertImageBuffer
+*/
+class LLGL_EXPORT ImageStreamConverter
+{
+
+    public:
+
+        /**
+        \brief Callback function for converted image data.
+        \param[in] region Specifies the region of the destination image.
+        \param[in] data Pointer to the converted and tightly packed image data. This is only valid during the callback.
+        \param[in] dataSize Specifies the size (in bytes) of the converted image data.
+        */
+        using Callback = std::function<void(const ImageStreamRegion& region, const void* data, std::size_t dataSize)>;
+
+        ImageStreamConverter(const ImageStreamConverter&) = delete;
+        ImageStreamConverter& operator = (const ImageStreamConverter&) = delete;
+
+        /**
+        \brief Initializes the converter and allocates the scratch buffer.
+        \throw std::invalid_argument If the image formats can not be converted (see ConvertImageBuffer),
+        if the image width is zero, or if the callback is empty.
+        */
+        ImageStreamConverter(const ImageStreamConverterDescriptor& desc, const Callback& callback);
+
+        /**
+        \brief Converts the next rows of the source image.
+        \param[in] srcBuffer Pointer to the source rows.
+        \param[in] numRows Specifies the number of rows.
+        \param[in] srcRowPitch Specifies the size (in bytes) between two consecutive source rows. If this is 0, the rows are assumed to be tightly packed.
+        \remarks The callback is invoked whenever the scratch buffer is full, so the source rows need not be kept alive after this call.
+        The remaining rows are passed to the callback with the next call to "WriteRows", "WriteTile", or "Flush".
+        */
+        void WriteRows(const void* srcBuffer, std::size_t numRows, std::size_t srcRowPitch = 0);
+
+        /**
+        \brief Converts the specified tile of the source image.
+        \param[in] srcBuffer Pointer to the source tile.
+        \param[in] region Specifies the region of the tile within the image. This region is passed back to the callback.
+        \param[in] srcRowPitch Specifies the size (in bytes) between two consecutive source rows of the tile.
+        \remarks If the converted tile is larger than the scratch buffer, it is passed to the callback in several horizontal slices.
+        Pending rows from "WriteRows" are flushed before the tile is converted.
+        */
+        void WriteTile(const void* srcBuffer, const ImageStreamRegion& region, std::size_t srcRowPitch = 0);
+
+        //! Passes all pending rows to the callback.
+        void Flush();
+
+        //! Returns the index of the next row that will be converted by "WriteRows".
+        inline std::size_t GetNextRow() const
+        {
+            return nextRow_;
+        }
+
+    private:
+
+        std::size_t GetMaxRows(std::size_t width) const;
+
+        void ConvertRows(const void* srcBuffer, std::size_t srcRowPitch, std::size_t width, std::size_t numRows, std::size_t dstOffset);
+
+        ImageStreamConverterDescriptor  desc_;
+        Callback                        callback_;
+
+        std::size_t                     srcPixelSize_   = 0;
+        std::size_t                     dstPixelSize_   = 0;
+
+        ByteBuffer                      scratch_;
+        std::size_t                     scratchSize_    = 0;
+
+        std::size_t                     pendingRows_    = 0;
+        std::size_t                     nextRow_        = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -13,6 +13,8 @@
 #include "Input.h"
 #include "Timer.h"
 #include "RenderSystem.h"
+#include "BufferPool.h"
+#include "DeferredCommandBuffer.h"
 #include "ColorRGB.h"
 #include "ColorRGBA.h"
 #include "Desktop.h"
@@ -0,0 +1,142 @@
+/*
+ * MipmapChain.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_MIPMAP_CHAIN_H__
+#define __LLGL_MIPMAP_CHAIN_H__
+
+
+#include "Export.h"
+#include "Image.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/* ----- Enumerations ----- */
+
+//! Downsampling filter for the MIP-map chain generation.
+enum class MipmapFilter
+{
+    Box,        //!< Box filter, i.e. the average of all covered pixels. This is the fastest filter.
+    Kaiser,     //!< Kaiser windowed sinc filter (radius 3). Preserves more details than the box filter.
+    Lanczos,    //!< Lanczos filter (radius 3). Slightly sharper than the Kaiser filter but with more ringing.
+};
+
+
+/* ----- Structures ----- */
+
+//! MIP-map chain generation descriptor structure.
+struct MipmapChainDescriptor
+{
+    MipmapFilter    filter          = MipmapFilter::Box;    //!< Downsampling filter. By default MipmapFilter::Box.
+
+    /**
+    \brief Specifies whether the color components are stored in sRGB color space. By default false.
+    \remarks If this is true, the color components are converted to linear color space before they are filtered,
+    and converted back to sRGB color space afterwards. Alpha components are always filtered as they are.
+    */
+    bool            gammaCorrect    = false;
+
+    //! Maximal number of MIP-map levels (including the base level). If this is 0, the full MIP-map chain is generated. By default 0.
+    unsigned int    maxNumMipLevels = 0;
+
+    //! Number of threads to generate each MIP-map level. \see ConvertImageBuffer
+    std::size_t     threadCount     = 0;
+};
+
+//! Single MIP-map level within a MIP-map chain.
+struct MipmapLevel
+{
+    unsigned int    mipLevel    = 0; //!< MIP-map level index, where 1 is the first level below the base level.
+    unsigned int    width       = 0; //!< Width (in pixels) of this MIP-map level.
+    unsigned int    height      = 0; //!< Height (in pixels) of this MIP-map level.
+    unsigned int    layers      = 0; //!< Number of array layers (equal for all MIP-map levels).
+    std::size_t     offset      = 0; //!< Offset (in bytes) of this MIP-map level within the MIP-map chain data.
+    std::size_t     size        = 0; //!< Size (in bytes) of this MIP-map level, i.e. all layers tightly packed.
+};
+
+/**
+\brief MIP-map chain structure with the image data of all generated MIP-map levels.
+\remarks The data of each MIP-map level can be passed directly to RenderSystem::WriteTexture:
+\code
+LLGL::MipmapChainDescriptor mipDesc;
+mipDesc.filter          = LLGL::MipmapFilter::Kaiser;
+mipDesc.gammaCorrect    = true;
+mipDesc.threadCount     = LLGL::maxThreadCount;
+
+auto mipChain = LLGL::GenerateMipmapChain(LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, imageData, width, height, 1, mipDesc);
+
+for (std::size_t i = 0; i < mipChain.levels.size(); ++i)
+{
+    const auto& level = mipChain.levels[i];
+    LLGL::SubTextureDescriptor subTexDesc;
+    subTexDesc.mipLevel         = level.mipLevel;
+    subTexDesc.texture2D.width  = level.width;
+    subTexDesc.texture2D.height = level.height;
+    subTexDesc.texture2D.layers = level.layers;
+    renderer->WriteTexture(*texture, subTexDesc, mipChain.GetImageDescriptor(i));
+}
+\endcode
+\see GenerateMipmapChain
+*/
+struct LLGL_EXPORT MipmapChain
+{
+    /**
+    \brief Returns the image descriptor for the MIP-map level at the specified index in the "levels" list.
+    \throw std::out_of_range If 'index' is out of range.
+    */
+    ImageDescriptor GetImageDescriptor(std::size_t index) const;
+
+    ImageFormat                 format      = ImageFormat::RGBA;    //!< Image format of all MIP-map levels (equal to the source image format).
+    DataType                    dataType    = DataType::UInt8;      //!< Data type of all MIP-map levels (equal to the source data type).
+    ByteBuffer                  data;                               //!< Image data of all MIP-map levels.
+    std::vector<MipmapLevel>    levels;                             //!< MIP-map levels below the base level, in order of descending size.
+};
+
+
+/* ----- Functions ----- */
+
+/**
+\brief Generates the MIP-map chain for the specified image on the CPU.
+\param[in] format Specifies the image format. This must be an uncompressed color format.
+\param[in] dataType Specifies the image data type.
+\param[in] srcBuffer Pointer to the image data of the base level. The layers must be tightly packed one after another.
+\param[in] width Specifies the width (in pixels) of the base level.
+\param[in] height Specifies the height (in pixels) of the base level. This must be 1 for 1D textures.
+\param[in] layers Specifies the number of array layers (or cube faces). Each layer is downsampled independently.
+\param[in] desc Specifies the MIP-map chain descriptor.
+\return MIP-map chain with all MIP-map levels below the base level, in the same format and data type as the source image.
+\remarks In contrast to RenderSystem::GenerateMips, this function does not require a texture.
+This is useful to generate the MIP-maps for texture formats where the GPU can not generate them,
+or to generate them on worker threads while the render system is busy.
+Each level is downsampled from the previous level in 32-bit floating-point precision.
+\throw std::invalid_argument If a compressed image format or a depth-stencil format is specified,
+if any of the dimensions is zero, or if 'srcBuffer' is a null pointer.
+\see MipmapChain
+\see NumMipLevels
+*/
+LLGL_EXPORT MipmapChain GenerateMipmapChain(
+    ImageFormat                     format,
+    DataType                        dataType,
+    const void*                     srcBuffer,
+    unsigned int                    width,
+    unsigned int                    height,
+    unsigned int                    layers,
+    const MipmapChainDescriptor&    desc = {}
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
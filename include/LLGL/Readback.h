@@ -0,0 +1,70 @@
+/*
+ * Readback.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_READBACK_H__
+#define __LLGL_READBACK_H__
+
+
+#include "Export.h"
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Readback interface.
+\remarks A readback is a staging copy of GPU data, which is filled asynchronously by the GPU.
+Instead of stalling the CPU until all previous GPU work has been finished (like RenderSystem::ReadTexture does),
+the readback can be polled with "IsReady" and mapped one or two frames later, when the GPU has finished the copy.
+\see RenderSystem::ReadTextureAsync
+\see RenderSystem::ReadBufferAsync
+\see RenderSystem::MapReadback
+*/
+class LLGL_EXPORT Readback
+{
+
+    public:
+
+        Readback(const Readback&) = delete;
+        Readback& operator = (const Readback&) = delete;
+
+        virtual ~Readback();
+
+        /**
+        \brief Returns true if the GPU has finished copying the data into this readback.
+        \remarks This function never blocks. If this returns true, mapping the readback will not stall the CPU.
+        \see RenderSystem::MapReadback
+        */
+        virtual bool IsReady() = 0;
+
+        //! Returns the size (in bytes) of the readback data.
+        inline std::size_t GetSize() const
+        {
+            return size_;
+        }
+
+    protected:
+
+        Readback(std::size_t size);
+
+    private:
+
+        std::size_t size_ = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -28,6 +28,8 @@
 #include "GraphicsPipeline.h"
 #include "ComputePipeline.h"
 #include "Query.h"
+#include "Readback.h"
+#include "StreamingBuffer.h"
 
 #include <string>
 #include <memory>
@@ -222,17 +224,98 @@ class LLGL_EXPORT RenderSystem
         */
         virtual void UnmapBuffer(Buffer& buffer) = 0;
 
+        /**
+        \brief Maps a range of the specified buffer from GPU to CPU memory space.
+        \param[in] buffer Specifies the buffer which is to be mapped.
+        \param[in] offset Specifies the offset (in bytes) at which the range begins.
+        \param[in] size Specifies the size (in bytes) of the range.
+        This offset plus the range size (i.e. 'offset + size') must be less than or equal to the size of the buffer.
+        \param[in] mapFlags Specifies the mapping flags. This can be a bitwise OR combination of the entries of the BufferMapFlags enumeration.
+        \return Raw pointer to the beginning of the mapped range, or null if the mapping failed.
+        \remarks In contrast to "MapBuffer", the flags BufferMapFlags::WriteDiscard and BufferMapFlags::NoOverwrite
+        allow to update parts of a buffer every frame without implicit synchronization between CPU and GPU.
+        The range must be unmapped with "UnmapBuffer".
+        \see BufferMapFlags
+        \see FlushMappedRange
+        \see UnmapBuffer
+        */
+        virtual void* MapBufferRange(Buffer& buffer, std::size_t offset, std::size_t size, long mapFlags) = 0;
+
+        /**
+        \brief Flushes the modifications of a sub-range of the currently mapped buffer range.
+        \param[in] buffer Specifies the buffer, which must be currently mapped with BufferMapFlags::ExplicitFlush.
+        \param[in] offset Specifies the offset (in bytes) of the sub-range, relative to the beginning of the mapped range.
+        \param[in] size Specifies the size (in bytes) of the sub-range.
+        \remarks Render systems without explicit flushing (such as Direct3D 11) make all modifications visible when the buffer is unmapped.
+        \see MapBufferRange
+        */
+        virtual void FlushMappedRange(Buffer& buffer, std::size_t offset, std::size_t size) = 0;
+
+        /**
+        \brief Reads a range of the specified buffer asynchronously.
+        \param[in] buffer Specifies the buffer to read from, e.g. a storage buffer or stream-output buffer written by the GPU.
+        \param[in] offset Specifies the offset (in bytes) at which the range begins.
+        \param[in] size Specifies the size (in bytes) of the range.
+        This offset plus the range size (i.e. 'offset + size') must be less than or equal to the size of the buffer.
+        \return Pointer to the new readback object, which receives a copy of the buffer range.
+        \remarks In contrast to "MapBuffer" with read access, this function does not map the buffer itself and does not stall the pipeline.
+        Instead, the buffer range is copied into a staging buffer by the GPU, and only this staging copy is mapped once the readback is ready.
+        This allows to read back the results of compute shaders every frame without a CPU/GPU synchronization.
+        \see Readback::IsReady
+        \see MapReadback
+        */
+        virtual Readback* ReadBufferAsync(const Buffer& buffer, std::size_t offset, std::size_t size) = 0;
+
+        /* ----- Streaming buffers ----- */
+
+        /**
+        \brief Creates a new streaming buffer for per-frame dynamic constant buffer data.
+        \param[in] desc Specifies the streaming buffer descriptor.
+        \remarks The size of the frame partition is rounded up to a multiple of RenderingCaps::constantBufferOffsetAlignment.
+        \throws std::invalid_argument If 'desc.size' or 'desc.numFrames' is 0.
+        \throws std::runtime_error If the render system does not support constant buffer ranges (see CommandBuffer::SetConstantBufferRange).
+        \see StreamingBuffer
+        */
+        virtual StreamingBuffer* CreateStreamingBuffer(const StreamingBufferDescriptor& desc) = 0;
+
+        //! Releases the specified streaming buffer object. After this call, the specified object must no longer be used.
+        virtual void Release(StreamingBuffer& streamingBuffer) = 0;
+
+        /**
+        \brief Writes the specified data into the frame partition of the streaming buffer, which is currently written by the CPU.
+        \param[in] streamingBuffer Specifies the streaming buffer which is to be written.
+        \param[in] data Raw pointer to the data which is to be written. This must not be null!
+        \param[in] dataSize Specifies the size (in bytes) of the data block.
+        \return Offset (in bytes) of the written data within the buffer returned by StreamingBuffer::GetBuffer.
+        This offset is always a multiple of RenderingCaps::constantBufferOffsetAlignment.
+        \remarks The data must not be written after the buffer range has been bound, and the data must not be overwritten until the next frame.
+        \throws std::out_of_range If the remaining space of the current frame partition is too small for the data block.
+        \see CommandBuffer::SetConstantBufferRange
+        \see AdvanceStreamingBuffer
+        */
+        virtual std::size_t WriteStreamingBuffer(StreamingBuffer& streamingBuffer, const void* data, std::size_t dataSize) = 0;
+
+        /**
+        \brief Advances the streaming buffer to the next frame partition of its ring.
+        \remarks This should be called once per frame, after all draw calls that read from the current frame partition have been submitted.
+        If the GPU is still reading from the next frame partition (i.e. the CPU is more than StreamingBufferDescriptor::numFrames frames ahead),
+        this function waits until the GPU has finished these commands.
+        */
+        virtual void AdvanceStreamingBuffer(StreamingBuffer& streamingBuffer) = 0;
+
         /* ----- Textures ----- */
 
         /**
         \brief Creates a new texture.
         \param[in] textureDesc Specifies the texture descriptor.
         \param[in] imageDesc Optional pointer to the image data descriptor.
-        If this is null, the texture will be initialized with the currently configured default image color.
+        If this is null, the texture will be initialized with the currently configured default image color,
+        unless RenderSystemConfiguration::leaveTexturesUninitialized is true (only the OpenGL renderer initializes such textures).
         If this is non-null, it is used to initialize the texture data.
         This parameter will be ignored if the texture type is a multi-sampled texture (i.e. TextureType::Texture2DMS or TextureType::Texture2DMSArray).
         \see WriteTexture
         \see RenderSystemConfiguration::defaultImageColor
+        \see RenderSystemConfiguration::leaveTexturesUninitialized
         */
         virtual Texture* CreateTexture(const TextureDescriptor& textureDesc, const ImageDescriptor* imageDesc = nullptr) = 0;
 
@@ -287,6 +370,52 @@ class LLGL_EXPORT RenderSystem
         */
         virtual void ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) = 0;
 
+        /**
+        \brief Reads the image data from the specified texture asynchronously.
+        \param[in] texture Specifies the texture object to read from.
+        \param[in] mipLevel Specifies the MIP-level from which to read the image data.
+        \param[in] imageFormat Specifies the output image format. This must not be a compressed format.
+        \param[in] dataType Specifies the output data type.
+        \return Pointer to the new readback object, which receives the image data in the same layout as the output buffer of "ReadTexture".
+        \remarks In contrast to "ReadTexture", this function does not wait until the GPU has finished all previous work.
+        Instead, the image data is copied into a staging buffer by the GPU, and the readback can be mapped once it is ready:
+        \code
+        // Frame N: request the image data
+        auto readback = renderSystem->ReadTextureAsync(*texture, 0, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8);
+
+        // Frame N+1 or N+2: consume the image data
+        if (readback->IsReady())
+        {
+            auto image = renderSystem->MapReadback(*readback);
+            // ...
+            renderSystem->UnmapReadback(*readback);
+            renderSystem->Release(*readback);
+        }
+        \endcode
+        \throw std::invalid_argument If 'imageFormat' specifies a compressed format.
+        \see Readback::IsReady
+        \see MapReadback
+        */
+        virtual Readback* ReadTextureAsync(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType) = 0;
+
+        /**
+        \brief Maps the data of the specified readback into CPU memory space for reading.
+        \remarks If the readback is not ready yet, this function waits until the GPU has finished the copy.
+        \return Raw pointer to the readback data. The size of this memory block is determined by Readback::GetSize.
+        \see Readback::IsReady
+        \see UnmapReadback
+        */
+        virtual const void* MapReadback(Readback& readback) = 0;
+
+        /**
+        \brief Unmaps the specified readback.
+        \see MapReadback
+        */
+        virtual void UnmapReadback(Readback& readback) = 0;
+
+        //! Releases the specified readback object. After this call, the specified object must no longer be used.
+        virtual void Release(Readback& readback) = 0;
+
         /**
         \brief Generates the MIP ("Multum in Parvo") maps for the specified texture.
         \see https://developer.valvesoftware.com/wiki/MIP_Mapping
@@ -402,15 +531,28 @@ class LLGL_EXPORT RenderSystem
         //! Validates the specified arguments to be used for buffer array creation.
         void AssertCreateBufferArray(unsigned int numBuffers, Buffer* const * bufferArray);
 
+        //! Validates the specified streaming buffer descriptor to be used for streaming buffer creation.
+        void AssertCreateStreamingBuffer(const StreamingBufferDescriptor& desc);
+
         //! Validates the specified arguments to be used for texture array creation.
         void AssertCreateTextureArray(unsigned int numTextures, Texture* const * textureArray);
 
         //! Validates the specified arguments to be used for sampler array creation.
         void AssertCreateSamplerArray(unsigned int numSamplers, Sampler* const * samplerArray);
 
+        /**
+        \brief Returns the rendering profiler which has been passed to the "Load" function, or null if there is no profiler.
+        \remarks This can be used by a render system to record backend specific counters (e.g. internal cache hits).
+        */
+        inline RenderingProfiler* GetProfiler() const
+        {
+            return profiler_;
+        }
+
     private:
 
         std::string                 name_;
+        RenderingProfiler*          profiler_   = nullptr;
 
         RendererInfo                info_;
         RenderingCaps               caps_;
@@ -85,9 +85,19 @@ struct RenderSystemConfiguration
     /**
     \brief Specifies the default color for an uninitialized textures. The default value is black (0, 0, 0, 0).
     \remarks This will be used when a texture is created and no initial image data is specified.
+    \note Only supported with: OpenGL. The other renderers do not initialize such textures.
     */
     ColorRGBAub defaultImageColor { 0, 0, 0, 0 };
 
+    /**
+    \brief Specifies whether textures, which are created without initial image data, are left uninitialized. By default false.
+    \remarks If this is true, 'defaultImageColor' is ignored and the content of such textures is undefined until it is written.
+    This avoids the costs of initializing large textures whose content is overwritten anyway, e.g. render targets.
+    \note Only supported with: OpenGL. The other renderers always leave such textures uninitialized, i.e. this is implicitly true for them.
+    \see defaultImageColor
+    */
+    bool        leaveTexturesUninitialized = false;
+
     /**
     \brief Specifies the number of threads that will be used internally by the render system. By default maxThreadCount.
     \remarks This is mainly used by the Direct3D render systems, e.g. inside the "CreateTexture" and "WriteTexture" functions
@@ -249,6 +259,14 @@ struct RenderingCaps
     */
     bool            hasStreamOutputs                = false;
 
+    /**
+    \brief Specifies whether indirect drawing (i.e. with the draw arguments from a buffer) is supported.
+    \see BufferType::Indirect
+    \see CommandBuffer::DrawIndirect
+    \see CommandBuffer::DrawIndexedIndirect
+    */
+    bool            hasIndirectDrawing              = false;
+
     //! Specifies maximum number of texture array layers (for 1D-, 2D-, and cube textures).
     unsigned int    maxNumTextureArrayLayers        = 0;
 
@@ -258,6 +276,12 @@ struct RenderingCaps
     //! Specifies maximum size (in bytes) of each constant buffer.
     unsigned int    maxConstantBufferSize           = 0;
 
+    /**
+    \brief Specifies the alignment (in bytes) of each offset within a constant buffer.
+    \see CommandBuffer::SetConstantBufferRange
+    */
+    unsigned int    constantBufferOffsetAlignment   = 0;
+
     //! Specifies maximum number of patch control points.
     int             maxPatchVertices                = 0;
 
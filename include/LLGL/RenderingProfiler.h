@@ -82,6 +82,23 @@ class LLGL_EXPORT RenderingProfiler
 
         Counter writeBuffer;            //!< Counter for buffer writings. \see RenderSystem::WriteBuffer
         Counter mapBuffer;              //!< Counter for buffer mappings. \see RenderSystem::MapBuffer
+        Counter writeStreamingBuffer;   //!< Counter for streaming buffer writings. \see RenderSystem::WriteStreamingBuffer
+        Counter copyBuffer;             //!< Counter for buffer copies. \see CommandBuffer::CopyBuffer
+        Counter copyTexture;            //!< Counter for texture copies. \see CommandBuffer::CopyTexture
+
+        /**
+        \brief Counter for vertex buffer arrays whose vertex-array-object (VAO) has been found in the VAO cache.
+        \note Only supported with: OpenGL.
+        \see RenderSystem::CreateBufferArray
+        */
+        Counter vertexArrayCacheHits;
+
+        /**
+        \brief Counter for vertex buffer arrays whose vertex-array-object (VAO) had to be built.
+        \note Only supported with: OpenGL.
+        \see RenderSystem::CreateBufferArray
+        */
+        Counter vertexArrayCacheMisses;
 
         Counter setVertexBuffer;        //!< Counter for vertex buffer bindings. \see CommandBuffer::SetVertexBuffer
         Counter setIndexBuffer;         //!< Counter for index buffer bindings. \see CommandBuffer::SetIndexBuffer
@@ -100,6 +117,10 @@ class LLGL_EXPORT RenderingProfiler
         \see CommandBuffer.DrawIndexed
         \see CommandBuffer.DrawInstanced
         \see CommandBuffer.DrawIndexedInstanced
+        \see CommandBuffer.MultiDraw
+        \see CommandBuffer.MultiDrawIndexed
+        \remarks Each command of a multi-draw or multi-draw-indirect call is counted as a draw call.
+        Indirect draw calls are not recorded in the primitive counters, since their arguments are only known to the GPU.
         */
         Counter drawCalls;
         Counter dispatchComputeCalls;   //!< Counter for dispatch compute calls. \see CommandBuffer::Dispatch
@@ -0,0 +1,94 @@
+/*
+ * StreamingBuffer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_STREAMING_BUFFER_H__
+#define __LLGL_STREAMING_BUFFER_H__
+
+
+#include "Export.h"
+#include "Buffer.h"
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+//! Streaming buffer descriptor structure.
+struct StreamingBufferDescriptor
+{
+    /**
+    \brief Size (in bytes) of the ring partition for a single frame. By default 0.
+    \remarks This is the maximal amount of data (including the alignment padding) that can be written into the streaming buffer per frame.
+    */
+    std::size_t     size        = 0;
+
+    /**
+    \brief Number of frames the CPU may be ahead of the GPU. This must be greater than 0. By default 3.
+    \remarks This is the number of partitions of the ring buffer.
+    */
+    unsigned int    numFrames   = 3;
+};
+
+
+/**
+\brief Streaming buffer interface for per-frame dynamic constant buffer data.
+\remarks A streaming buffer is a single constant buffer which is partitioned into one region per frame in flight (i.e. a ring buffer).
+Each call to RenderSystem::WriteStreamingBuffer appends the data to the region of the current frame,
+and returns the offset at which the data can be bound with CommandBuffer::SetConstantBufferRange.
+The CPU never writes into a region that is still in use by the GPU, so no implicit synchronization
+or driver copies are required, as opposed to many small updates with RenderSystem::WriteBuffer.
+Here is an example of how to use a streaming buffer:
+\code
+LLGL::StreamingBufferDescriptor streamingBufferDesc;
+streamingBufferDesc.size = 65536;
+
+auto streamingBuffer = renderer->CreateStreamingBuffer(streamingBufferDesc);
+
+// Per frame:
+for (const auto& object : objects)
+{
+    auto offset = renderer->WriteStreamingBuffer(*streamingBuffer, &(object.constants), sizeof(object.constants));
+    commands->SetConstantBufferRange(streamingBuffer->GetBuffer(), 0, offset, sizeof(object.constants));
+    commands->Draw(object.numVertices, 0);
+}
+
+renderer->AdvanceStreamingBuffer(*streamingBuffer);
+\endcode
+\see RenderSystem::CreateStreamingBuffer
+*/
+class LLGL_EXPORT StreamingBuffer
+{
+
+    public:
+
+        StreamingBuffer(const StreamingBuffer&) = delete;
+        StreamingBuffer& operator = (const StreamingBuffer&) = delete;
+
+        virtual ~StreamingBuffer();
+
+        /**
+        \brief Returns the constant buffer of this streaming buffer.
+        \remarks This buffer must only be bound with CommandBuffer::SetConstantBufferRange and must not be written or mapped directly.
+        */
+        virtual Buffer& GetBuffer() = 0;
+
+    protected:
+
+        StreamingBuffer() = default;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
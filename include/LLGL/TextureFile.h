@@ -0,0 +1,167 @@
+/*
+ * TextureFile.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_TEXTURE_FILE_H__
+#define __LLGL_TEXTURE_FILE_H__
+
+
+#include "Export.h"
+#include "Image.h"
+#include "TextureFlags.h"
+#include <Gauss/Vector3.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class MappedFile;
+
+
+/* ----- Enumerations ----- */
+
+//! Texture container file formats.
+enum class TextureFileFormat
+{
+    DDS, //!< DirectDraw Surface (with or without the DX10 header extension).
+    KTX, //!< Khronos Texture (version 1.1).
+};
+
+
+/* ----- Classes ----- */
+
+/**
+\brief Texture container file which is memory-mapped for reading.
+\remarks The texture file is mapped into memory and all image descriptors point directly into this mapping,
+i.e. the image data is neither decoded nor copied before it is passed to RenderSystem::CreateTexture or RenderSystem::WriteTexture.
+The operating system only pages in the image data that is actually read.
+Supported formats are S3TC (DXT1, DXT3, DXT5) compressed formats, and uncompressed 8-bit, 16-bit floating-point, and 32-bit floating-point color formats.
+Here is an example of how to upload an entire MIP-map chain:
+\code
+LLGL::TextureFile textureFile("Texture.dds");
+
+auto texture = renderer->CreateTexture(textureFile.GetTextureDescriptor());
+
+for (unsigned int mipLevel = 0; mipLevel < textureFile.GetNumMipLevels(); ++mipLevel)
+{
+    for (unsigned int layer = 0; layer < textureFile.GetNumLayers(); ++layer)
+    {
+        renderer->WriteTexture(
+            *texture,
+            textureFile.GetSubTextureDescriptor(mipLevel, layer),
+            textureFile.GetImageDescriptor(mipLevel, layer)
+        );
+    }
+}
+\endcode
+\note The texture file must not be destroyed while any of its image descriptors is in use.
+*/
+class LLGL_EXPORT TextureFile
+{
+
+    public:
+
+        /**
+        \brief Maps the specified DDS or KTX file into memory and parses the header.
+        \remarks The file format is determined by the file content, not by the file extension.
+        \throw std::runtime_error If the file could not be opened, if the file format is not supported, or if the file is corrupted.
+        */
+        TextureFile(const std::string& filename);
+
+        ~TextureFile();
+
+        TextureFile(const TextureFile&) = delete;
+        TextureFile& operator = (const TextureFile&) = delete;
+
+        /**
+        \brief Returns the image descriptor for the specified MIP-map level and array layer.
+        \param[in] mipLevel Specifies the MIP-map level, where 0 is the base level.
+        \param[in] layer Specifies the array layer. For cube textures this is the cube face (in the order of AxisDirection),
+        and for cube array textures this is "arrayIndex * 6 + cubeFace". For 3D textures this must be 0, and the image contains all slices.
+        \return Image descriptor whose buffer points directly into the memory-mapped file.
+        \throw std::out_of_range If 'mipLevel' or 'layer' is out of range.
+        */
+        ImageDescriptor GetImageDescriptor(unsigned int mipLevel, unsigned int layer = 0) const;
+
+        /**
+        \brief Returns the sub-texture descriptor to write the image of the specified MIP-map level and array layer.
+        \see GetImageDescriptor
+        \throw std::out_of_range If 'mipLevel' or 'layer' is out of range.
+        */
+        SubTextureDescriptor GetSubTextureDescriptor(unsigned int mipLevel, unsigned int layer = 0) const;
+
+        //! Returns the container file format.
+        inline TextureFileFormat GetFileFormat() const
+        {
+            return fileFormat_;
+        }
+
+        //! Returns the texture descriptor with type, format, size of the base MIP-map level, and number of MIP-map levels.
+        inline const TextureDescriptor& GetTextureDescriptor() const
+        {
+            return textureDesc_;
+        }
+
+        //! Returns the number of MIP-map levels stored in the file (at least 1).
+        inline unsigned int GetNumMipLevels() const
+        {
+            return numMipLevels_;
+        }
+
+        //! Returns the number of array layers, including all cube faces (at least 1).
+        inline unsigned int GetNumLayers() const
+        {
+            return numLayers_;
+        }
+
+    private:
+
+        // Location of a single image (MIP-map level of an array layer) within the mapped file.
+        struct SubImage
+        {
+            std::size_t offset;
+            std::size_t size;
+        };
+
+        void LoadDDS();
+        void LoadKTX();
+
+        void SetupTexture(unsigned int width, unsigned int height, unsigned int depth, unsigned int arraySize, bool isCubeMap, unsigned int numMipLevels);
+        void SetSubImage(unsigned int mipLevel, unsigned int layer, std::size_t offset, std::size_t size);
+
+        Gs::Vector3ui GetMipLevelSize(unsigned int mipLevel) const;
+        std::size_t GetSubImageSize(unsigned int mipLevel) const;
+
+        const SubImage& GetSubImage(unsigned int mipLevel, unsigned int layer) const;
+
+        std::unique_ptr<MappedFile> file_;
+        TextureFileFormat           fileFormat_     = TextureFileFormat::DDS;
+
+        TextureDescriptor           textureDesc_;
+        Gs::Vector3ui               size_;
+        ImageFormat                 imageFormat_    = ImageFormat::RGBA;
+        DataType                    dataType_       = DataType::UInt8;
+        unsigned int                numMipLevels_   = 1;
+        unsigned int                numLayers_      = 1;
+        unsigned int                rowAlignment_   = 1;    // Row alignment (in bytes) of uncompressed images
+
+        std::vector<SubImage>       subImages_;     // MIP-map levels of each layer (in the order of mipLevel * numLayers + layer)
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
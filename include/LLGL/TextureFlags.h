@@ -162,6 +162,7 @@ struct LLGL_EXPORT TextureDescriptor
     {
         type                        = TextureType::Texture1D;
         format                      = TextureFormat::RGBA;
+        mipLevels                   = 1;
         texture2DMS.width           = 0;
         texture2DMS.height          = 0;
         texture2DMS.layers          = 0;
@@ -175,6 +176,15 @@ struct LLGL_EXPORT TextureDescriptor
     TextureType                 type;           //!< Texture type. By default TextureType::Texture1D.
     TextureFormat               format;         //!< Texture hardware format. By default TextureFormat::RGBA.
 
+    /**
+    \brief Number of MIP-map levels which are allocated for the texture. By default 1.
+    \remarks If this is 0, the full MIP-map chain is allocated (see NumMipLevels), which requires about a third more memory.
+    Larger values are clamped to the full MIP-map chain.
+    Multi-sampled textures always have a single MIP-map level. RenderSystem::GenerateMips only generates the allocated MIP-map levels.
+    \see NumMipLevels(const TextureDescriptor&)
+    */
+    unsigned int                mipLevels;
+
     union
     {
         Texture1DDescriptor     texture1D;      //!< Descriptor for 1D- and 1D-Array textures.
@@ -256,6 +266,39 @@ struct LLGL_EXPORT SubTextureDescriptor
     };
 };
 
+/**
+\brief Texture location structure.
+\remarks This is used to specify the source and destination of a texture copy operation.
+\see CommandBuffer::CopyTextureRegion
+*/
+struct LLGL_EXPORT TextureLocation
+{
+    TextureLocation() = default;
+
+    TextureLocation(unsigned int mipLevel, unsigned int layer, const Gs::Vector3ui& offset) :
+        mipLevel( mipLevel ),
+        layer   ( layer    ),
+        offset  ( offset   )
+    {
+    }
+
+    //! MIP-map level, where 0 is the base texture, and n > 0 is the n-th MIP-map level.
+    unsigned int    mipLevel    = 0;
+
+    /**
+    \brief Zero-based array layer.
+    \remarks For cube textures this is the cube face (in the order of AxisDirection),
+    and for cube array textures this is "arrayIndex * 6 + cubeFace". For non-array 1D, 2D, and 3D textures this must be 0.
+    */
+    unsigned int    layer       = 0;
+
+    /**
+    \brief Texel offset within the MIP-map level.
+    \remarks The Y component is only used for 2D, cube, and 3D textures, and the Z component is only used for 3D textures.
+    */
+    Gs::Vector3ui   offset;
+};
+
 
 /* ----- Functions ----- */
 
@@ -269,6 +312,15 @@ struct LLGL_EXPORT SubTextureDescriptor
 */
 LLGL_EXPORT unsigned int NumMipLevels(unsigned int width, unsigned int height = 1, unsigned int depth = 1);
 
+/**
+\brief Returns the number of MIP-map levels which are allocated for a texture with the specified descriptor.
+\remarks This takes the texture type (e.g. array layers do not affect the MIP-map chain) and the 'mipLevels' member into account.
+\return The full MIP-map chain for the texture size if 'textureDesc.mipLevels' is 0,
+otherwise the minimum of 'textureDesc.mipLevels' and the full MIP-map chain. Multi-sampled textures always have 1 MIP-map level.
+\see TextureDescriptor::mipLevels
+*/
+LLGL_EXPORT unsigned int NumMipLevels(const TextureDescriptor& textureDesc);
+
 /**
 \brief Returns true if the specified texture format is a compressed format,
 i.e. either TextureFormat::RGB_DXT1, TextureFormat::RGBA_DXT1, TextureFormat::RGBA_DXT3, or TextureFormat::RGBA_DXT5.
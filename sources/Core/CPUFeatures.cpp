@@ -0,0 +1,103 @@
+/*
+ * CPUFeatures.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CPUFeatures.h"
+
+#if defined(LLGL_ARCH_X86)
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#       include <immintrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
+
+namespace LLGL
+{
+
+
+#ifdef LLGL_ARCH_X86
+
+// Queries the CPUID registers EAX, EBX, ECX, and EDX for the specified leaf and sub-leaf.
+static void QueryCPUID(unsigned int leaf, unsigned int subLeaf, unsigned int (&regs)[4])
+{
+    #ifdef _MSC_VER
+    int info[4] = { 0 };
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subLeaf));
+    for (int i = 0; i < 4; ++i)
+        regs[i] = static_cast<unsigned int>(info[i]);
+    #else
+    __cpuid_count(leaf, subLeaf, regs[0], regs[1], regs[2], regs[3]);
+    #endif
+}
+
+// Returns the lower 32 bits of the extended control register XCR0.
+static unsigned int QueryXCR0()
+{
+    #ifdef _MSC_VER
+    return static_cast<unsigned int>(_xgetbv(0));
+    #else
+    unsigned int eax = 0, edx = 0;
+    __asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return eax;
+    #endif
+}
+
+static CPUFeatures DetectCPUFeatures()
+{
+    CPUFeatures features;
+
+    unsigned int regs[4] = { 0 };
+    QueryCPUID(0, 0, regs);
+    auto maxLeaf = regs[0];
+
+    if (maxLeaf >= 1)
+    {
+        QueryCPUID(1, 0, regs);
+
+        features.hasSSE2    = ((regs[3] & (1u << 26)) != 0);
+        features.hasSSSE3   = ((regs[2] & (1u <<  9)) != 0);
+
+        /* AVX requires the OS to save the YMM registers (OSXSAVE flag and XCR0 bits 1 and 2) */
+        bool hasOSXSAVE     = ((regs[2] & (1u << 27)) != 0);
+        bool hasAVX         = ((regs[2] & (1u << 28)) != 0 && hasOSXSAVE && (QueryXCR0() & 0x6) == 0x6);
+
+        features.hasF16C    = (hasAVX && (regs[2] & (1u << 29)) != 0);
+
+        if (hasAVX && maxLeaf >= 7)
+        {
+            QueryCPUID(7, 0, regs);
+            features.hasAVX2 = ((regs[1] & (1u << 5)) != 0);
+        }
+    }
+
+    return features;
+}
+
+#else
+
+static CPUFeatures DetectCPUFeatures()
+{
+    /* No SIMD kernels available for this architecture */
+    return CPUFeatures();
+}
+
+#endif
+
+const CPUFeatures& GetCPUFeatures()
+{
+    static const CPUFeatures features = DetectCPUFeatures();
+    return features;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,58 @@
+/*
+ * CPUFeatures.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_CPU_FEATURES_H__
+#define __LLGL_CPU_FEATURES_H__
+
+
+namespace LLGL
+{
+
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#   define LLGL_ARCH_X86
+#endif
+
+/*
+Enables the instruction set for a single function, so that SIMD kernels can be compiled
+without raising the instruction set of the entire library. Such functions must only be
+called after the respective feature has been detected with "GetCPUFeatures".
+*/
+#if defined(LLGL_ARCH_X86) && (defined(__GNUC__) || defined(__clang__))
+#   define LLGL_TARGET_SSE2     __attribute__((target("sse2")))
+#   define LLGL_TARGET_SSSE3    __attribute__((target("ssse3")))
+#   define LLGL_TARGET_AVX2     __attribute__((target("avx2")))
+#   define LLGL_TARGET_F16C     __attribute__((target("f16c")))
+#else
+#   define LLGL_TARGET_SSE2
+#   define LLGL_TARGET_SSSE3
+#   define LLGL_TARGET_AVX2
+#   define LLGL_TARGET_F16C
+#endif
+
+
+//! CPU instruction set features structure.
+struct CPUFeatures
+{
+    bool hasSSE2    = false; //!< Specifies whether SSE2 instructions are supported.
+    bool hasSSSE3   = false; //!< Specifies whether SSSE3 instructions are supported.
+    bool hasAVX2    = false; //!< Specifies whether AVX2 instructions are supported (including OS support for the YMM registers).
+    bool hasF16C    = false; //!< Specifies whether F16C (half-precision conversion) instructions are supported.
+};
+
+//! Returns the instruction set features of the host CPU. The features are only detected once.
+const CPUFeatures& GetCPUFeatures();
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,224 @@
+/*
+ * ColorSpace.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ColorSpace.h"
+#include "CPUFeatures.h"
+#include <algorithm>
+#include <cmath>
+
+#ifdef LLGL_ARCH_X86
+#   include <immintrin.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/* ----- Lookup tables ----- */
+
+// Number of entries in the lookup table for linear to sRGB conversion (12-bit quantization of the linear input)
+static const std::size_t linearToSRGBTableSize = 4096;
+
+struct SRGBTables
+{
+    SRGBTables();
+
+    /*
+    The first 256 entries convert sRGB to linear, the second 256 entries only normalize (for alpha components).
+    Both halves are in one array so that a single gather instruction can serve color and alpha components.
+    */
+    float           srgbToLinear[256 * 2];
+
+    // Stored as 32-bit integers to be accessed with gather instructions
+    std::int32_t    linearToSRGB[linearToSRGBTableSize];
+};
+
+SRGBTables::SRGBTables()
+{
+    for (int i = 0; i < 256; ++i)
+    {
+        srgbToLinear[i]         = SRGBToLinear(static_cast<float>(static_cast<double>(i) / 255.0));
+        srgbToLinear[i + 256]   = static_cast<float>(static_cast<double>(i) / 255.0);
+    }
+
+    for (std::size_t i = 0; i < linearToSRGBTableSize; ++i)
+    {
+        auto value = LinearToSRGB(static_cast<float>(i) / static_cast<float>(linearToSRGBTableSize - 1));
+        linearToSRGB[i] = static_cast<std::int32_t>(value * 255.0f + 0.5f);
+    }
+}
+
+static const SRGBTables& GetSRGBTables()
+{
+    static const SRGBTables tables;
+    return tables;
+}
+
+// Returns the index into the linear to sRGB lookup table (input is clamped to [0, 1]).
+static int GetLinearToSRGBTableIndex(float value)
+{
+    value = std::max(0.0f, std::min(value, 1.0f));
+    return static_cast<int>(value * static_cast<float>(linearToSRGBTableSize - 1) + 0.5f);
+}
+
+// Quantizes the specified alpha component to 8 bits (clamped to [0, 1] and truncated, same as the regular data type conversion).
+static std::uint8_t QuantizeAlphaUInt8(float value)
+{
+    auto normValue = std::max(0.0, std::min(static_cast<double>(value), 1.0));
+    return static_cast<std::uint8_t>(normValue * 255.0);
+}
+
+
+/* ----- Scalar conversion ----- */
+
+float SRGBToLinear(float value)
+{
+    if (value <= 0.04045f)
+        return value / 12.92f;
+    else
+        return std::pow((value + 0.055f) / 1.055f, 2.4f);
+}
+
+float LinearToSRGB(float value)
+{
+    if (value <= 0.0031308f)
+        return value * 12.92f;
+    else
+        return 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+}
+
+static std::uint8_t LinearToSRGBUInt8Table(const SRGBTables& tables, float value)
+{
+    return static_cast<std::uint8_t>(tables.linearToSRGB[GetLinearToSRGBTableIndex(value)]);
+}
+
+float SRGBToLinearUInt8(std::uint8_t value)
+{
+    return GetSRGBTables().srgbToLinear[value];
+}
+
+std::uint8_t LinearToSRGBUInt8(float value)
+{
+    return LinearToSRGBUInt8Table(GetSRGBTables(), value);
+}
+
+static void ConvertSRGBUInt8ToLinearFloatScalar(const std::uint8_t* src, float* dst, std::size_t begin, std::size_t end, bool hasAlpha)
+{
+    const auto& tables = GetSRGBTables();
+
+    for (auto i = begin; i < end; ++i)
+    {
+        auto offset = (hasAlpha && (i & 3) == 3 ? 256 : 0);
+        dst[i] = tables.srgbToLinear[src[i] + offset];
+    }
+}
+
+static void ConvertLinearFloatToSRGBUInt8Scalar(const float* src, std::uint8_t* dst, std::size_t begin, std::size_t end, bool hasAlpha)
+{
+    const auto& tables = GetSRGBTables();
+
+    for (auto i = begin; i < end; ++i)
+    {
+        if (hasAlpha && (i & 3) == 3)
+            dst[i] = QuantizeAlphaUInt8(src[i]);
+        else
+            dst[i] = LinearToSRGBUInt8Table(tables, src[i]);
+    }
+}
+
+
+/* ----- AVX2 conversion ----- */
+
+#ifdef LLGL_ARCH_X86
+
+LLGL_TARGET_AVX2
+static std::size_t ConvertSRGBUInt8ToLinearFloatAVX2(const std::uint8_t* src, float* dst, std::size_t count, bool hasAlpha)
+{
+    /* Alpha components (lanes 3 and 7) read from the second half of the table */
+    const __m256i offset = (hasAlpha ? _mm256_setr_epi32(0, 0, 0, 256, 0, 0, 0, 256) : _mm256_setzero_si256());
+
+    const auto& tables = GetSRGBTables();
+
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i idx = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        idx = _mm256_add_epi32(idx, offset);
+        _mm256_storeu_ps(dst + i, _mm256_i32gather_ps(tables.srgbToLinear, idx, 4));
+    }
+
+    return i;
+}
+
+LLGL_TARGET_AVX2
+static std::size_t ConvertLinearFloatToSRGBUInt8AVX2(const float* src, std::uint8_t* dst, std::size_t count, bool hasAlpha)
+{
+    const __m256 zero   = _mm256_setzero_ps();
+    const __m256 one    = _mm256_set1_ps(1.0f);
+    const __m256 scale  = _mm256_set1_ps(static_cast<float>(linearToSRGBTableSize - 1));
+    const __m256 half   = _mm256_set1_ps(0.5f);
+
+    const auto& tables = GetSRGBTables();
+
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        /* Clamp to [0, 1] (this also maps NaN to 0) and compute table indices */
+        __m256 v = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src + i), zero), one);
+        __m256i idx = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(v, scale), half));
+
+        /* Gather 8 values and pack them to 8-bit */
+        __m256i values = _mm256_i32gather_epi32(tables.linearToSRGB, idx, 4);
+        __m128i packed = _mm_packus_epi32(_mm256_castsi256_si128(values), _mm256_extracti128_si256(values, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(packed, packed));
+
+        /* Alpha components are only quantized */
+        if (hasAlpha)
+        {
+            dst[i + 3] = QuantizeAlphaUInt8(src[i + 3]);
+            dst[i + 7] = QuantizeAlphaUInt8(src[i + 7]);
+        }
+    }
+
+    return i;
+}
+
+#endif // /LLGL_ARCH_X86
+
+void ConvertSRGBUInt8ToLinearFloat(const std::uint8_t* src, float* dst, std::size_t count, bool hasAlpha)
+{
+    std::size_t i = 0;
+
+    #ifdef LLGL_ARCH_X86
+    if (GetCPUFeatures().hasAVX2)
+        i = ConvertSRGBUInt8ToLinearFloatAVX2(src, dst, count, hasAlpha);
+    #endif
+
+    ConvertSRGBUInt8ToLinearFloatScalar(src, dst, i, count, hasAlpha);
+}
+
+void ConvertLinearFloatToSRGBUInt8(const float* src, std::uint8_t* dst, std::size_t count, bool hasAlpha)
+{
+    std::size_t i = 0;
+
+    #ifdef LLGL_ARCH_X86
+    if (GetCPUFeatures().hasAVX2)
+        i = ConvertLinearFloatToSRGBUInt8AVX2(src, dst, count, hasAlpha);
+    #endif
+
+    ConvertLinearFloatToSRGBUInt8Scalar(src, dst, i, count, hasAlpha);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,54 @@
+/*
+ * ColorSpace.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_COLOR_SPACE_H__
+#define __LLGL_COLOR_SPACE_H__
+
+
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+//! Converts the specified sRGB color component into linear color space (exact transfer function).
+float SRGBToLinear(float value);
+
+//! Converts the specified linear color component into sRGB color space (exact transfer function).
+float LinearToSRGB(float value);
+
+//! Converts the specified 8-bit sRGB color component into linear color space (256-entry lookup table).
+float SRGBToLinearUInt8(std::uint8_t value);
+
+//! Converts the specified linear color component into an 8-bit sRGB color component (4096-entry lookup table).
+std::uint8_t LinearToSRGBUInt8(float value);
+
+/**
+\brief Converts 8-bit sRGB color components into linear floating-point color components.
+\param[in] hasAlpha Specifies whether every 4th component is an alpha component, which is only normalized.
+\remarks This uses AVX2 gather instructions on the lookup table if the host CPU supports them.
+*/
+void ConvertSRGBUInt8ToLinearFloat(const std::uint8_t* src, float* dst, std::size_t count, bool hasAlpha);
+
+/**
+\brief Converts linear floating-point color components into 8-bit sRGB color components.
+\param[in] hasAlpha Specifies whether every 4th component is an alpha component, which is only quantized.
+\remarks This uses AVX2 gather instructions on the lookup table if the host CPU supports them.
+*/
+void ConvertLinearFloatToSRGBUInt8(const float* src, std::uint8_t* dst, std::size_t count, bool hasAlpha);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
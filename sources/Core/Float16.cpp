@@ -0,0 +1,226 @@
+/*
+ * Float16.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Float16.h"
+#include "CPUFeatures.h"
+#include <cstring>
+
+#ifdef LLGL_ARCH_X86
+#   include <immintrin.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/* ----- Lookup tables ----- */
+
+/*
+Lookup tables for the conversion from 16-bit to 32-bit floating-points,
+see "Fast Half Float Conversions" by Jeroen van der Zijp (2008).
+The 32-bit result is: mantissaTable[offsetTable[h >> 10] + (h & 0x3FF)] + exponentTable[h >> 10]
+*/
+struct Float16Tables
+{
+    Float16Tables();
+
+    std::uint32_t   mantissaTable[2048];
+    std::uint32_t   exponentTable[64];
+    std::uint16_t   offsetTable[64];
+};
+
+// Normalizes the specified denormalized mantissa and returns the 32-bit floating-point bit pattern.
+static std::uint32_t ConvertFloat16Mantissa(std::uint32_t i)
+{
+    std::uint32_t m = (i << 13);
+    std::uint32_t e = 0;
+
+    while ((m & 0x00800000u) == 0)
+    {
+        e -= 0x00800000u;
+        m <<= 1;
+    }
+
+    m &= ~0x00800000u;
+    e += 0x38800000u;
+
+    return (m | e);
+}
+
+Float16Tables::Float16Tables()
+{
+    /* Initialize mantissa table */
+    mantissaTable[0] = 0;
+
+    for (std::uint32_t i = 1; i < 1024; ++i)
+        mantissaTable[i] = ConvertFloat16Mantissa(i);
+    for (std::uint32_t i = 1024; i < 2048; ++i)
+        mantissaTable[i] = 0x38000000u + ((i - 1024) << 13);
+
+    /* Initialize exponent table */
+    exponentTable[0]    = 0;
+    exponentTable[31]   = 0x47800000u;
+    exponentTable[32]   = 0x80000000u;
+    exponentTable[63]   = 0xC7800000u;
+
+    for (std::uint32_t i = 1; i < 31; ++i)
+        exponentTable[i] = (i << 23);
+    for (std::uint32_t i = 33; i < 63; ++i)
+        exponentTable[i] = 0x80000000u + ((i - 32) << 23);
+
+    /* Initialize offset table */
+    for (std::uint32_t i = 0; i < 64; ++i)
+        offsetTable[i] = ((i == 0 || i == 32) ? 0 : 1024);
+}
+
+static const Float16Tables& GetFloat16Tables()
+{
+    static const Float16Tables tables;
+    return tables;
+}
+
+
+/* ----- Scalar conversion ----- */
+
+static float Float16ToFloat32Table(const Float16Tables& tables, std::uint16_t value)
+{
+    auto exp = (value >> 10);
+    std::uint32_t bits = tables.mantissaTable[tables.offsetTable[exp] + (value & 0x3FF)] + tables.exponentTable[exp];
+
+    float result;
+    ::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+float Float16ToFloat32(std::uint16_t value)
+{
+    return Float16ToFloat32Table(GetFloat16Tables(), value);
+}
+
+std::uint16_t Float32ToFloat16(float value)
+{
+    std::uint32_t bits;
+    ::memcpy(&bits, &value, sizeof(bits));
+
+    std::uint32_t sign = (bits >> 16) & 0x8000u;
+    std::uint32_t absBits = (bits & 0x7FFFFFFFu);
+
+    if (absBits >= 0x7F800000u)
+    {
+        /* Infinity or NaN (keep NaN quiet) */
+        return static_cast<std::uint16_t>(sign | 0x7C00u | (absBits > 0x7F800000u ? 0x0200u | ((absBits >> 13) & 0x03FFu) : 0u));
+    }
+
+    if (absBits >= 0x477FF000u)
+    {
+        /* Overflow to infinity (value rounds to at least 65520) */
+        return static_cast<std::uint16_t>(sign | 0x7C00u);
+    }
+
+    if (absBits < 0x38800000u)
+    {
+        /* Denormalized half or zero: shift mantissa with implicit leading one and round to nearest even */
+        if (absBits < 0x33000000u)
+            return static_cast<std::uint16_t>(sign);
+
+        std::uint32_t exp   = (absBits >> 23);
+        std::uint32_t mant  = (absBits & 0x007FFFFFu) | 0x00800000u;
+        std::uint32_t shift = 126u - exp;
+        std::uint32_t half  = (mant >> shift);
+        std::uint32_t rem   = mant & ((1u << shift) - 1u);
+        std::uint32_t mid   = (1u << (shift - 1u));
+
+        if (rem > mid || (rem == mid && (half & 1u) != 0))
+            ++half;
+
+        return static_cast<std::uint16_t>(sign | half);
+    }
+
+    /* Normalized half: rebias exponent and round to nearest even */
+    std::uint32_t half = ((absBits - 0x38000000u) >> 13);
+    std::uint32_t rem  = (absBits & 0x1FFFu);
+
+    if (rem > 0x1000u || (rem == 0x1000u && (half & 1u) != 0))
+        ++half;
+
+    return static_cast<std::uint16_t>(sign | half);
+}
+
+
+/* ----- Bulk conversion ----- */
+
+#ifdef LLGL_ARCH_X86
+
+LLGL_TARGET_F16C
+static void ConvertFloat16ToFloat32F16C(const std::uint16_t* src, float* dst, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+
+    const auto& tables = GetFloat16Tables();
+    for (; i < count; ++i)
+        dst[i] = Float16ToFloat32Table(tables, src[i]);
+}
+
+LLGL_TARGET_F16C
+static void ConvertFloat32ToFloat16F16C(const float* src, std::uint16_t* dst, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 f = _mm256_loadu_ps(src + i);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    for (; i < count; ++i)
+        dst[i] = Float32ToFloat16(src[i]);
+}
+
+#endif // /LLGL_ARCH_X86
+
+void ConvertFloat16ToFloat32(const std::uint16_t* src, float* dst, std::size_t count)
+{
+    #ifdef LLGL_ARCH_X86
+    if (GetCPUFeatures().hasF16C)
+    {
+        ConvertFloat16ToFloat32F16C(src, dst, count);
+        return;
+    }
+    #endif
+
+    const auto& tables = GetFloat16Tables();
+    for (std::size_t i = 0; i < count; ++i)
+        dst[i] = Float16ToFloat32Table(tables, src[i]);
+}
+
+void ConvertFloat32ToFloat16(const float* src, std::uint16_t* dst, std::size_t count)
+{
+    #ifdef LLGL_ARCH_X86
+    if (GetCPUFeatures().hasF16C)
+    {
+        ConvertFloat32ToFloat16F16C(src, dst, count);
+        return;
+    }
+    #endif
+
+    for (std::size_t i = 0; i < count; ++i)
+        dst[i] = Float32ToFloat16(src[i]);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,46 @@
+/*
+ * Float16.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_FLOAT16_H__
+#define __LLGL_FLOAT16_H__
+
+
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+//! Converts the specified 16-bit floating-point value (IEEE 754 half precision) into a 32-bit floating-point value.
+float Float16ToFloat32(std::uint16_t value);
+
+//! Converts the specified 32-bit floating-point value into a 16-bit floating-point value (rounded to nearest even).
+std::uint16_t Float32ToFloat16(float value);
+
+/**
+\brief Converts the specified number of 16-bit floating-point values into 32-bit floating-point values.
+\remarks This uses F16C instructions if the host CPU supports them, otherwise a lookup table is used.
+*/
+void ConvertFloat16ToFloat32(const std::uint16_t* src, float* dst, std::size_t count);
+
+/**
+\brief Converts the specified number of 32-bit floating-point values into 16-bit floating-point values.
+\remarks This uses F16C instructions if the host CPU supports them.
+*/
+void ConvertFloat32ToFloat16(const float* src, std::uint16_t* dst, std::size_t count);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -145,6 +145,13 @@ std::string ToHex(T value)
     return s.str();
 }
 
+//! Returns the specified size rounded up to the next multiple of the specified alignment (which must be greater than zero).
+template <typename T>
+T GetAlignedSize(T size, T alignment)
+{
+    return ((size + alignment - 1) / alignment) * alignment;
+}
+
 /**
 \brief Returns the next resource from the specified resource array.
 \param[in,out] numResources Specifies the remaining number of resources in the array.
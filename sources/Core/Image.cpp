@@ -11,7 +11,13 @@
 #include <algorithm>
 #include <cstdint>
 #include <thread>
+#include <type_traits>
+#include <cstring>
 #include "../Renderer/Assertion.h"
+#include "ImageFormatKernels.h"
+#include "ImageThreadPool.h"
+#include "Float16.h"
+#include "ColorSpace.h"
 
 
 namespace LLGL
@@ -81,159 +87,318 @@ using VariantColor = ColorRGBAT<Variant>;
 
 /* ----- Internal functions ----- */
 
-// Reads the specified source variant and returns it to the normalized range [0, 1].
+// Returns the size of the unsigned normalized range of the integral type T, i.e. (2^bits - 1).
 template <typename T>
-double ReadNormalizedVariant(const T& src)
+constexpr std::uint32_t UNormRange()
 {
-    auto min = static_cast<double>(std::numeric_limits<T>::min());
-    auto max = static_cast<double>(std::numeric_limits<T>::max());
-    return (static_cast<double>(src) - min) / (max - min);
+    return static_cast<std::uint32_t>((std::uint64_t(1) << (sizeof(T)*8)) - 1);
 }
 
-// Writes the specified value from the range [0, 1] to the destination variant.
+// Returns the specified integral value as offset to its minimum, i.e. in the range [0, 2^bits - 1].
 template <typename T>
-void WriteNormalizedVariant(T& dst, double value)
+std::uint32_t ToUNorm(T value)
 {
-    auto min = static_cast<double>(std::numeric_limits<T>::min());
-    auto max = static_cast<double>(std::numeric_limits<T>::max());
-    dst = static_cast<T>(value * (max - min) + min);
+    return static_cast<std::uint32_t>(value) - static_cast<std::uint32_t>(std::numeric_limits<T>::min());
 }
 
-static double ReadNormalizedTypedVariant(DataType srcDataType, const VariantConstBuffer& srcBuffer, std::size_t idx)
+// Returns the integral value from the specified offset to its minimum (inverse of "ToUNorm").
+template <typename T>
+T FromUNorm(std::uint32_t value)
+{
+    return static_cast<T>(value + static_cast<std::uint32_t>(std::numeric_limits<T>::min()));
+}
+
+/*
+Converts a single element from TSrc to TDst. Integral types are mapped linearly to the normalized range [0, 1],
+floating-point types are passed through. The specialization is selected at compile time.
+*/
+template <
+    typename TSrc,
+    typename TDst,
+    bool IsSrcIntegral = std::is_integral<TSrc>::value,
+    bool IsDstIntegral = std::is_integral<TDst>::value
+>
+struct DataTypeConverter;
+
+// Integral to integral: exact conversion without floating-point round trip.
+template <typename TSrc, typename TDst>
+struct DataTypeConverter<TSrc, TDst, true, true>
 {
-    switch (srcDataType)
+    static TDst Convert(TSrc value)
     {
-        case DataType::Int8:
-            return ReadNormalizedVariant(srcBuffer.int8[idx]);
-        case DataType::UInt8:
-            return ReadNormalizedVariant(srcBuffer.uint8[idx]);
-        case DataType::Int16:
-            return ReadNormalizedVariant(srcBuffer.int16[idx]);
-        case DataType::UInt16:
-            return ReadNormalizedVariant(srcBuffer.uint16[idx]);
-        case DataType::Int32:
-            return ReadNormalizedVariant(srcBuffer.int32[idx]);
-        case DataType::UInt32:
-            return ReadNormalizedVariant(srcBuffer.uint32[idx]);
-        case DataType::Float:
-            return static_cast<double>(srcBuffer.real32[idx]);
-        case DataType::Double:
-            return srcBuffer.real64[idx];
+        /*
+        All integral ranges are of the form (2^bits - 1) with bits in { 8, 16, 32 },
+        so the smaller range always divides the larger one without remainder (e.g. 65535 = 255 * 257).
+        */
+        return (sizeof(TDst) >= sizeof(TSrc)
+            ? FromUNorm<TDst>(ToUNorm(value) * (UNormRange<TDst>() / UNormRange<TSrc>()))
+            : FromUNorm<TDst>(ToUNorm(value) / (UNormRange<TSrc>() / UNormRange<TDst>()))
+        );
     }
-    return 0.0;
-}
+};
 
-static void WriteNormalizedTypedVariant(DataType dstDataType, VariantBuffer& dstBuffer, std::size_t idx, double value)
+// Integral to floating-point.
+template <typename TSrc, typename TDst>
+struct DataTypeConverter<TSrc, TDst, true, false>
 {
-    switch (dstDataType)
+    static TDst Convert(TSrc value)
     {
-        case DataType::Int8:
-            WriteNormalizedVariant(dstBuffer.int8[idx], value);
-            break;
-        case DataType::UInt8:
-            WriteNormalizedVariant(dstBuffer.uint8[idx], value);
-            break;
-        case DataType::Int16:
-            WriteNormalizedVariant(dstBuffer.int16[idx], value);
-            break;
-        case DataType::UInt16:
-            WriteNormalizedVariant(dstBuffer.uint16[idx], value);
-            break;
-        case DataType::Int32:
-            WriteNormalizedVariant(dstBuffer.int32[idx], value);
-            break;
-        case DataType::UInt32:
-            WriteNormalizedVariant(dstBuffer.uint32[idx], value);
-            break;
-        case DataType::Float:
-            dstBuffer.real32[idx] = static_cast<float>(value);
-            break;
-        case DataType::Double:
-            dstBuffer.real64[idx] = value;
-            break;
+        return static_cast<TDst>(static_cast<double>(ToUNorm(value)) / static_cast<double>(UNormRange<TSrc>()));
     }
-}
+};
+
+// Floating-point to integral (input is clamped to the range [0, 1]).
+template <typename TSrc, typename TDst>
+struct DataTypeConverter<TSrc, TDst, false, true>
+{
+    static TDst Convert(TSrc value)
+    {
+        auto normValue = std::max(0.0, std::min(static_cast<double>(value), 1.0));
+        return FromUNorm<TDst>(static_cast<std::uint32_t>(normValue * static_cast<double>(UNormRange<TDst>())));
+    }
+};
+
+// Floating-point to floating-point.
+template <typename TSrc, typename TDst>
+struct DataTypeConverter<TSrc, TDst, false, false>
+{
+    static TDst Convert(TSrc value)
+    {
+        return static_cast<TDst>(value);
+    }
+};
+
+// 16-bit floating-point storage type (DataType::Float16), converted through 32-bit floating-points.
+struct Half
+{
+    std::uint16_t bits;
+};
+
+template <typename TDst>
+struct DataTypeConverter<Half, TDst, false, true>
+{
+    static TDst Convert(Half value)
+    {
+        return DataTypeConverter<float, TDst>::Convert(Float16ToFloat32(value.bits));
+    }
+};
+
+template <typename TDst>
+struct DataTypeConverter<Half, TDst, false, false>
+{
+    static TDst Convert(Half value)
+    {
+        return DataTypeConverter<float, TDst>::Convert(Float16ToFloat32(value.bits));
+    }
+};
+
+template <typename TSrc>
+struct DataTypeConverter<TSrc, Half, true, false>
+{
+    static Half Convert(TSrc value)
+    {
+        return Half { Float32ToFloat16(DataTypeConverter<TSrc, float>::Convert(value)) };
+    }
+};
+
+template <typename TSrc>
+struct DataTypeConverter<TSrc, Half, false, false>
+{
+    static Half Convert(TSrc value)
+    {
+        return Half { Float32ToFloat16(DataTypeConverter<TSrc, float>::Convert(value)) };
+    }
+};
+
+template <>
+struct DataTypeConverter<Half, Half, false, false>
+{
+    static Half Convert(Half value)
+    {
+        return value;
+    }
+};
 
 static ByteBuffer AllocByteArray(std::size_t size)
 {
     return ByteBuffer(new char[size]);
 }
 
-// Worker thread procedure for the "ConvertImageBufferDataType" function
-static void ConvertImageBufferDataTypeWorker(
-    DataType srcDataType, const VariantConstBuffer& srcBuffer,
-    DataType dstDataType, VariantBuffer& dstBuffer,
-    std::size_t idxBegin, std::size_t idxEnd)
+// Kernel procedure for the "ConvertImageBufferDataType" function
+using DataTypeConversionKernel = void (*)(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd);
+
+template <typename TSrc, typename TDst>
+void ConvertImageBufferDataTypeKernel(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
 {
-    double value = 0.0;
-    
+    auto src = reinterpret_cast<const TSrc*>(srcBuffer);
+    auto dst = reinterpret_cast<TDst*>(dstBuffer);
+
     for (auto i = idxBegin; i < idxEnd; ++i)
-    {
-        /* Read normalized variant from source buffer */
-        value = ReadNormalizedTypedVariant(srcDataType, srcBuffer, i);
-        
-        /* Write normalized variant to destination buffer */
-        WriteNormalizedTypedVariant(dstDataType, dstBuffer, i, value);
+        dst[i] = DataTypeConverter<TSrc, TDst>::Convert(src[i]);
+}
+
+#define LLGL_DATA_TYPE_KERNEL_ROW(KERNEL, TSRC)  \
+    {                                           \
+        KERNEL< TSRC, std::int8_t   >,          \
+        KERNEL< TSRC, std::uint8_t  >,          \
+        KERNEL< TSRC, std::int16_t  >,          \
+        KERNEL< TSRC, std::uint16_t >,          \
+        KERNEL< TSRC, std::int32_t  >,          \
+        KERNEL< TSRC, std::uint32_t >,          \
+        KERNEL< TSRC, float         >,          \
+        KERNEL< TSRC, double        >,          \
+        KERNEL< TSRC, Half          >,          \
+    }
+
+#define LLGL_DATA_TYPE_KERNEL_TABLE(KERNEL)                 \
+    {                                                       \
+        LLGL_DATA_TYPE_KERNEL_ROW( KERNEL, std::int8_t   ), \
+        LLGL_DATA_TYPE_KERNEL_ROW( KERNEL, std::uint8_t  ), \
+        LLGL_DATA_TYPE_KERNEL_ROW( KERNEL, std::int16_t  ), \
+        LLGL_DATA_TYPE_KERNEL_ROW( KERNEL, std::uint16_t ), \
+        LLGL_DATA_TYPE_KERNEL_ROW( KERNEL, std::int32_t  ), \
+        LLGL_DATA_TYPE_KERNEL_ROW( KERNEL, std::uint32_t ), \
+        LLGL_DATA_TYPE_KERNEL_ROW( KERNEL, float         ), \
+        LLGL_DATA_TYPE_KERNEL_ROW( KERNEL, double        ), \
+        LLGL_DATA_TYPE_KERNEL_ROW( KERNEL, Half          ), \
     }
+
+// Number of entries in the "DataType" enumeration
+static const std::size_t numDataTypes = (static_cast<std::size_t>(DataType::Float16) + 1);
+
+// Conversion kernels for each combination of source and destination data type (in order of the "DataType" enumeration)
+static const DataTypeConversionKernel g_dataTypeConversionKernels[numDataTypes][numDataTypes] =
+    LLGL_DATA_TYPE_KERNEL_TABLE(ConvertImageBufferDataTypeKernel);
+
+// Kernels between 16-bit and 32-bit floating-points, which use F16C instructions if available
+static void ConvertImageBufferFloat16ToFloatKernel(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    ConvertFloat16ToFloat32(
+        reinterpret_cast<const std::uint16_t*>(srcBuffer) + idxBegin,
+        reinterpret_cast<float*>(dstBuffer) + idxBegin,
+        idxEnd - idxBegin
+    );
 }
 
-// Minimal number of entries each worker thread shall process
-static const std::size_t threadMinWorkSize = 64;
+static void ConvertImageBufferFloatToFloat16Kernel(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    ConvertFloat32ToFloat16(
+        reinterpret_cast<const float*>(srcBuffer) + idxBegin,
+        reinterpret_cast<std::uint16_t*>(dstBuffer) + idxBegin,
+        idxEnd - idxBegin
+    );
+}
 
-static ByteBuffer ConvertImageBufferDataType(
-    DataType    srcDataType,
-    const void* srcBuffer,
-    std::size_t srcBufferSize,
-    DataType    dstDataType,
-    std::size_t threadCount)
+static DataTypeConversionKernel GetDataTypeConversionKernel(DataType srcDataType, DataType dstDataType)
 {
-    /* Allocate destination buffer */
-    auto imageSize      = srcBufferSize / DataTypeSize(srcDataType);
-    auto dstBufferSize  = imageSize * DataTypeSize(dstDataType);
-    auto dstBuffer      = AllocByteArray(dstBufferSize);
+    if (srcDataType == DataType::Float16 && dstDataType == DataType::Float)
+        return ConvertImageBufferFloat16ToFloatKernel;
+    if (srcDataType == DataType::Float && dstDataType == DataType::Float16)
+        return ConvertImageBufferFloatToFloat16Kernel;
+    return g_dataTypeConversionKernels[static_cast<std::size_t>(srcDataType)][static_cast<std::size_t>(dstDataType)];
+}
 
-    /* Get variant buffer for source and destination images */
-    VariantConstBuffer src(srcBuffer);
-    VariantBuffer dst(dstBuffer.get());
-    
-    threadCount = std::min(threadCount, imageSize / threadMinWorkSize);
+// Reads the specified sRGB component as linear floating-point value.
+template <typename T>
+float DecodeSRGB(T value)
+{
+    return SRGBToLinear(DataTypeConverter<T, float>::Convert(value));
+}
+
+static float DecodeSRGB(std::uint8_t value)
+{
+    return SRGBToLinearUInt8(value);
+}
+
+// Writes the specified linear floating-point value as sRGB component.
+template <typename T>
+T EncodeSRGB(float value)
+{
+    return DataTypeConverter<float, T>::Convert(LinearToSRGB(value));
+}
 
-    if (threadCount > 1)
+template <>
+std::uint8_t EncodeSRGB<std::uint8_t>(float value)
+{
+    return LinearToSRGBUInt8(value);
+}
+
+/*
+Kernel procedure for data type conversions with color space conversion.
+If 'hasAlpha' is true, every 4th component is an alpha component, which is only converted to the destination data type.
+*/
+using ColorSpaceConversionKernel = void (*)(const void* srcBuffer, void* dstBuffer, std::size_t count, bool hasAlpha);
+
+template <typename TSrc, typename TDst>
+void ConvertImageBufferSRGBToLinearKernel(const void* srcBuffer, void* dstBuffer, std::size_t count, bool hasAlpha)
+{
+    auto src = reinterpret_cast<const TSrc*>(srcBuffer);
+    auto dst = reinterpret_cast<TDst*>(dstBuffer);
+
+    for (std::size_t i = 0; i < count; ++i)
     {
-        /* Create worker threads */
-        std::vector<std::thread> workers(threadCount);
-        
-        auto workSize = imageSize / threadCount;
-        auto workSizeRemain = imageSize % threadCount;
-        
-        std::size_t offset = 0;
-        
-        for (std::size_t i = 0; i < threadCount; ++i)
-        {
-            workers[i] = std::thread(
-                ConvertImageBufferDataTypeWorker,
-                srcDataType, std::ref(src),
-                dstDataType, std::ref(dst),
-                offset, offset + workSize
-            );
-            offset += workSize;
-        }
-        
-        /* Execute conversion of remaining work on main thread */
-        if (workSizeRemain > 0)
-            ConvertImageBufferDataTypeWorker(srcDataType, src, dstDataType, dst, offset, offset + workSizeRemain);
-        
-        /* Join worker threads */
-        for (auto& w : workers)
-            w.join();
+        if (hasAlpha && (i & 3) == 3)
+            dst[i] = DataTypeConverter<TSrc, TDst>::Convert(src[i]);
+        else
+            dst[i] = DataTypeConverter<float, TDst>::Convert(DecodeSRGB(src[i]));
     }
-    else
+}
+
+template <typename TSrc, typename TDst>
+void ConvertImageBufferLinearToSRGBKernel(const void* srcBuffer, void* dstBuffer, std::size_t count, bool hasAlpha)
+{
+    auto src = reinterpret_cast<const TSrc*>(srcBuffer);
+    auto dst = reinterpret_cast<TDst*>(dstBuffer);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (hasAlpha && (i & 3) == 3)
+            dst[i] = DataTypeConverter<TSrc, TDst>::Convert(src[i]);
+        else
+            dst[i] = EncodeSRGB<TDst>(DataTypeConverter<TSrc, float>::Convert(src[i]));
+    }
+}
+
+static const ColorSpaceConversionKernel g_srgbToLinearKernels[numDataTypes][numDataTypes] =
+    LLGL_DATA_TYPE_KERNEL_TABLE(ConvertImageBufferSRGBToLinearKernel);
+
+static const ColorSpaceConversionKernel g_linearToSRGBKernels[numDataTypes][numDataTypes] =
+    LLGL_DATA_TYPE_KERNEL_TABLE(ConvertImageBufferLinearToSRGBKernel);
+
+#undef LLGL_DATA_TYPE_KERNEL_ROW
+#undef LLGL_DATA_TYPE_KERNEL_TABLE
+
+// Kernels between 8-bit sRGB and linear 32-bit floating-points, which use AVX2 gather instructions on the lookup tables if available
+static void ConvertImageBufferSRGBUInt8ToLinearFloatKernel(const void* srcBuffer, void* dstBuffer, std::size_t count, bool hasAlpha)
+{
+    ConvertSRGBUInt8ToLinearFloat(reinterpret_cast<const std::uint8_t*>(srcBuffer), reinterpret_cast<float*>(dstBuffer), count, hasAlpha);
+}
+
+static void ConvertImageBufferLinearFloatToSRGBUInt8Kernel(const void* srcBuffer, void* dstBuffer, std::size_t count, bool hasAlpha)
+{
+    ConvertLinearFloatToSRGBUInt8(reinterpret_cast<const float*>(srcBuffer), reinterpret_cast<std::uint8_t*>(dstBuffer), count, hasAlpha);
+}
+
+static ColorSpaceConversionKernel GetColorSpaceConversionKernel(ColorSpaceConversion colorConversion, DataType srcDataType, DataType dstDataType)
+{
+    auto srcIdx = static_cast<std::size_t>(srcDataType);
+    auto dstIdx = static_cast<std::size_t>(dstDataType);
+
+    switch (colorConversion)
     {
-        /* Execute conversion only on main thread */
-        ConvertImageBufferDataTypeWorker(srcDataType, src, dstDataType, dst, 0, imageSize);
+        case ColorSpaceConversion::Disabled:
+            break;
+        case ColorSpaceConversion::SRGBToLinear:
+            if (srcDataType == DataType::UInt8 && dstDataType == DataType::Float)
+                return ConvertImageBufferSRGBUInt8ToLinearFloatKernel;
+            return g_srgbToLinearKernels[srcIdx][dstIdx];
+        case ColorSpaceConversion::LinearToSRGB:
+            if (srcDataType == DataType::Float && dstDataType == DataType::UInt8)
+                return ConvertImageBufferLinearFloatToSRGBUInt8Kernel;
+            return g_linearToSRGBKernels[srcIdx][dstIdx];
     }
 
-    return dstBuffer;
+    return nullptr;
 }
 
 static void SetVariantMinMax(DataType dataType, Variant& var, bool setMin)
@@ -252,6 +417,9 @@ static void SetVariantMinMax(DataType dataType, Variant& var, bool setMin)
         case DataType::UInt16:
             var.uint16 = (setMin ? std::numeric_limits<std::uint16_t>::min() : std::numeric_limits<std::uint16_t>::max());
             break;
+        case DataType::Float16:
+            var.uint16 = (setMin ? 0x0000 : 0x3C00); // 0.0 and 1.0 in half precision
+            break;
         case DataType::Int32:
             var.int32 = (setMin ? std::numeric_limits<std::int32_t>::min() : std::numeric_limits<std::int32_t>::max());
             break;
@@ -281,6 +449,7 @@ static void CopyTypedVariant(DataType dataType, const VariantConstBuffer& srcBuf
             dst.int16 = srcBuffer.int16[idx];
             break;
         case DataType::UInt16:
+        case DataType::Float16:
             dst.uint16 = srcBuffer.uint16[idx];
             break;
         case DataType::Int32:
@@ -312,6 +481,7 @@ static void CopyTypedVariant(DataType dataType, VariantBuffer& dstBuffer, std::s
             dstBuffer.int16[idx] = src.int16;
             break;
         case DataType::UInt16:
+        case DataType::Float16:
             dstBuffer.uint16[idx] = src.uint16;
             break;
         case DataType::Int32:
@@ -409,67 +579,177 @@ static void ConvertImageBufferFormatWorker(
     }
 }
 
-static ByteBuffer ConvertImageBufferFormat(
-    ImageFormat srcFormat,
-    DataType    srcDataType,
-    const void* srcBuffer,
-    std::size_t srcBufferSize,
-    ImageFormat dstFormat,
-    std::size_t threadCount)
+// Number of pixels converted at once when both data type and format are converted (limits the scratch buffer size on the stack)
+static const std::size_t scratchPixelCount = 256;
+
+// State of a single image conversion
+struct ImageConversion
 {
-    /* Allocate destination buffer */
-    auto dataTypeSize   = DataTypeSize(srcDataType);
-    auto srcFormatSize  = ImageFormatSize(srcFormat);
-    auto dstFormatSize  = ImageFormatSize(dstFormat);
+    ImageFormat                 srcFormat;
+    DataType                    srcDataType;
+    const char*                 srcBuffer;
+    std::size_t                 srcRowPitch;
+    std::size_t                 srcPixelSize;
+
+    ImageFormat                 dstFormat;
+    DataType                    dstDataType;
+    char*                       dstBuffer;
+    std::size_t                 dstRowPitch;
+    std::size_t                 dstPixelSize;
+
+    std::size_t                 width;
+    DataTypeConversionKernel    dataTypeKernel;     // Null if the data type is not converted
+    ColorSpaceConversionKernel  colorSpaceKernel;   // Null if the color space is not converted (replaces the data type kernel otherwise)
+    bool                        srcHasAlpha;        // Specifies whether the source format has an alpha component
+    ImageFormatKernel           formatKernel;       // Null if no specialized format kernel is available
+};
 
-    auto imageSize      = srcBufferSize / srcFormatSize;
-    auto dstBufferSize  = imageSize * dstFormatSize;
-    imageSize /= dataTypeSize;
+static void InitImageConversion(
+    ImageConversion&     conv,
+    ImageFormat          srcFormat,
+    DataType             srcDataType,
+    const void*          srcBuffer,
+    std::size_t          srcRowPitch,
+    ImageFormat          dstFormat,
+    DataType             dstDataType,
+    void*                dstBuffer,
+    std::size_t          dstRowPitch,
+    std::size_t          width,
+    ColorSpaceConversion colorConversion)
+{
+    conv.srcFormat      = srcFormat;
+    conv.srcDataType    = srcDataType;
+    conv.srcBuffer      = reinterpret_cast<const char*>(srcBuffer);
+    conv.srcPixelSize   = ImageFormatSize(srcFormat) * DataTypeSize(srcDataType);
+    conv.srcRowPitch    = (srcRowPitch > 0 ? srcRowPitch : width * conv.srcPixelSize);
+
+    conv.dstFormat      = dstFormat;
+    conv.dstDataType    = dstDataType;
+    conv.dstBuffer      = reinterpret_cast<char*>(dstBuffer);
+    conv.dstPixelSize   = ImageFormatSize(dstFormat) * DataTypeSize(dstDataType);
+    conv.dstRowPitch    = (dstRowPitch > 0 ? dstRowPitch : width * conv.dstPixelSize);
+
+    conv.width              = width;
+    conv.colorSpaceKernel   = GetColorSpaceConversionKernel(colorConversion, srcDataType, dstDataType);
+    conv.dataTypeKernel     = (srcDataType != dstDataType && !conv.colorSpaceKernel ? GetDataTypeConversionKernel(srcDataType, dstDataType) : nullptr);
+    conv.srcHasAlpha        = (ImageFormatSize(srcFormat) == 4);
+    conv.formatKernel       = (dstDataType == DataType::UInt8 ? FindImageFormatKernelUInt8(srcFormat, dstFormat) : nullptr);
+}
 
-    auto dstBuffer = AllocByteArray(dstBufferSize);
+// Returns true if the components of the specified image conversion must be converted (data type and/or color space).
+static bool HasImageComponentsConversion(const ImageConversion& conv)
+{
+    return (conv.dataTypeKernel != nullptr || conv.colorSpaceKernel != nullptr);
+}
 
-    /* Get variant buffer for source and destination images */
-    VariantConstBuffer src(srcBuffer);
-    VariantBuffer dst(dstBuffer.get());
+// Converts the data type and color space of the specified number of components (format must be the source format).
+static void ConvertImageComponents(const ImageConversion& conv, const void* src, void* dst, std::size_t numComponents)
+{
+    if (conv.colorSpaceKernel)
+        conv.colorSpaceKernel(src, dst, numComponents, conv.srcHasAlpha);
+    else
+        conv.dataTypeKernel(src, dst, 0, numComponents);
+}
+
+// Converts the image format of the specified number of pixels (data type must already be the destination data type).
+static void ConvertImagePixelsFormat(const ImageConversion& conv, const void* src, void* dst, std::size_t numPixels)
+{
+    if (conv.formatKernel)
+    {
+        /* Use specialized kernel for common 8-bit color formats */
+        conv.formatKernel(src, dst, 0, numPixels);
+    }
+    else
+    {
+        VariantConstBuffer srcVariant(src);
+        VariantBuffer dstVariant(dst);
+        ConvertImageBufferFormatWorker(conv.srcFormat, conv.dstDataType, srcVariant, conv.dstFormat, dstVariant, 0, numPixels);
+    }
+}
 
-    threadCount = std::min(threadCount, imageSize / threadMinWorkSize);
+// Converts the specified number of contiguous pixels from the source to the destination.
+static void ConvertImagePixels(const ImageConversion& conv, const char* src, char* dst, std::size_t numPixels)
+{
+    auto srcComponents = ImageFormatSize(conv.srcFormat);
 
-    if (threadCount > 1)
+    if (conv.srcFormat == conv.dstFormat)
     {
-        /* Create worker threads */
-        std::vector<std::thread> workers(threadCount);
-        
-        auto workSize = imageSize / threadCount;
-        auto workSizeRemain = imageSize % threadCount;
-        
-        std::size_t offset = 0;
-        
-        for (std::size_t i = 0; i < threadCount; ++i)
+        if (HasImageComponentsConversion(conv))
         {
-            workers[i] = std::thread(
-                ConvertImageBufferFormatWorker,
-                srcFormat, srcDataType, std::ref(src),
-                dstFormat, std::ref(dst),
-                offset, offset + workSize
-            );
-            offset += workSize;
+            /* Convert only data type and color space */
+            ConvertImageComponents(conv, src, dst, numPixels * srcComponents);
+        }
+        else
+        {
+            /* Nothing to convert */
+            ::memcpy(dst, src, numPixels * conv.srcPixelSize);
+        }
+    }
+    else if (HasImageComponentsConversion(conv))
+    {
+        /* Convert data type and color space into scratch buffer first, then convert image format into destination */
+        alignas(16) char scratch[scratchPixelCount * 4 * sizeof(double)];
+
+        while (numPixels > 0)
+        {
+            auto n = std::min(numPixels, scratchPixelCount);
+
+            ConvertImageComponents(conv, src, scratch, n * srcComponents);
+            ConvertImagePixelsFormat(conv, scratch, dst, n);
+
+            src += n * conv.srcPixelSize;
+            dst += n * conv.dstPixelSize;
+            numPixels -= n;
         }
-        
-        /* Execute conversion of remaining work on main thread */
-        if (workSizeRemain > 0)
-            ConvertImageBufferFormatWorker(srcFormat, srcDataType, src, dstFormat, dst, offset, offset + workSizeRemain);
-        
-        /* Join worker threads */
-        for (auto& w : workers)
-            w.join();
     }
     else
     {
-        /* Execute conversion only on main thread */
-        ConvertImageBufferFormatWorker(srcFormat, srcDataType, src, dstFormat, dst, 0, imageSize);
+        /* Convert only image format */
+        ConvertImagePixelsFormat(conv, src, dst, numPixels);
+    }
+}
+
+// Converts the pixels in the range [idxBegin, idxEnd), where the pixel indices run row by row through the image.
+static void ConvertImagePixelRange(const ImageConversion& conv, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto row = idxBegin / conv.width;
+    auto col = idxBegin % conv.width;
+
+    while (idxBegin < idxEnd)
+    {
+        auto n = std::min(conv.width - col, idxEnd - idxBegin);
+
+        ConvertImagePixels(
+            conv,
+            conv.srcBuffer + row * conv.srcRowPitch + col * conv.srcPixelSize,
+            conv.dstBuffer + row * conv.dstRowPitch + col * conv.dstPixelSize,
+            n
+        );
+
+        idxBegin += n;
+        col = 0;
+        ++row;
     }
+}
 
-    return dstBuffer;
+static void ConvertImage(const ImageConversion& conv, std::size_t height, std::size_t threadCount)
+{
+    DoConcurrentWork(
+        [&conv](std::size_t idxBegin, std::size_t idxEnd)
+        {
+            ConvertImagePixelRange(conv, idxBegin, idxEnd);
+        },
+        conv.width * height,
+        threadCount
+    );
+}
+
+static void ValidateImageConversionFormats(ImageFormat srcFormat, ImageFormat dstFormat)
+{
+    if (IsCompressedFormat(srcFormat) || IsCompressedFormat(dstFormat))
+        throw std::invalid_argument("can not convert compressed image formats");
+    if (IsDepthStencilFormat(srcFormat) || IsDepthStencilFormat(dstFormat))
+        throw std::invalid_argument("can not convert depth-stencil image formats");
 }
 
 
@@ -480,6 +760,19 @@ unsigned int ImageDescriptor::GetElementSize() const
     return ImageFormatSize(format) * DataTypeSize(dataType);
 }
 
+std::size_t ImageDescriptor::GetRowStride(unsigned int width) const
+{
+    auto rowSize = static_cast<std::size_t>(rowLength > 0 ? rowLength : width) * GetElementSize();
+    if (alignment > 1)
+        rowSize = (rowSize + alignment - 1) / alignment * alignment;
+    return rowSize;
+}
+
+std::size_t ImageDescriptor::GetImageStride(unsigned int width, unsigned int height) const
+{
+    return GetRowStride(width) * (imageHeight > 0 ? imageHeight : height);
+}
+
 
 /* ----- Public functions ----- */
 
@@ -511,6 +804,25 @@ LLGL_EXPORT bool IsDepthStencilFormat(const ImageFormat format)
     return (format == ImageFormat::Depth || format == ImageFormat::DepthStencil);
 }
 
+LLGL_EXPORT ImageThreadPoolStatistics QueryImageThreadPoolStatistics()
+{
+    auto stats = GetImageThreadPool().GetStatistics();
+
+    ImageThreadPoolStatistics result;
+    {
+        result.numWorkerThreads = stats.numWorkerThreads;
+        result.numJobs          = stats.numJobs;
+        result.numChunks        = stats.numChunks;
+        result.numStolenChunks  = stats.numStolenChunks;
+    }
+    return result;
+}
+
+LLGL_EXPORT void ResetImageThreadPoolStatistics()
+{
+    GetImageThreadPool().ResetStatistics();
+}
+
 LLGL_EXPORT ByteBuffer ConvertImageBuffer(
     ImageFormat srcFormat,
     DataType    srcDataType,
@@ -518,43 +830,71 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
     std::size_t srcBufferSize,
     ImageFormat dstFormat,
     DataType    dstDataType,
-    std::size_t threadCount)
+    std::size_t threadCount,
+    ColorSpaceConversion colorConversion)
 {
     /* Validate input parameters */
     LLGL_ASSERT_PTR(srcBuffer);
 
-    if (IsCompressedFormat(srcFormat) || IsCompressedFormat(dstFormat))
-        throw std::invalid_argument("can not convert compressed image formats");
-    if (IsDepthStencilFormat(srcFormat) || IsDepthStencilFormat(dstFormat))
-        throw std::invalid_argument("can not convert depth-stencil image formats");
+    ValidateImageConversionFormats(srcFormat, dstFormat);
+
     if (srcBufferSize % (DataTypeSize(srcDataType) * ImageFormatSize(srcFormat)) != 0)
         throw std::invalid_argument("source buffer size is not a multiple of the source data type size");
 
-    ByteBuffer dstImage;
+    if (srcFormat == dstFormat && srcDataType == dstDataType && colorConversion == ColorSpaceConversion::Disabled)
+        return nullptr;
 
-    if (threadCount == maxThreadCount)
-        threadCount = std::thread::hardware_concurrency();
-    
-    if (srcDataType != dstDataType)
-    {
-        /* Convert image data type */
-        dstImage = ConvertImageBufferDataType(srcDataType, srcBuffer, srcBufferSize, dstDataType, threadCount);
+    /* Allocate destination buffer */
+    auto imageSize      = srcBufferSize / (DataTypeSize(srcDataType) * ImageFormatSize(srcFormat));
+    auto dstBufferSize  = imageSize * DataTypeSize(dstDataType) * ImageFormatSize(dstFormat);
+    auto dstImage       = AllocByteArray(dstBufferSize);
 
-        /* Set new source buffer and source data type */
-        srcBufferSize   = srcBufferSize / DataTypeSize(srcDataType) * DataTypeSize(dstDataType);
-        srcDataType     = dstDataType;
-        srcBuffer       = dstImage.get();
-    }
-
-    if (srcFormat != dstFormat)
-    {
-        /* Convert image format */
-        dstImage = ConvertImageBufferFormat(srcFormat, srcDataType, srcBuffer, srcBufferSize, dstFormat, threadCount);
-    }
+    /* Convert image as single row */
+    ImageConversion conv;
+    InitImageConversion(conv, srcFormat, srcDataType, srcBuffer, 0, dstFormat, dstDataType, dstImage.get(), 0, imageSize, colorConversion);
+    ConvertImage(conv, 1, threadCount);
 
     return dstImage;
 }
 
+LLGL_EXPORT void ConvertImageBuffer(
+    ImageFormat srcFormat,
+    DataType    srcDataType,
+    const void* srcBuffer,
+    std::size_t srcRowPitch,
+    ImageFormat dstFormat,
+    DataType    dstDataType,
+    void*       dstBuffer,
+    std::size_t dstBufferSize,
+    std::size_t dstRowPitch,
+    std::size_t width,
+    std::size_t height,
+    std::size_t threadCount,
+    ColorSpaceConversion colorConversion)
+{
+    /* Validate input parameters */
+    LLGL_ASSERT_PTR(srcBuffer);
+    LLGL_ASSERT_PTR(dstBuffer);
+
+    ValidateImageConversionFormats(srcFormat, dstFormat);
+
+    if (width == 0 || height == 0)
+        return;
+
+    ImageConversion conv;
+    InitImageConversion(conv, srcFormat, srcDataType, srcBuffer, srcRowPitch, dstFormat, dstDataType, dstBuffer, dstRowPitch, width, colorConversion);
+
+    if (conv.srcRowPitch < width * conv.srcPixelSize)
+        throw std::invalid_argument("source row pitch is less than the size of an image row");
+    if (conv.dstRowPitch < width * conv.dstPixelSize)
+        throw std::invalid_argument("destination row pitch is less than the size of an image row");
+    if (dstBufferSize < conv.dstRowPitch * (height - 1) + width * conv.dstPixelSize)
+        throw std::invalid_argument("destination buffer size is too small for the converted image");
+
+    /* Convert image directly into destination buffer */
+    ConvertImage(conv, height, threadCount);
+}
+
 
 } // /namespace LLGL
 
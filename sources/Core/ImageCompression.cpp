@@ -0,0 +1,977 @@
+/*
+ * ImageCompression.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/ImageCompression.h>
+#include "../Renderer/Assertion.h"
+#include "ImageThreadPool.h"
+#include "CPUFeatures.h"
+#include <algorithm>
+#include <stdexcept>
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+#ifdef LLGL_ARCH_X86
+#   include <immintrin.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal structures ----- */
+
+// Block of 4x4 RGBA pixels with 8 bits per component
+struct ColorBlock
+{
+    alignas(16) std::uint8_t rgba[16][4];
+};
+
+// Color components of a block as floating-points (structure of arrays for SIMD)
+struct ColorBlockSoA
+{
+    alignas(16) float r[16];
+    alignas(16) float g[16];
+    alignas(16) float b[16];
+    alignas(16) float weight[16]; // 0 for transparent pixels in DXT1 (their color is irrelevant), 1 otherwise
+};
+
+// Encoded DXT color block
+struct ColorBlockEncoding
+{
+    std::uint16_t   color0  = 0;
+    std::uint16_t   color1  = 0;
+    std::uint32_t   indices = 0;
+    float           error   = std::numeric_limits<float>::max();
+};
+
+// Palette of a DXT color block (up to 4 RGB colors)
+using ColorPalette = int[4][3];
+
+// Alpha values below this threshold are encoded as transparent pixels in DXT1
+static const std::uint8_t dxt1AlphaThreshold = 128;
+
+
+/* ----- Block loading ----- */
+
+// Loads the 4x4 pixel block at the specified block coordinate (border pixels are replicated for partial blocks).
+static void LoadColorBlock(const std::uint8_t* image, unsigned int width, unsigned int height, unsigned int blockX, unsigned int blockY, ColorBlock& block)
+{
+    for (unsigned int y = 0; y < 4; ++y)
+    {
+        auto srcY = std::min(blockY * 4 + y, height - 1);
+        for (unsigned int x = 0; x < 4; ++x)
+        {
+            auto srcX = std::min(blockX * 4 + x, width - 1);
+            ::memcpy(block.rgba[y*4 + x], image + (static_cast<std::size_t>(srcY) * width + srcX) * 4, 4);
+        }
+    }
+}
+
+static bool ToColorBlockSoA(const ColorBlock& block, bool hasTransparency, ColorBlockSoA& soa)
+{
+    bool hasOpaquePixels = false;
+
+    for (int i = 0; i < 16; ++i)
+    {
+        soa.r[i] = static_cast<float>(block.rgba[i][0]);
+        soa.g[i] = static_cast<float>(block.rgba[i][1]);
+        soa.b[i] = static_cast<float>(block.rgba[i][2]);
+
+        if (hasTransparency && block.rgba[i][3] < dxt1AlphaThreshold)
+            soa.weight[i] = 0.0f;
+        else
+        {
+            soa.weight[i] = 1.0f;
+            hasOpaquePixels = true;
+        }
+    }
+
+    return hasOpaquePixels;
+}
+
+
+/* ----- Color conversion ----- */
+
+static std::uint16_t PackRGB565(int r, int g, int b)
+{
+    r = std::max(0, std::min(r, 255));
+    g = std::max(0, std::min(g, 255));
+    b = std::max(0, std::min(b, 255));
+    return static_cast<std::uint16_t>((((r * 31 + 127) / 255) << 11) | (((g * 63 + 127) / 255) << 5) | ((b * 31 + 127) / 255));
+}
+
+static void UnpackRGB565(std::uint16_t color, int (&rgb)[3])
+{
+    auto r = (color >> 11) & 0x1F;
+    auto g = (color >>  5) & 0x3F;
+    auto b = (color      ) & 0x1F;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+// Builds the color palette for the specified end-points (4 colors if color0 > color1, otherwise 3 colors and transparent black).
+static void BuildColorPalette(std::uint16_t color0, std::uint16_t color1, ColorPalette& palette)
+{
+    UnpackRGB565(color0, palette[0]);
+    UnpackRGB565(color1, palette[1]);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        if (color0 > color1)
+        {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+        else
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+    }
+}
+
+
+/* ----- Color index fitting ----- */
+
+// Selects the nearest palette color for each pixel and returns the 2-bit indices. The weighted squared error is added to 'error'.
+static std::uint32_t FitColorIndicesScalar(const ColorBlockSoA& soa, const ColorPalette& palette, int numColors, float& error)
+{
+    std::uint32_t indices = 0;
+
+    for (int i = 0; i < 16; ++i)
+    {
+        float bestDist = std::numeric_limits<float>::max();
+        int bestIndex = 0;
+
+        for (int p = 0; p < numColors; ++p)
+        {
+            auto dr = soa.r[i] - static_cast<float>(palette[p][0]);
+            auto dg = soa.g[i] - static_cast<float>(palette[p][1]);
+            auto db = soa.b[i] - static_cast<float>(palette[p][2]);
+            auto dist = dr*dr + dg*dg + db*db;
+            if (dist < bestDist)
+            {
+                bestDist = dist;
+                bestIndex = p;
+            }
+        }
+
+        error += bestDist * soa.weight[i];
+        indices |= (static_cast<std::uint32_t>(bestIndex) << (i * 2));
+    }
+
+    return indices;
+}
+
+#ifdef LLGL_ARCH_X86
+
+LLGL_TARGET_SSE2
+static std::uint32_t FitColorIndicesSSE2(const ColorBlockSoA& soa, const ColorPalette& palette, int numColors, float& error)
+{
+    std::uint32_t indices = 0;
+    __m128 errorSum = _mm_setzero_ps();
+
+    for (int i = 0; i < 16; i += 4)
+    {
+        __m128 r = _mm_load_ps(soa.r + i);
+        __m128 g = _mm_load_ps(soa.g + i);
+        __m128 b = _mm_load_ps(soa.b + i);
+
+        __m128  bestDist    = _mm_set1_ps(std::numeric_limits<float>::max());
+        __m128i bestIndex   = _mm_setzero_si128();
+
+        for (int p = 0; p < numColors; ++p)
+        {
+            __m128 dr = _mm_sub_ps(r, _mm_set1_ps(static_cast<float>(palette[p][0])));
+            __m128 dg = _mm_sub_ps(g, _mm_set1_ps(static_cast<float>(palette[p][1])));
+            __m128 db = _mm_sub_ps(b, _mm_set1_ps(static_cast<float>(palette[p][2])));
+            __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db));
+
+            /* Select index where the distance is less than the best distance so far */
+            __m128i less = _mm_castps_si128(_mm_cmplt_ps(dist, bestDist));
+            bestIndex = _mm_or_si128(_mm_and_si128(less, _mm_set1_epi32(p)), _mm_andnot_si128(less, bestIndex));
+            bestDist = _mm_min_ps(dist, bestDist);
+        }
+
+        errorSum = _mm_add_ps(errorSum, _mm_mul_ps(bestDist, _mm_load_ps(soa.weight + i)));
+
+        /* Pack 4 indices with 2 bits each */
+        alignas(16) std::int32_t idx[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(idx), bestIndex);
+        indices |= static_cast<std::uint32_t>(idx[0] | (idx[1] << 2) | (idx[2] << 4) | (idx[3] << 6)) << (i * 2);
+    }
+
+    alignas(16) float errors[4];
+    _mm_store_ps(errors, errorSum);
+    error += (errors[0] + errors[1]) + (errors[2] + errors[3]);
+
+    return indices;
+}
+
+#endif // /LLGL_ARCH_X86
+
+static std::uint32_t FitColorIndices(const ColorBlockSoA& soa, const ColorPalette& palette, int numColors, float& error)
+{
+    #ifdef LLGL_ARCH_X86
+    if (GetCPUFeatures().hasSSE2)
+        return FitColorIndicesSSE2(soa, palette, numColors, error);
+    #endif
+    return FitColorIndicesScalar(soa, palette, numColors, error);
+}
+
+/*
+Encodes the color block with the specified end-points and stores the result if its error is less than the current one.
+In 3-color mode, the end-points are ordered with color0 <= color1 and transparent pixels use index 3.
+*/
+static void EncodeColorEndPoints(const ColorBlockSoA& soa, std::uint16_t color0, std::uint16_t color1, bool threeColorMode, ColorBlockEncoding& result)
+{
+    if (threeColorMode ? (color0 > color1) : (color0 < color1))
+        std::swap(color0, color1);
+
+    ColorPalette palette;
+    BuildColorPalette(color0, color1, palette);
+
+    ColorBlockEncoding enc;
+    {
+        enc.color0  = color0;
+        enc.color1  = color1;
+        enc.error   = 0.0f;
+        enc.indices = FitColorIndices(soa, palette, (color0 > color1 ? 4 : 3), enc.error);
+    }
+
+    if (threeColorMode)
+    {
+        for (int i = 0; i < 16; ++i)
+        {
+            if (soa.weight[i] == 0.0f)
+                enc.indices |= (3u << (i * 2));
+        }
+    }
+
+    if (enc.error < result.error)
+        result = enc;
+}
+
+
+/* ----- Color end-point selection ----- */
+
+// Computes the bounding box of the opaque block colors ('allOpaque' specifies whether the block has no transparent pixels).
+static void ComputeColorBoundingBox(const ColorBlock& block, const ColorBlockSoA& soa, bool allOpaque, int (&minColor)[3], int (&maxColor)[3])
+{
+    #ifdef LLGL_ARCH_X86
+    if (allOpaque && GetCPUFeatures().hasSSE2)
+    {
+        /* Reduce the 16 pixels with byte-wise min/max */
+        auto pixels = reinterpret_cast<const __m128i*>(block.rgba);
+
+        __m128i minValue = _mm_min_epu8(_mm_min_epu8(_mm_loadu_si128(pixels), _mm_loadu_si128(pixels + 1)), _mm_min_epu8(_mm_loadu_si128(pixels + 2), _mm_loadu_si128(pixels + 3)));
+        __m128i maxValue = _mm_max_epu8(_mm_max_epu8(_mm_loadu_si128(pixels), _mm_loadu_si128(pixels + 1)), _mm_max_epu8(_mm_loadu_si128(pixels + 2), _mm_loadu_si128(pixels + 3)));
+
+        minValue = _mm_min_epu8(minValue, _mm_srli_si128(minValue, 8));
+        minValue = _mm_min_epu8(minValue, _mm_srli_si128(minValue, 4));
+        maxValue = _mm_max_epu8(maxValue, _mm_srli_si128(maxValue, 8));
+        maxValue = _mm_max_epu8(maxValue, _mm_srli_si128(maxValue, 4));
+
+        auto minRGBA = static_cast<std::uint32_t>(_mm_cvtsi128_si32(minValue));
+        auto maxRGBA = static_cast<std::uint32_t>(_mm_cvtsi128_si32(maxValue));
+
+        for (int c = 0; c < 3; ++c)
+        {
+            minColor[c] = static_cast<int>((minRGBA >> (c * 8)) & 0xFF);
+            maxColor[c] = static_cast<int>((maxRGBA >> (c * 8)) & 0xFF);
+        }
+
+        return;
+    }
+    #endif
+
+    for (int c = 0; c < 3; ++c)
+    {
+        minColor[c] = 255;
+        maxColor[c] = 0;
+    }
+
+    for (int i = 0; i < 16; ++i)
+    {
+        if (soa.weight[i] != 0.0f)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                minColor[c] = std::min(minColor[c], static_cast<int>(block.rgba[i][c]));
+                maxColor[c] = std::max(maxColor[c], static_cast<int>(block.rgba[i][c]));
+            }
+        }
+    }
+}
+
+// Selects the end-points along the principal axis of the opaque block colors.
+static void ComputeColorPrincipalAxisEndPoints(const ColorBlockSoA& soa, int (&color0)[3], int (&color1)[3])
+{
+    /* Compute mean and covariance matrix */
+    float mean[3] = { 0.0f, 0.0f, 0.0f }, count = 0.0f;
+
+    for (int i = 0; i < 16; ++i)
+    {
+        mean[0] += soa.r[i] * soa.weight[i];
+        mean[1] += soa.g[i] * soa.weight[i];
+        mean[2] += soa.b[i] * soa.weight[i];
+        count   += soa.weight[i];
+    }
+
+    for (int c = 0; c < 3; ++c)
+        mean[c] /= count;
+
+    float cov[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+    for (int i = 0; i < 16; ++i)
+    {
+        auto r = (soa.r[i] - mean[0]) * soa.weight[i];
+        auto g = (soa.g[i] - mean[1]) * soa.weight[i];
+        auto b = (soa.b[i] - mean[2]) * soa.weight[i];
+        cov[0] += r*r;
+        cov[1] += r*g;
+        cov[2] += r*b;
+        cov[3] += g*g;
+        cov[4] += g*b;
+        cov[5] += b*b;
+    }
+
+    /* Find principal axis with power iteration */
+    float axis[3] = { 1.0f, 1.0f, 1.0f };
+
+    for (int iteration = 0; iteration < 8; ++iteration)
+    {
+        float x = axis[0]*cov[0] + axis[1]*cov[1] + axis[2]*cov[2];
+        float y = axis[0]*cov[1] + axis[1]*cov[3] + axis[2]*cov[4];
+        float z = axis[0]*cov[2] + axis[1]*cov[4] + axis[2]*cov[5];
+
+        auto len = std::max({ std::abs(x), std::abs(y), std::abs(z) });
+        if (len < 1.0e-6f)
+            break;
+
+        axis[0] = x / len;
+        axis[1] = y / len;
+        axis[2] = z / len;
+    }
+
+    /* Project colors onto principal axis and take the extreme projections */
+    float minProj = std::numeric_limits<float>::max(), maxProj = -std::numeric_limits<float>::max();
+
+    for (int i = 0; i < 16; ++i)
+    {
+        if (soa.weight[i] != 0.0f)
+        {
+            auto proj = (soa.r[i] - mean[0])*axis[0] + (soa.g[i] - mean[1])*axis[1] + (soa.b[i] - mean[2])*axis[2];
+            minProj = std::min(minProj, proj);
+            maxProj = std::max(maxProj, proj);
+        }
+    }
+
+    auto axisLenSq = axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2];
+
+    for (int c = 0; c < 3; ++c)
+    {
+        color0[c] = static_cast<int>(std::lround(mean[c] + axis[c] * maxProj / axisLenSq));
+        color1[c] = static_cast<int>(std::lround(mean[c] + axis[c] * minProj / axisLenSq));
+    }
+}
+
+/*
+Refines the end-points of the specified encoding with a least squares fit for its current indices,
+i.e. minimizes sum_i(|a_i * color0 + b_i * color1 - pixel_i|^2) where (a_i, b_i) are the interpolation weights of each index.
+*/
+static bool RefineColorEndPoints(const ColorBlockSoA& soa, const ColorBlockEncoding& enc, std::uint16_t& color0, std::uint16_t& color1)
+{
+    static const float weights4[4][2] = { { 1.0f, 0.0f }, { 0.0f, 1.0f }, { 2.0f/3.0f, 1.0f/3.0f }, { 1.0f/3.0f, 2.0f/3.0f } };
+    static const float weights3[4][2] = { { 1.0f, 0.0f }, { 0.0f, 1.0f }, { 0.5f, 0.5f }, { 0.0f, 0.0f } };
+
+    const auto& weights = (enc.color0 > enc.color1 ? weights4 : weights3);
+
+    float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+    float ax[3] = { 0.0f, 0.0f, 0.0f }, bx[3] = { 0.0f, 0.0f, 0.0f };
+
+    for (int i = 0; i < 16; ++i)
+    {
+        if (soa.weight[i] == 0.0f)
+            continue;
+
+        auto index  = (enc.indices >> (i * 2)) & 0x3;
+        auto a      = weights[index][0];
+        auto b      = weights[index][1];
+
+        aa += a*a;
+        bb += b*b;
+        ab += a*b;
+
+        ax[0] += a*soa.r[i];
+        ax[1] += a*soa.g[i];
+        ax[2] += a*soa.b[i];
+
+        bx[0] += b*soa.r[i];
+        bx[1] += b*soa.g[i];
+        bx[2] += b*soa.b[i];
+    }
+
+    auto det = aa*bb - ab*ab;
+    if (std::abs(det) < 1.0e-6f)
+        return false;
+
+    int c0[3], c1[3];
+
+    for (int c = 0; c < 3; ++c)
+    {
+        c0[c] = static_cast<int>(std::lround((ax[c]*bb - bx[c]*ab) / det));
+        c1[c] = static_cast<int>(std::lround((bx[c]*aa - ax[c]*ab) / det));
+    }
+
+    color0 = PackRGB565(c0[0], c0[1], c0[2]);
+    color1 = PackRGB565(c1[0], c1[1], c1[2]);
+
+    return true;
+}
+
+
+/* ----- Block encoding ----- */
+
+static void WriteColorBlock(const ColorBlockEncoding& enc, std::uint8_t* dst)
+{
+    dst[0] = static_cast<std::uint8_t>(enc.color0 & 0xFF);
+    dst[1] = static_cast<std::uint8_t>(enc.color0 >> 8);
+    dst[2] = static_cast<std::uint8_t>(enc.color1 & 0xFF);
+    dst[3] = static_cast<std::uint8_t>(enc.color1 >> 8);
+    for (int i = 0; i < 4; ++i)
+        dst[4 + i] = static_cast<std::uint8_t>((enc.indices >> (i * 8)) & 0xFF);
+}
+
+// Encodes the color part of a DXT block (8 bytes). If 'hasTransparency' is true, the 3-color mode is used for blocks with transparent pixels.
+static void EncodeColorBlock(const ColorBlock& block, bool hasTransparency, CompressionQuality quality, std::uint8_t* dst)
+{
+    ColorBlockSoA soa;
+    ColorBlockEncoding enc;
+
+    if (!ToColorBlockSoA(block, hasTransparency, soa))
+    {
+        /* Only transparent pixels */
+        enc.indices = 0xFFFFFFFF;
+        WriteColorBlock(enc, dst);
+        return;
+    }
+
+    bool threeColorMode = (hasTransparency && std::count(soa.weight, soa.weight + 16, 0.0f) > 0);
+
+    /* Encode with the (inset) bounding box of the block colors */
+    int minColor[3], maxColor[3];
+    ComputeColorBoundingBox(block, soa, !threeColorMode, minColor, maxColor);
+
+    for (int c = 0; c < 3; ++c)
+    {
+        auto inset = (maxColor[c] - minColor[c]) / 16;
+        minColor[c] += inset;
+        maxColor[c] -= inset;
+    }
+
+    EncodeColorEndPoints(
+        soa,
+        PackRGB565(maxColor[0], maxColor[1], maxColor[2]),
+        PackRGB565(minColor[0], minColor[1], minColor[2]),
+        threeColorMode,
+        enc
+    );
+
+    if (quality == CompressionQuality::High && enc.error > 0.0f)
+    {
+        /* Encode with the end-points along the principal axis */
+        int color0[3], color1[3];
+        ComputeColorPrincipalAxisEndPoints(soa, color0, color1);
+
+        EncodeColorEndPoints(
+            soa,
+            PackRGB565(color0[0], color0[1], color0[2]),
+            PackRGB565(color1[0], color1[1], color1[2]),
+            threeColorMode,
+            enc
+        );
+
+        /* Refine the best end-points with a least squares fit */
+        for (int iteration = 0; iteration < 2; ++iteration)
+        {
+            std::uint16_t refinedColor0, refinedColor1;
+            if (!RefineColorEndPoints(soa, enc, refinedColor0, refinedColor1))
+                break;
+
+            auto prevError = enc.error;
+            EncodeColorEndPoints(soa, refinedColor0, refinedColor1, threeColorMode, enc);
+
+            if (!(enc.error < prevError))
+                break;
+        }
+    }
+
+    WriteColorBlock(enc, dst);
+}
+
+// Builds the alpha palette of a DXT5 block (8 interpolated values if alpha0 > alpha1, otherwise 6 values plus 0 and 255).
+static void BuildAlphaPalette(int alpha0, int alpha1, int (&palette)[8])
+{
+    palette[0] = alpha0;
+    palette[1] = alpha1;
+
+    if (alpha0 > alpha1)
+    {
+        for (int i = 1; i < 7; ++i)
+            palette[i + 1] = ((7 - i) * alpha0 + i * alpha1) / 7;
+    }
+    else
+    {
+        for (int i = 1; i < 5; ++i)
+            palette[i + 1] = ((5 - i) * alpha0 + i * alpha1) / 5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+// Selects the nearest alpha palette value for each pixel and returns the 3-bit indices (48 bits) and the squared error.
+static std::uint64_t FitAlphaIndices(const ColorBlock& block, int alpha0, int alpha1, int& error)
+{
+    int palette[8];
+    BuildAlphaPalette(alpha0, alpha1, palette);
+
+    std::uint64_t indices = 0;
+    error = 0;
+
+    for (int i = 0; i < 16; ++i)
+    {
+        int alpha = block.rgba[i][3], bestDist = std::numeric_limits<int>::max(), bestIndex = 0;
+
+        for (int p = 0; p < 8; ++p)
+        {
+            auto dist = (alpha - palette[p]) * (alpha - palette[p]);
+            if (dist < bestDist)
+            {
+                bestDist = dist;
+                bestIndex = p;
+            }
+        }
+
+        error += bestDist;
+        indices |= (static_cast<std::uint64_t>(bestIndex) << (i * 3));
+    }
+
+    return indices;
+}
+
+// Encodes the interpolated alpha part of a DXT5 block (8 bytes).
+static void EncodeAlphaBlockDXT5(const ColorBlock& block, CompressionQuality quality, std::uint8_t* dst)
+{
+    int minAlpha = 255, maxAlpha = 0, minInnerAlpha = 255, maxInnerAlpha = 0;
+
+    for (int i = 0; i < 16; ++i)
+    {
+        int alpha = block.rgba[i][3];
+        minAlpha = std::min(minAlpha, alpha);
+        maxAlpha = std::max(maxAlpha, alpha);
+        if (alpha > 0 && alpha < 255)
+        {
+            minInnerAlpha = std::min(minInnerAlpha, alpha);
+            maxInnerAlpha = std::max(maxInnerAlpha, alpha);
+        }
+    }
+
+    /* Encode with 8 interpolated values between the extreme values */
+    int alpha0 = maxAlpha, alpha1 = minAlpha, error = 0;
+    auto indices = FitAlphaIndices(block, alpha0, alpha1, error);
+
+    if (quality == CompressionQuality::High && error > 0 && minInnerAlpha <= maxInnerAlpha)
+    {
+        /* Encode with 6 interpolated values between the inner values, and explicit 0 and 255 */
+        int error6 = 0;
+        auto indices6 = FitAlphaIndices(block, minInnerAlpha, maxInnerAlpha, error6);
+        if (error6 < error)
+        {
+            alpha0  = minInnerAlpha;
+            alpha1  = maxInnerAlpha;
+            indices = indices6;
+        }
+    }
+
+    dst[0] = static_cast<std::uint8_t>(alpha0);
+    dst[1] = static_cast<std::uint8_t>(alpha1);
+    for (int i = 0; i < 6; ++i)
+        dst[2 + i] = static_cast<std::uint8_t>((indices >> (i * 8)) & 0xFF);
+}
+
+// Encodes the explicit alpha part of a DXT3 block (8 bytes with 4 bits per pixel).
+static void EncodeAlphaBlockDXT3(const ColorBlock& block, std::uint8_t* dst)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        auto alpha0 = (block.rgba[i*2    ][3] * 15 + 127) / 255;
+        auto alpha1 = (block.rgba[i*2 + 1][3] * 15 + 127) / 255;
+        dst[i] = static_cast<std::uint8_t>(alpha0 | (alpha1 << 4));
+    }
+}
+
+// Encodes a single 4x4 pixel block into the specified compressed format.
+static void EncodeBlock(const ColorBlock& block, TextureFormat format, CompressionQuality quality, std::uint8_t* dst)
+{
+    switch (format)
+    {
+        case TextureFormat::RGB_DXT1:
+            EncodeColorBlock(block, false, quality, dst);
+            break;
+        case TextureFormat::RGBA_DXT1:
+            EncodeColorBlock(block, true, quality, dst);
+            break;
+        case TextureFormat::RGBA_DXT3:
+            EncodeAlphaBlockDXT3(block, dst);
+            EncodeColorBlock(block, false, quality, dst + 8);
+            break;
+        case TextureFormat::RGBA_DXT5:
+            EncodeAlphaBlockDXT5(block, quality, dst);
+            EncodeColorBlock(block, false, quality, dst + 8);
+            break;
+        default:
+            break;
+    }
+}
+
+// Returns the size (in bytes) of a 4x4 pixel block of the specified compressed format.
+static std::size_t CompressedBlockSize(const TextureFormat format)
+{
+    switch (format)
+    {
+        case TextureFormat::RGB_DXT1:   return 8;
+        case TextureFormat::RGBA_DXT1:  return 8;
+        case TextureFormat::RGBA_DXT3:  return 16;
+        case TextureFormat::RGBA_DXT5:  return 16;
+        default:                        return 0;
+    }
+}
+
+
+/* ----- Block decoding ----- */
+
+// Shuffle masks to select the palette colors for one row of a color block by its 2-bit indices (one mask for each index byte)
+struct ColorIndexShuffleMasks
+{
+    ColorIndexShuffleMasks()
+    {
+        for (int i = 0; i < 256; ++i)
+        {
+            for (int x = 0; x < 4; ++x)
+            {
+                auto index = (i >> (x * 2)) & 0x3;
+                for (int c = 0; c < 4; ++c)
+                    masks[i][x*4 + c] = static_cast<std::int8_t>(index*4 + c);
+            }
+        }
+    }
+
+    alignas(16) std::int8_t masks[256][16];
+};
+
+static const ColorIndexShuffleMasks& GetColorIndexShuffleMasks()
+{
+    static const ColorIndexShuffleMasks shuffleMasks;
+    return shuffleMasks;
+}
+
+// Decodes the RGBA palette of a color block (DXT3 and DXT5 always use the 4-color mode).
+static void DecodeColorPalette(const std::uint8_t* src, TextureFormat format, std::uint8_t (&palette)[4][4])
+{
+    auto color0 = static_cast<std::uint16_t>(src[0] | (src[1] << 8));
+    auto color1 = static_cast<std::uint16_t>(src[2] | (src[3] << 8));
+
+    bool isDXT1 = (format == TextureFormat::RGB_DXT1 || format == TextureFormat::RGBA_DXT1);
+
+    ColorPalette rgb;
+    BuildColorPalette(color0, color1, rgb);
+
+    if (!isDXT1 && color0 <= color1)
+    {
+        /* Interpolate palette in 4-color mode regardless of the order of end-points */
+        for (int c = 0; c < 3; ++c)
+        {
+            rgb[2][c] = (2 * rgb[0][c] + rgb[1][c]) / 3;
+            rgb[3][c] = (rgb[0][c] + 2 * rgb[1][c]) / 3;
+        }
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int c = 0; c < 3; ++c)
+            palette[i][c] = static_cast<std::uint8_t>(rgb[i][c]);
+        palette[i][3] = 255;
+    }
+
+    /* Index 3 is transparent black in the 3-color mode of DXT1 with alpha */
+    if (format == TextureFormat::RGBA_DXT1 && color0 <= color1)
+        palette[3][3] = 0;
+}
+
+static void DecodeColorIndicesScalar(const std::uint8_t* src, const std::uint8_t (&palette)[4][4], ColorBlock& block)
+{
+    for (int i = 0; i < 16; ++i)
+        ::memcpy(block.rgba[i], palette[(src[4 + i/4] >> ((i % 4) * 2)) & 0x3], 4);
+}
+
+#ifdef LLGL_ARCH_X86
+
+// Selects the palette colors for an entire row of 4 pixels with a single byte shuffle.
+LLGL_TARGET_SSSE3
+static void DecodeColorIndicesSSSE3(const std::uint8_t* src, const std::uint8_t (&palette)[4][4], ColorBlock& block)
+{
+    const auto& masks = GetColorIndexShuffleMasks().masks;
+
+    __m128i colors = _mm_loadu_si128(reinterpret_cast<const __m128i*>(palette));
+
+    for (int y = 0; y < 4; ++y)
+    {
+        __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(masks[src[4 + y]]));
+        _mm_store_si128(reinterpret_cast<__m128i*>(block.rgba[y*4]), _mm_shuffle_epi8(colors, mask));
+    }
+}
+
+#endif // /LLGL_ARCH_X86
+
+// Decodes a color block (8 bytes) into the RGBA components of the specified block.
+static void DecodeColorBlock(const std::uint8_t* src, TextureFormat format, ColorBlock& block)
+{
+    std::uint8_t palette[4][4];
+    DecodeColorPalette(src, format, palette);
+
+    #ifdef LLGL_ARCH_X86
+    if (GetCPUFeatures().hasSSSE3)
+    {
+        DecodeColorIndicesSSSE3(src, palette, block);
+        return;
+    }
+    #endif
+
+    DecodeColorIndicesScalar(src, palette, block);
+}
+
+// Decodes the interpolated alpha part of a DXT5 block (8 bytes).
+static void DecodeAlphaBlockDXT5(const std::uint8_t* src, ColorBlock& block)
+{
+    int palette[8];
+    BuildAlphaPalette(src[0], src[1], palette);
+
+    std::uint64_t indices = 0;
+    for (int i = 0; i < 6; ++i)
+        indices |= (static_cast<std::uint64_t>(src[2 + i]) << (i * 8));
+
+    for (int i = 0; i < 16; ++i)
+        block.rgba[i][3] = static_cast<std::uint8_t>(palette[(indices >> (i * 3)) & 0x7]);
+}
+
+// Decodes the explicit alpha part of a DXT3 block (8 bytes with 4 bits per pixel).
+static void DecodeAlphaBlockDXT3(const std::uint8_t* src, ColorBlock& block)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        block.rgba[i*2    ][3] = static_cast<std::uint8_t>((src[i] & 0x0F) * 17);
+        block.rgba[i*2 + 1][3] = static_cast<std::uint8_t>((src[i] >> 4  ) * 17);
+    }
+}
+
+// Decodes a single 4x4 pixel block of the specified compressed format.
+static void DecodeBlock(const std::uint8_t* src, TextureFormat format, ColorBlock& block)
+{
+    switch (format)
+    {
+        case TextureFormat::RGB_DXT1:
+        case TextureFormat::RGBA_DXT1:
+            DecodeColorBlock(src, format, block);
+            break;
+        case TextureFormat::RGBA_DXT3:
+            DecodeColorBlock(src + 8, format, block);
+            DecodeAlphaBlockDXT3(src, block);
+            break;
+        case TextureFormat::RGBA_DXT5:
+            DecodeColorBlock(src + 8, format, block);
+            DecodeAlphaBlockDXT5(src, block);
+            break;
+        default:
+            break;
+    }
+}
+
+// Stores the 4x4 pixel block at the specified block coordinate (pixels outside the image are discarded for partial blocks).
+static void StoreColorBlock(std::uint8_t* image, unsigned int width, unsigned int height, unsigned int blockX, unsigned int blockY, const ColorBlock& block)
+{
+    auto numCols = std::min(4u, width - blockX * 4);
+    auto numRows = std::min(4u, height - blockY * 4);
+
+    for (unsigned int y = 0; y < numRows; ++y)
+    {
+        auto dstRow = image + (static_cast<std::size_t>(blockY * 4 + y) * width + blockX * 4) * 4;
+        ::memcpy(dstRow, block.rgba[y*4], numCols * 4);
+    }
+}
+
+
+/* ----- Public functions ----- */
+
+LLGL_EXPORT std::size_t CompressedImageSize(const TextureFormat format, unsigned int width, unsigned int height)
+{
+    auto numBlocksX = static_cast<std::size_t>((width + 3) / 4);
+    auto numBlocksY = static_cast<std::size_t>((height + 3) / 4);
+    return (numBlocksX * numBlocksY * CompressedBlockSize(format));
+}
+
+LLGL_EXPORT ByteBuffer CompressImageBuffer(
+    ImageFormat                         srcFormat,
+    DataType                            srcDataType,
+    const void*                         srcBuffer,
+    unsigned int                        width,
+    unsigned int                        height,
+    const ImageCompressionDescriptor&   desc)
+{
+    /* Validate input parameters */
+    LLGL_ASSERT_PTR(srcBuffer);
+
+    if (!IsCompressedFormat(desc.format))
+        throw std::invalid_argument("image compression requires a compressed texture format");
+    if (IsCompressedFormat(srcFormat))
+        throw std::invalid_argument("can not compress image with compressed source format");
+    if (IsDepthStencilFormat(srcFormat))
+        throw std::invalid_argument("can not compress image with depth-stencil source format");
+
+    if (width == 0 || height == 0)
+        return nullptr;
+
+    /* Convert source image to RGBA with 8-bit components */
+    ByteBuffer rgbaImage;
+
+    if (srcFormat != ImageFormat::RGBA || srcDataType != DataType::UInt8)
+    {
+        auto rgbaImageSize = static_cast<std::size_t>(width) * height * 4;
+        rgbaImage = ByteBuffer(new char[rgbaImageSize]);
+        ConvertImageBuffer(
+            srcFormat, srcDataType, srcBuffer, 0,
+            ImageFormat::RGBA, DataType::UInt8, rgbaImage.get(), rgbaImageSize, 0,
+            width, height, desc.threadCount
+        );
+        srcBuffer = rgbaImage.get();
+    }
+
+    /* Compress blocks row by row */
+    auto numBlocksX = (width + 3) / 4;
+    auto numBlocksY = (height + 3) / 4;
+    auto blockSize  = CompressedBlockSize(desc.format);
+
+    ByteBuffer dstImage(new char[CompressedImageSize(desc.format, width, height)]);
+
+    auto image  = reinterpret_cast<const std::uint8_t*>(srcBuffer);
+    auto dst    = reinterpret_cast<std::uint8_t*>(dstImage.get());
+
+    DoConcurrentWork(
+        [&](std::size_t idxBegin, std::size_t idxEnd)
+        {
+            ColorBlock block;
+            for (auto blockY = idxBegin; blockY < idxEnd; ++blockY)
+            {
+                auto dstRow = dst + blockY * numBlocksX * blockSize;
+                for (unsigned int blockX = 0; blockX < numBlocksX; ++blockX)
+                {
+                    LoadColorBlock(image, width, height, blockX, static_cast<unsigned int>(blockY), block);
+                    EncodeBlock(block, desc.format, desc.quality, dstRow + blockX * blockSize);
+                }
+            }
+        },
+        numBlocksY,
+        desc.threadCount,
+        std::max(1u, static_cast<unsigned int>(threadMinWorkSize) / numBlocksX)
+    );
+
+    return dstImage;
+}
+
+
+LLGL_EXPORT ByteBuffer DecompressImageBuffer(
+    TextureFormat   srcFormat,
+    const void*     srcBuffer,
+    std::size_t     srcBufferSize,
+    ImageFormat     dstFormat,
+    DataType        dstDataType,
+    unsigned int    width,
+    unsigned int    height,
+    unsigned int    layers,
+    std::size_t     threadCount)
+{
+    /* Validate input parameters */
+    LLGL_ASSERT_PTR(srcBuffer);
+
+    if (!IsCompressedFormat(srcFormat))
+        throw std::invalid_argument("image decompression requires a compressed texture format");
+    if (IsCompressedFormat(dstFormat))
+        throw std::invalid_argument("can not decompress image into compressed destination format");
+    if (IsDepthStencilFormat(dstFormat))
+        throw std::invalid_argument("can not decompress image into depth-stencil destination format");
+
+    auto layerSize = CompressedImageSize(srcFormat, width, height);
+    if (srcBufferSize < layerSize * layers)
+        throw std::invalid_argument("source buffer size is too small for compressed image decompression");
+
+    if (width == 0 || height == 0 || layers == 0)
+        return nullptr;
+
+    /* Decompress blocks row by row (over all layers) into RGBA with 8-bit components */
+    auto numBlocksX = (width + 3) / 4;
+    auto numBlocksY = (height + 3) / 4;
+    auto blockSize  = CompressedBlockSize(srcFormat);
+
+    auto rgbaLayerSize = static_cast<std::size_t>(width) * height * 4;
+    ByteBuffer rgbaImage(new char[rgbaLayerSize * layers]);
+
+    auto src    = reinterpret_cast<const std::uint8_t*>(srcBuffer);
+    auto image  = reinterpret_cast<std::uint8_t*>(rgbaImage.get());
+
+    DoConcurrentWork(
+        [&](std::size_t idxBegin, std::size_t idxEnd)
+        {
+            ColorBlock block;
+            for (auto idx = idxBegin; idx < idxEnd; ++idx)
+            {
+                auto layer  = idx / numBlocksY;
+                auto blockY = static_cast<unsigned int>(idx % numBlocksY);
+                auto srcRow = src + layer * layerSize + blockY * numBlocksX * blockSize;
+                auto dstImg = image + layer * rgbaLayerSize;
+                for (unsigned int blockX = 0; blockX < numBlocksX; ++blockX)
+                {
+                    DecodeBlock(srcRow + blockX * blockSize, srcFormat, block);
+                    StoreColorBlock(dstImg, width, height, blockX, blockY, block);
+                }
+            }
+        },
+        static_cast<std::size_t>(numBlocksY) * layers,
+        threadCount,
+        std::max(1u, static_cast<unsigned int>(threadMinWorkSize) / numBlocksX)
+    );
+
+    /* Convert decompressed image to destination format */
+    if (dstFormat != ImageFormat::RGBA || dstDataType != DataType::UInt8)
+    {
+        return ConvertImageBuffer(
+            ImageFormat::RGBA, DataType::UInt8, rgbaImage.get(), rgbaLayerSize * layers,
+            dstFormat, dstDataType, threadCount
+        );
+    }
+
+    return rgbaImage;
+}
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
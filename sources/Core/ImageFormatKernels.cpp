@@ -0,0 +1,265 @@
+/*
+ * ImageFormatKernels.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ImageFormatKernels.h"
+#include "CPUFeatures.h"
+#include <cstdint>
+
+#ifdef LLGL_ARCH_X86
+#   include <immintrin.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/*
+All kernels in this file convert between the 8-bit unsigned formats RGB, BGR, RGBA, and BGRA.
+They are specialized by the source and destination pixel size (3 or 4 bytes) and
+whether the red and blue channels must be swapped. Missing alpha channels are set to 255.
+*/
+
+/* ----- Scalar kernels ----- */
+
+template <std::size_t SrcSize, std::size_t DstSize, bool SwapRB>
+void ConvertPixelsUInt8Scalar(const std::uint8_t* src, std::uint8_t* dst, std::size_t idxBegin, std::size_t idxEnd)
+{
+    src += idxBegin * SrcSize;
+    dst += idxBegin * DstSize;
+
+    for (auto i = idxBegin; i < idxEnd; ++i, src += SrcSize, dst += DstSize)
+    {
+        dst[0] = src[SwapRB ? 2 : 0];
+        dst[1] = src[1];
+        dst[2] = src[SwapRB ? 0 : 2];
+        if (DstSize == 4)
+            dst[DstSize - 1] = (SrcSize == 4 ? src[SrcSize - 1] : 0xFF);
+    }
+}
+
+template <std::size_t SrcSize, std::size_t DstSize, bool SwapRB>
+void ConvertImageFormatUInt8Scalar(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    ConvertPixelsUInt8Scalar<SrcSize, DstSize, SwapRB>(
+        reinterpret_cast<const std::uint8_t*>(srcBuffer),
+        reinterpret_cast<std::uint8_t*>(dstBuffer),
+        idxBegin,
+        idxEnd
+    );
+}
+
+#ifdef LLGL_ARCH_X86
+
+/*
+Number of pixels each SIMD loop must keep in reserve when the pixel sizes differ,
+because 16 bytes are always read and written for only 12 bytes (4 pixels of 3 bytes) of payload.
+This also keeps all memory accesses within [idxBegin, idxEnd) so worker threads never overlap.
+*/
+template <std::size_t SrcSize, std::size_t DstSize>
+struct PixelHeadroom
+{
+    static const std::size_t value = (SrcSize == 4 && DstSize == 4 ? 0 : 2);
+};
+
+// Builds the byte shuffle mask (for PSHUFB) to convert 4 pixels within a 16-byte vector.
+static void BuildShuffleMask(std::size_t srcSize, std::size_t dstSize, bool swapRB, std::int8_t (&mask)[16])
+{
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        auto pixel      = i / dstSize;
+        auto component  = i % dstSize;
+
+        if (pixel >= 4 || component >= srcSize)
+        {
+            /* Zero out this byte (0x80), alpha is inserted afterwards */
+            mask[i] = -128;
+        }
+        else
+        {
+            if (swapRB && component != 1 && component != 3)
+                component = 2 - component;
+            mask[i] = static_cast<std::int8_t>(pixel * srcSize + component);
+        }
+    }
+}
+
+/* ----- SSE2 kernels ----- */
+
+// Swaps red and blue channels of 4-byte pixels with 32-bit shifts (no byte shuffle instruction in SSE2).
+LLGL_TARGET_SSE2
+static void SwizzleRGBAUInt8SSE2(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = reinterpret_cast<const std::uint8_t*>(srcBuffer);
+    auto dst = reinterpret_cast<std::uint8_t*>(dstBuffer);
+
+    const __m128i maskGA = _mm_set1_epi32(static_cast<int>(0xFF00FF00));
+    const __m128i maskR  = _mm_set1_epi32(0x000000FF);
+
+    auto i = idxBegin;
+
+    for (; i + 4 <= idxEnd; i += 4)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i*4));
+        __m128i r = _mm_slli_epi32(_mm_and_si128(v, maskR), 16);
+        __m128i b = _mm_and_si128(_mm_srli_epi32(v, 16), maskR);
+        v = _mm_or_si128(_mm_and_si128(v, maskGA), _mm_or_si128(r, b));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i*4), v);
+    }
+
+    ConvertPixelsUInt8Scalar<4, 4, true>(src, dst, i, idxEnd);
+}
+
+/* ----- SSSE3 kernels ----- */
+
+template <std::size_t SrcSize, std::size_t DstSize, bool SwapRB>
+LLGL_TARGET_SSSE3
+void ConvertImageFormatUInt8SSSE3(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = reinterpret_cast<const std::uint8_t*>(srcBuffer);
+    auto dst = reinterpret_cast<std::uint8_t*>(dstBuffer);
+
+    std::int8_t maskBytes[16];
+    BuildShuffleMask(SrcSize, DstSize, SwapRB, maskBytes);
+
+    const __m128i mask  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(maskBytes));
+    const __m128i alpha = (SrcSize == 3 && DstSize == 4 ? _mm_set1_epi32(static_cast<int>(0xFF000000)) : _mm_setzero_si128());
+
+    auto i = idxBegin;
+
+    for (; i + 4 + PixelHeadroom<SrcSize, DstSize>::value <= idxEnd; i += 4)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i*SrcSize));
+        v = _mm_or_si128(_mm_shuffle_epi8(v, mask), alpha);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i*DstSize), v);
+    }
+
+    ConvertPixelsUInt8Scalar<SrcSize, DstSize, SwapRB>(src, dst, i, idxEnd);
+}
+
+/* ----- AVX2 kernels ----- */
+
+template <std::size_t SrcSize, std::size_t DstSize, bool SwapRB>
+LLGL_TARGET_AVX2
+void ConvertImageFormatUInt8AVX2(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd)
+{
+    auto src = reinterpret_cast<const std::uint8_t*>(srcBuffer);
+    auto dst = reinterpret_cast<std::uint8_t*>(dstBuffer);
+
+    std::int8_t maskBytes[16];
+    BuildShuffleMask(SrcSize, DstSize, SwapRB, maskBytes);
+
+    /* PSHUFB operates on each 128-bit lane separately, so both lanes use the same mask for 4 pixels each */
+    const __m256i mask  = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(maskBytes)));
+    const __m256i alpha = (SrcSize == 3 && DstSize == 4 ? _mm256_set1_epi32(static_cast<int>(0xFF000000)) : _mm256_setzero_si256());
+
+    auto i = idxBegin;
+
+    for (; i + 8 + PixelHeadroom<SrcSize, DstSize>::value <= idxEnd; i += 8)
+    {
+        /* Load 8 pixels, 4 pixels into each lane */
+        __m256i v;
+        if (SrcSize == 4)
+        {
+            v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i*SrcSize));
+        }
+        else
+        {
+            v = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i*SrcSize))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (i + 4)*SrcSize)),
+                1
+            );
+        }
+
+        v = _mm256_or_si256(_mm256_shuffle_epi8(v, mask), alpha);
+
+        /* Store 8 pixels, the upper lane overwrites the padding of the lower lane */
+        if (DstSize == 4)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i*DstSize), v);
+        }
+        else
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i*DstSize), _mm256_castsi256_si128(v));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (i + 4)*DstSize), _mm256_extracti128_si256(v, 1));
+        }
+    }
+
+    ConvertPixelsUInt8Scalar<SrcSize, DstSize, SwapRB>(src, dst, i, idxEnd);
+}
+
+#endif // /LLGL_ARCH_X86
+
+template <std::size_t SrcSize, std::size_t DstSize, bool SwapRB>
+ImageFormatKernel SelectImageFormatKernelUInt8()
+{
+    #ifdef LLGL_ARCH_X86
+
+    const auto& cpu = GetCPUFeatures();
+
+    if (cpu.hasAVX2)
+        return ConvertImageFormatUInt8AVX2<SrcSize, DstSize, SwapRB>;
+    if (cpu.hasSSSE3)
+        return ConvertImageFormatUInt8SSSE3<SrcSize, DstSize, SwapRB>;
+    if (cpu.hasSSE2 && SrcSize == 4 && DstSize == 4 && SwapRB)
+        return SwizzleRGBAUInt8SSE2;
+
+    #endif
+
+    return ConvertImageFormatUInt8Scalar<SrcSize, DstSize, SwapRB>;
+}
+
+template <bool SwapRB>
+ImageFormatKernel SelectImageFormatKernelUInt8(std::size_t srcSize, std::size_t dstSize)
+{
+    if (srcSize == 3)
+    {
+        if (dstSize == 3)
+            return SelectImageFormatKernelUInt8<3, 3, SwapRB>();
+        else
+            return SelectImageFormatKernelUInt8<3, 4, SwapRB>();
+    }
+    else
+    {
+        if (dstSize == 3)
+            return SelectImageFormatKernelUInt8<4, 3, SwapRB>();
+        else
+            return SelectImageFormatKernelUInt8<4, 4, SwapRB>();
+    }
+}
+
+static bool IsRGBOrBGRFormat(const ImageFormat format)
+{
+    return (format >= ImageFormat::RGB && format <= ImageFormat::BGRA);
+}
+
+static bool IsBGROrderFormat(const ImageFormat format)
+{
+    return (format == ImageFormat::BGR || format == ImageFormat::BGRA);
+}
+
+ImageFormatKernel FindImageFormatKernelUInt8(const ImageFormat srcFormat, const ImageFormat dstFormat)
+{
+    if (srcFormat == dstFormat || !IsRGBOrBGRFormat(srcFormat) || !IsRGBOrBGRFormat(dstFormat))
+        return nullptr;
+
+    auto srcSize = ImageFormatSize(srcFormat);
+    auto dstSize = ImageFormatSize(dstFormat);
+
+    if (IsBGROrderFormat(srcFormat) != IsBGROrderFormat(dstFormat))
+        return SelectImageFormatKernelUInt8<true>(srcSize, dstSize);
+    else
+        return SelectImageFormatKernelUInt8<false>(srcSize, dstSize);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
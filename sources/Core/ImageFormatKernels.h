@@ -0,0 +1,39 @@
+/*
+ * ImageFormatKernels.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_IMAGE_FORMAT_KERNELS_H__
+#define __LLGL_IMAGE_FORMAT_KERNELS_H__
+
+
+#include <LLGL/Image.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+//! Kernel procedure to convert the image elements in the range [idxBegin, idxEnd) from one image format into another.
+using ImageFormatKernel = void (*)(const void* srcBuffer, void* dstBuffer, std::size_t idxBegin, std::size_t idxEnd);
+
+/**
+\brief Returns the fastest available kernel to convert an 8-bit unsigned image between the specified formats.
+\return Function pointer to the kernel, or null if there is no specialized kernel for these formats.
+\remarks Specialized kernels exist for all combinations of RGB, BGR, RGBA, and BGRA.
+The kernel is selected by the instruction set of the host CPU (AVX2, SSSE3, SSE2, or scalar fallback).
+*/
+ImageFormatKernel FindImageFormatKernelUInt8(const ImageFormat srcFormat, const ImageFormat dstFormat);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,156 @@
+/*
+ * ImageStreamConverter.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/ImageStreamConverter.h>
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+ImageStreamConverter::ImageStreamConverter(const ImageStreamConverterDescriptor& desc, const Callback& callback) :
+    desc_       ( desc     ),
+    callback_   ( callback )
+{
+    /* Validate input parameters */
+    if (IsCompressedFormat(desc.srcFormat) || IsCompressedFormat(desc.dstFormat))
+        throw std::invalid_argument("can not convert compressed image formats");
+    if (IsDepthStencilFormat(desc.srcFormat) || IsDepthStencilFormat(desc.dstFormat))
+        throw std::invalid_argument("can not convert depth-stencil image formats");
+    if (desc.width == 0)
+        throw std::invalid_argument("image stream converter requires a width greater than zero");
+    if (!callback)
+        throw std::invalid_argument("image stream converter requires a valid callback");
+
+    srcPixelSize_ = ImageFormatSize(desc.srcFormat) * DataTypeSize(desc.srcDataType);
+    dstPixelSize_ = ImageFormatSize(desc.dstFormat) * DataTypeSize(desc.dstDataType);
+
+    /* Allocate scratch buffer for at least one destination row */
+    scratchSize_    = std::max(desc.scratchBufferSize, desc.width * dstPixelSize_);
+    scratch_        = ByteBuffer(new char[scratchSize_]);
+}
+
+void ImageStreamConverter::WriteRows(const void* srcBuffer, std::size_t numRows, std::size_t srcRowPitch)
+{
+    if (!srcBuffer)
+        throw std::invalid_argument("null pointer passed to image stream converter");
+
+    if (srcRowPitch == 0)
+        srcRowPitch = desc_.width * srcPixelSize_;
+
+    auto src        = reinterpret_cast<const char*>(srcBuffer);
+    auto maxRows    = GetMaxRows(desc_.width);
+
+    while (numRows > 0)
+    {
+        /* Convert as many rows as fit into the scratch buffer */
+        auto n = std::min(numRows, maxRows - pendingRows_);
+
+        ConvertRows(src, srcRowPitch, desc_.width, n, pendingRows_ * desc_.width * dstPixelSize_);
+
+        pendingRows_    += n;
+        numRows         -= n;
+        src             += n * srcRowPitch;
+
+        /* Pass rows to callback if the scratch buffer is full */
+        if (pendingRows_ == maxRows)
+            Flush();
+    }
+}
+
+void ImageStreamConverter::WriteTile(const void* srcBuffer, const ImageStreamRegion& region, std::size_t srcRowPitch)
+{
+    if (!srcBuffer)
+        throw std::invalid_argument("null pointer passed to image stream converter");
+    if (region.width == 0 || region.height == 0)
+        return;
+
+    Flush();
+
+    if (srcRowPitch == 0)
+        srcRowPitch = region.width * srcPixelSize_;
+
+    auto src        = reinterpret_cast<const char*>(srcBuffer);
+    auto maxRows    = GetMaxRows(region.width);
+
+    ImageStreamRegion slice = region;
+
+    for (std::size_t row = 0; row < region.height; row += slice.height)
+    {
+        /* Convert next slice of the tile and pass it to the callback */
+        slice.y         = region.y + row;
+        slice.height    = std::min(region.height - row, maxRows);
+
+        ConvertRows(src + row * srcRowPitch, srcRowPitch, slice.width, slice.height, 0);
+
+        callback_(slice, scratch_.get(), slice.width * slice.height * dstPixelSize_);
+    }
+}
+
+void ImageStreamConverter::Flush()
+{
+    if (pendingRows_ > 0)
+    {
+        ImageStreamRegion region;
+        {
+            region.x        = 0;
+            region.y        = nextRow_;
+            region.width    = desc_.width;
+            region.height   = pendingRows_;
+        }
+
+        nextRow_        += pendingRows_;
+        pendingRows_    = 0;
+
+        callback_(region, scratch_.get(), region.width * region.height * dstPixelSize_);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+// Returns the number of rows with the specified width that fit into the scratch buffer.
+std::size_t ImageStreamConverter::GetMaxRows(std::size_t width) const
+{
+    auto dstRowSize = width * dstPixelSize_;
+
+    if (dstRowSize > scratchSize_)
+        throw std::invalid_argument("image row exceeds the size of the image stream converter scratch buffer");
+
+    return (scratchSize_ / dstRowSize);
+}
+
+void ImageStreamConverter::ConvertRows(
+    const void* srcBuffer, std::size_t srcRowPitch, std::size_t width, std::size_t numRows, std::size_t dstOffset)
+{
+    ConvertImageBuffer(
+        desc_.srcFormat,
+        desc_.srcDataType,
+        srcBuffer,
+        srcRowPitch,
+        desc_.dstFormat,
+        desc_.dstDataType,
+        scratch_.get() + dstOffset,
+        scratchSize_ - dstOffset,
+        width * dstPixelSize_,
+        width,
+        numRows,
+        desc_.threadCount,
+        desc_.colorConversion
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,47 @@
+/*
+ * ImageThreadPool.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ImageThreadPool.h"
+#include <LLGL/RenderSystemFlags.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+ThreadPool& GetImageThreadPool()
+{
+    static ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1u);
+    return pool;
+}
+
+void DoConcurrentWork(const ThreadPool::Task& task, std::size_t count, std::size_t threadCount, std::size_t minWorkSize)
+{
+    if (threadCount == maxThreadCount)
+        threadCount = std::thread::hardware_concurrency();
+
+    threadCount = std::min(threadCount, count / std::max(std::size_t(1), minWorkSize));
+
+    if (threadCount > 1)
+    {
+        /* Execute work on worker threads */
+        GetImageThreadPool().ParallelFor(count, threadCount, minWorkSize, task);
+    }
+    else
+    {
+        /* Execute work only on main thread */
+        task(0, count);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
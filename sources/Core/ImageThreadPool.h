@@ -0,0 +1,40 @@
+/*
+ * ImageThreadPool.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_IMAGE_THREAD_POOL_H__
+#define __LLGL_IMAGE_THREAD_POOL_H__
+
+
+#include "ThreadPool.h"
+
+
+namespace LLGL
+{
+
+
+// Minimal number of entries each worker thread shall process by default
+static const std::size_t threadMinWorkSize = 64;
+
+// Returns the worker thread pool for image processing (the caller is one of the participating threads).
+ThreadPool& GetImageThreadPool();
+
+/*
+Runs the specified task for the entries in the range [0, count) and distributes the work over the specified number of threads.
+The task is called with sub ranges [idxBegin, idxEnd) on the threads of the image thread pool.
+If 'threadCount' is 'maxThreadCount', the number of threads the system supports is used.
+*/
+void DoConcurrentWork(const ThreadPool::Task& task, std::size_t count, std::size_t threadCount, std::size_t minWorkSize = threadMinWorkSize);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,533 @@
+/*
+ * MipmapChain.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/MipmapChain.h>
+#include "../Renderer/Assertion.h"
+#include "ImageThreadPool.h"
+#include "CPUFeatures.h"
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+#include <cstring>
+
+#ifdef LLGL_ARCH_X86
+#   include <immintrin.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/* ----- Filter functions ----- */
+
+static const double pi = 3.14159265358979323846;
+
+// Radius (in destination pixels) of the windowed sinc filters
+static const double sincFilterRadius = 3.0;
+
+// Alpha parameter of the Kaiser window
+static const double kaiserAlpha = 4.0;
+
+static double Sinc(double x)
+{
+    if (std::abs(x) < 1.0e-6)
+        return 1.0;
+    x *= pi;
+    return std::sin(x) / x;
+}
+
+// Returns the zeroth order modified Bessel function of the first kind (power series).
+static double BesselI0(double x)
+{
+    double sum = 1.0, term = 1.0, halfX = x * 0.5;
+    for (int k = 1; k < 32 && term > sum * 1.0e-12; ++k)
+    {
+        term *= (halfX / k) * (halfX / k);
+        sum += term;
+    }
+    return sum;
+}
+
+static double KaiserFilter(double x)
+{
+    auto t = x / sincFilterRadius;
+    if (t <= -1.0 || t >= 1.0)
+        return 0.0;
+    return Sinc(x) * BesselI0(kaiserAlpha * std::sqrt(1.0 - t*t)) / BesselI0(kaiserAlpha);
+}
+
+static double LanczosFilter(double x)
+{
+    if (x <= -sincFilterRadius || x >= sincFilterRadius)
+        return 0.0;
+    return Sinc(x) * Sinc(x / sincFilterRadius);
+}
+
+
+/* ----- Filter weights ----- */
+
+// Contribution of the source pixels [first, first + count) to a single destination pixel
+struct FilterContribution
+{
+    std::size_t first;
+    std::size_t count;
+    std::size_t weightOffset;
+};
+
+// Filter weights for downsampling along a single axis (equal for all rows or columns)
+struct FilterWeights
+{
+    std::vector<FilterContribution> contributions;
+    std::vector<float>              weights;
+};
+
+static void AddFilterContribution(FilterWeights& filterWeights, std::vector<double>& weights, std::size_t first)
+{
+    /* Trim zero weights at both ends */
+    std::size_t begin = 0, end = weights.size();
+
+    while (begin + 1 < end && weights[begin] == 0.0)
+        ++begin;
+    while (end > begin + 1 && weights[end - 1] == 0.0)
+        --end;
+
+    /* Normalize weights */
+    double sum = 0.0;
+    for (auto i = begin; i < end; ++i)
+        sum += weights[i];
+
+    filterWeights.contributions.push_back({ first + begin, end - begin, filterWeights.weights.size() });
+
+    for (auto i = begin; i < end; ++i)
+        filterWeights.weights.push_back(static_cast<float>(sum != 0.0 ? weights[i] / sum : 1.0 / (end - begin)));
+}
+
+// Computes the box filter weights, i.e. the coverage of each source pixel by the destination pixel.
+static void ComputeBoxFilterWeights(FilterWeights& filterWeights, std::size_t srcSize, std::size_t dstSize)
+{
+    auto scale = static_cast<double>(srcSize) / static_cast<double>(dstSize);
+
+    std::vector<double> weights;
+
+    for (std::size_t i = 0; i < dstSize; ++i)
+    {
+        auto areaBegin  = static_cast<double>(i) * scale;
+        auto areaEnd    = static_cast<double>(i + 1) * scale;
+
+        auto first  = static_cast<std::size_t>(areaBegin);
+        auto last   = std::min(static_cast<std::size_t>(std::ceil(areaEnd)), srcSize);
+
+        weights.clear();
+        for (auto j = first; j < last; ++j)
+            weights.push_back(std::min(areaEnd, static_cast<double>(j + 1)) - std::max(areaBegin, static_cast<double>(j)));
+
+        AddFilterContribution(filterWeights, weights, first);
+    }
+}
+
+// Computes the weights of a windowed sinc filter, where source pixels outside the image are clamped to the edge.
+static void ComputeSincFilterWeights(FilterWeights& filterWeights, std::size_t srcSize, std::size_t dstSize, double (*filter)(double))
+{
+    auto scale  = static_cast<double>(srcSize) / static_cast<double>(dstSize);
+    auto radius = sincFilterRadius * scale;
+
+    std::vector<double> weights;
+
+    for (std::size_t i = 0; i < dstSize; ++i)
+    {
+        auto center = (static_cast<double>(i) + 0.5) * scale;
+        auto begin  = static_cast<long long>(std::floor(center - radius));
+        auto end    = static_cast<long long>(std::ceil(center + radius));
+
+        auto first  = static_cast<long long>(std::max(0ll, begin));
+        auto last   = std::min(end, static_cast<long long>(srcSize) - 1);
+
+        weights.assign(static_cast<std::size_t>(last - first + 1), 0.0);
+
+        for (auto j = begin; j <= end; ++j)
+        {
+            auto w = filter((static_cast<double>(j) + 0.5 - center) / scale);
+            auto k = std::max(first, std::min(j, last));
+            weights[static_cast<std::size_t>(k - first)] += w;
+        }
+
+        AddFilterContribution(filterWeights, weights, static_cast<std::size_t>(first));
+    }
+}
+
+static void ComputeFilterWeights(FilterWeights& filterWeights, MipmapFilter filter, std::size_t srcSize, std::size_t dstSize)
+{
+    switch (filter)
+    {
+        case MipmapFilter::Box:
+            ComputeBoxFilterWeights(filterWeights, srcSize, dstSize);
+            break;
+        case MipmapFilter::Kaiser:
+            ComputeSincFilterWeights(filterWeights, srcSize, dstSize, KaiserFilter);
+            break;
+        case MipmapFilter::Lanczos:
+            ComputeSincFilterWeights(filterWeights, srcSize, dstSize, LanczosFilter);
+            break;
+    }
+}
+
+
+/* ----- Row kernels ----- */
+
+/*
+Accumulates the weighted source rows into the destination row, i.e. dst[i] = sum_j(weights[j] * srcRows[j][i]).
+This is the inner loop of the vertical filter pass.
+*/
+static std::size_t AccumulateRowsScalar(float* dst, const float* const* srcRows, const float* weights, std::size_t numRows, std::size_t begin, std::size_t end)
+{
+    for (auto i = begin; i < end; ++i)
+    {
+        float sum = 0.0f;
+        for (std::size_t j = 0; j < numRows; ++j)
+            sum += weights[j] * srcRows[j][i];
+        dst[i] = sum;
+    }
+    return end;
+}
+
+// Filters a row with four components per pixel along the horizontal axis.
+static void FilterRowRGBAScalar(float* dst, const float* src, const FilterWeights& filterWeights)
+{
+    for (const auto& contrib : filterWeights.contributions)
+    {
+        auto weights    = &(filterWeights.weights[contrib.weightOffset]);
+        auto srcPixel   = src + contrib.first * 4;
+
+        float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+        for (std::size_t j = 0; j < contrib.count; ++j, srcPixel += 4)
+        {
+            sum[0] += weights[j] * srcPixel[0];
+            sum[1] += weights[j] * srcPixel[1];
+            sum[2] += weights[j] * srcPixel[2];
+            sum[3] += weights[j] * srcPixel[3];
+        }
+
+        ::memcpy(dst, sum, sizeof(sum));
+        dst += 4;
+    }
+}
+
+#ifdef LLGL_ARCH_X86
+
+LLGL_TARGET_SSE2
+static std::size_t AccumulateRowsSSE2(float* dst, const float* const* srcRows, const float* weights, std::size_t numRows, std::size_t begin, std::size_t end)
+{
+    auto i = begin;
+
+    for (; i + 4 <= end; i += 4)
+    {
+        __m128 sum = _mm_setzero_ps();
+        for (std::size_t j = 0; j < numRows; ++j)
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[j]), _mm_loadu_ps(srcRows[j] + i)));
+        _mm_storeu_ps(dst + i, sum);
+    }
+
+    return i;
+}
+
+LLGL_TARGET_AVX2
+static std::size_t AccumulateRowsAVX2(float* dst, const float* const* srcRows, const float* weights, std::size_t numRows, std::size_t begin, std::size_t end)
+{
+    auto i = begin;
+
+    for (; i + 8 <= end; i += 8)
+    {
+        __m256 sum = _mm256_setzero_ps();
+        for (std::size_t j = 0; j < numRows; ++j)
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(weights[j]), _mm256_loadu_ps(srcRows[j] + i)));
+        _mm256_storeu_ps(dst + i, sum);
+    }
+
+    return i;
+}
+
+LLGL_TARGET_SSE2
+static void FilterRowRGBASSE2(float* dst, const float* src, const FilterWeights& filterWeights)
+{
+    for (const auto& contrib : filterWeights.contributions)
+    {
+        auto weights    = &(filterWeights.weights[contrib.weightOffset]);
+        auto srcPixel   = src + contrib.first * 4;
+
+        __m128 sum = _mm_setzero_ps();
+
+        for (std::size_t j = 0; j < contrib.count; ++j, srcPixel += 4)
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[j]), _mm_loadu_ps(srcPixel)));
+
+        _mm_storeu_ps(dst, sum);
+        dst += 4;
+    }
+}
+
+#endif // /LLGL_ARCH_X86
+
+static void AccumulateRows(float* dst, const float* const* srcRows, const float* weights, std::size_t numRows, std::size_t count)
+{
+    std::size_t i = 0;
+
+    #ifdef LLGL_ARCH_X86
+    const auto& features = GetCPUFeatures();
+    if (features.hasAVX2)
+        i = AccumulateRowsAVX2(dst, srcRows, weights, numRows, i, count);
+    if (features.hasSSE2)
+        i = AccumulateRowsSSE2(dst, srcRows, weights, numRows, i, count);
+    #endif
+
+    AccumulateRowsScalar(dst, srcRows, weights, numRows, i, count);
+}
+
+// Filters a single row along the horizontal axis.
+static void FilterRow(float* dst, const float* src, const FilterWeights& filterWeights, std::size_t numComponents)
+{
+    if (numComponents == 4)
+    {
+        #ifdef LLGL_ARCH_X86
+        if (GetCPUFeatures().hasSSE2)
+        {
+            FilterRowRGBASSE2(dst, src, filterWeights);
+            return;
+        }
+        #endif
+        FilterRowRGBAScalar(dst, src, filterWeights);
+    }
+    else
+    {
+        for (const auto& contrib : filterWeights.contributions)
+        {
+            auto weights = &(filterWeights.weights[contrib.weightOffset]);
+
+            for (std::size_t c = 0; c < numComponents; ++c)
+            {
+                float sum = 0.0f;
+                for (std::size_t j = 0; j < contrib.count; ++j)
+                    sum += weights[j] * src[(contrib.first + j) * numComponents + c];
+                dst[c] = sum;
+            }
+
+            dst += numComponents;
+        }
+    }
+}
+
+
+/* ----- Downsampling ----- */
+
+// Returns the minimal number of rows each worker thread shall process for rows of the specified size.
+static std::size_t GetMinRowsPerThread(std::size_t rowSize)
+{
+    return std::max(std::size_t(1), (threadMinWorkSize * 64) / std::max(std::size_t(1), rowSize));
+}
+
+// Downsamples all layers of the source image into the destination image with a separable filter.
+static void DownsampleImage(
+    const float*    src,
+    std::size_t     srcWidth,
+    std::size_t     srcHeight,
+    float*          dst,
+    std::size_t     dstWidth,
+    std::size_t     dstHeight,
+    std::size_t     layers,
+    std::size_t     numComponents,
+    MipmapFilter    filter,
+    std::size_t     threadCount)
+{
+    auto srcRowSize = srcWidth * numComponents;
+    auto dstRowSize = dstWidth * numComponents;
+
+    /* Horizontal pass: filter each source row into the temporary image (skipped if the width does not change) */
+    std::vector<float> tempImage;
+    const float* tempRows = src;
+
+    if (dstWidth != srcWidth)
+    {
+        FilterWeights filterWeights;
+        ComputeFilterWeights(filterWeights, filter, srcWidth, dstWidth);
+
+        tempImage.resize(dstRowSize * srcHeight * layers);
+        auto tempData = tempImage.data();
+
+        DoConcurrentWork(
+            [&](std::size_t idxBegin, std::size_t idxEnd)
+            {
+                for (auto row = idxBegin; row < idxEnd; ++row)
+                    FilterRow(tempData + row * dstRowSize, src + row * srcRowSize, filterWeights, numComponents);
+            },
+            srcHeight * layers,
+            threadCount,
+            GetMinRowsPerThread(srcRowSize)
+        );
+
+        tempRows = tempData;
+    }
+
+    /* Vertical pass: accumulate the weighted temporary rows into each destination row */
+    if (dstHeight != srcHeight)
+    {
+        FilterWeights filterWeights;
+        ComputeFilterWeights(filterWeights, filter, srcHeight, dstHeight);
+
+        DoConcurrentWork(
+            [&](std::size_t idxBegin, std::size_t idxEnd)
+            {
+                std::vector<const float*> srcRows;
+
+                for (auto idx = idxBegin; idx < idxEnd; ++idx)
+                {
+                    auto layer      = idx / dstHeight;
+                    auto row        = idx % dstHeight;
+                    auto layerRows  = tempRows + layer * srcHeight * dstRowSize;
+
+                    const auto& contrib = filterWeights.contributions[row];
+
+                    srcRows.resize(contrib.count);
+                    for (std::size_t j = 0; j < contrib.count; ++j)
+                        srcRows[j] = layerRows + (contrib.first + j) * dstRowSize;
+
+                    AccumulateRows(
+                        dst + idx * dstRowSize,
+                        srcRows.data(),
+                        &(filterWeights.weights[contrib.weightOffset]),
+                        contrib.count,
+                        dstRowSize
+                    );
+                }
+            },
+            dstHeight * layers,
+            threadCount,
+            GetMinRowsPerThread(dstRowSize)
+        );
+    }
+    else
+        ::memcpy(dst, tempRows, sizeof(float) * dstRowSize * dstHeight * layers);
+}
+
+
+/* ----- Public functions ----- */
+
+ImageDescriptor MipmapChain::GetImageDescriptor(std::size_t index) const
+{
+    if (index >= levels.size())
+        throw std::out_of_range("MIP-map level index out of range");
+    return ImageDescriptor(format, dataType, data.get() + levels[index].offset);
+}
+
+LLGL_EXPORT MipmapChain GenerateMipmapChain(
+    ImageFormat                     format,
+    DataType                        dataType,
+    const void*                     srcBuffer,
+    unsigned int                    width,
+    unsigned int                    height,
+    unsigned int                    layers,
+    const MipmapChainDescriptor&    desc)
+{
+    /* Validate input parameters */
+    LLGL_ASSERT_PTR(srcBuffer);
+
+    if (IsCompressedFormat(format))
+        throw std::invalid_argument("can not generate MIP-maps for compressed image formats");
+    if (IsDepthStencilFormat(format))
+        throw std::invalid_argument("can not generate MIP-maps for depth-stencil image formats");
+    if (width == 0 || height == 0 || layers == 0)
+        throw std::invalid_argument("can not generate MIP-maps for an empty image");
+
+    auto numComponents  = static_cast<std::size_t>(ImageFormatSize(format));
+    auto pixelSize      = numComponents * DataTypeSize(dataType);
+
+    /* Determine MIP-map level dimensions */
+    MipmapChain chain;
+    chain.format    = format;
+    chain.dataType  = dataType;
+
+    std::size_t dataSize = 0;
+
+    for (unsigned int w = width, h = height, mipLevel = 1; (w > 1 || h > 1); ++mipLevel)
+    {
+        if (desc.maxNumMipLevels > 0 && mipLevel >= desc.maxNumMipLevels)
+            break;
+
+        w = std::max(1u, w / 2);
+        h = std::max(1u, h / 2);
+
+        MipmapLevel level;
+        {
+            level.mipLevel  = mipLevel;
+            level.width     = w;
+            level.height    = h;
+            level.layers    = layers;
+            level.offset    = dataSize;
+            level.size      = pixelSize * w * h * layers;
+        }
+        chain.levels.push_back(level);
+
+        dataSize += level.size;
+    }
+
+    if (chain.levels.empty())
+        return chain;
+
+    chain.data = ByteBuffer(new char[dataSize]);
+
+    /* Convert base level into linear floating-points (this is skipped for linear 32-bit floating-point images) */
+    auto colorConversionIn  = (desc.gammaCorrect ? ColorSpaceConversion::SRGBToLinear : ColorSpaceConversion::Disabled);
+    auto colorConversionOut = (desc.gammaCorrect ? ColorSpaceConversion::LinearToSRGB : ColorSpaceConversion::Disabled);
+
+    std::vector<float> srcImage, dstImage;
+    const float* src = reinterpret_cast<const float*>(srcBuffer);
+
+    if (dataType != DataType::Float || desc.gammaCorrect)
+    {
+        srcImage.resize(numComponents * width * height * layers);
+        ConvertImageBuffer(
+            format, dataType, srcBuffer, 0,
+            format, DataType::Float, srcImage.data(), srcImage.size() * sizeof(float), 0,
+            width, height * layers, desc.threadCount, colorConversionIn
+        );
+        src = srcImage.data();
+    }
+
+    /* Downsample each MIP-map level from the previous one */
+    std::size_t srcWidth = width, srcHeight = height;
+
+    for (const auto& level : chain.levels)
+    {
+        dstImage.resize(numComponents * level.width * level.height * layers);
+
+        DownsampleImage(
+            src, srcWidth, srcHeight,
+            dstImage.data(), level.width, level.height,
+            layers, numComponents, desc.filter, desc.threadCount
+        );
+
+        /* Convert MIP-map level back into the source data type */
+        ConvertImageBuffer(
+            format, DataType::Float, dstImage.data(), 0,
+            format, dataType, chain.data.get() + level.offset, level.size, 0,
+            level.width, level.height * layers, desc.threadCount, colorConversionOut
+        );
+
+        std::swap(srcImage, dstImage);
+        src         = srcImage.data();
+        srcWidth    = level.width;
+        srcHeight   = level.height;
+    }
+
+    return chain;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,604 @@
+/*
+ * TextureFile.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/TextureFile.h>
+#include <LLGL/ImageCompression.h>
+#include "../Platform/MappedFile.h"
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal structures ----- */
+
+// Texture and image format of a texture file
+struct TextureFileFormatDesc
+{
+    TextureFormat   textureFormat;
+    ImageFormat     imageFormat;
+    DataType        dataType;
+};
+
+struct DDSPixelFormat
+{
+    std::uint32_t size;
+    std::uint32_t flags;
+    std::uint32_t fourCC;
+    std::uint32_t rgbBitCount;
+    std::uint32_t rBitMask;
+    std::uint32_t gBitMask;
+    std::uint32_t bBitMask;
+    std::uint32_t aBitMask;
+};
+
+struct DDSHeader
+{
+    std::uint32_t   size;
+    std::uint32_t   flags;
+    std::uint32_t   height;
+    std::uint32_t   width;
+    std::uint32_t   pitchOrLinearSize;
+    std::uint32_t   depth;
+    std::uint32_t   mipMapCount;
+    std::uint32_t   reserved1[11];
+    DDSPixelFormat  pixelFormat;
+    std::uint32_t   caps;
+    std::uint32_t   caps2;
+    std::uint32_t   caps3;
+    std::uint32_t   caps4;
+    std::uint32_t   reserved2;
+};
+
+struct DDSHeaderDX10
+{
+    std::uint32_t dxgiFormat;
+    std::uint32_t resourceDimension;
+    std::uint32_t miscFlag;
+    std::uint32_t arraySize;
+    std::uint32_t miscFlags2;
+};
+
+struct KTXHeader
+{
+    std::uint8_t    identifier[12];
+    std::uint32_t   endianness;
+    std::uint32_t   glType;
+    std::uint32_t   glTypeSize;
+    std::uint32_t   glFormat;
+    std::uint32_t   glInternalFormat;
+    std::uint32_t   glBaseInternalFormat;
+    std::uint32_t   pixelWidth;
+    std::uint32_t   pixelHeight;
+    std::uint32_t   pixelDepth;
+    std::uint32_t   numberOfArrayElements;
+    std::uint32_t   numberOfFaces;
+    std::uint32_t   numberOfMipmapLevels;
+    std::uint32_t   bytesOfKeyValueData;
+};
+
+static_assert(sizeof(DDSHeader)     == 124, "DDSHeader must have a size of 124 bytes");
+static_assert(sizeof(DDSHeaderDX10) ==  20, "DDSHeaderDX10 must have a size of 20 bytes");
+static_assert(sizeof(KTXHeader)     ==  64, "KTXHeader must have a size of 64 bytes");
+
+static const std::uint8_t ddsMagic[4]           = { 'D', 'D', 'S', ' ' };
+static const std::uint8_t ktxIdentifier[12]     = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+static const std::uint32_t ddsFlagMipMapCount   = 0x00020000;
+static const std::uint32_t ddsFlagDepth         = 0x00800000;
+static const std::uint32_t ddsPixelAlphaPixels  = 0x00000001;
+static const std::uint32_t ddsPixelFourCC       = 0x00000004;
+static const std::uint32_t ddsPixelRGB          = 0x00000040;
+static const std::uint32_t ddsPixelLuminance    = 0x00020000;
+static const std::uint32_t ddsCaps2CubeMap      = 0x00000200;
+static const std::uint32_t ddsCaps2AllFaces     = 0x0000FC00;
+static const std::uint32_t ddsCaps2Volume       = 0x00200000;
+static const std::uint32_t dx10Texture1D        = 2;
+static const std::uint32_t dx10Texture3D        = 4;
+static const std::uint32_t dx10MiscTextureCube  = 0x00000004;
+
+static const std::uint32_t ktxEndianness        = 0x04030201;
+
+
+/* ----- Internal functions ----- */
+
+static std::uint32_t MakeFourCC(char c0, char c1, char c2, char c3)
+{
+    return
+    (
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c0))      ) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c1)) <<  8) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c2)) << 16) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c3)) << 24)
+    );
+}
+
+static TextureFileFormatDesc CompressedFormatDesc(const TextureFormat format)
+{
+    auto imageFormat = (format == TextureFormat::RGB_DXT1 ? ImageFormat::CompressedRGB : ImageFormat::CompressedRGBA);
+    return { format, imageFormat, DataType::UInt8 };
+}
+
+static TextureFileFormatDesc UnsupportedFormatDesc()
+{
+    return { TextureFormat::Unknown, ImageFormat::RGBA, DataType::UInt8 };
+}
+
+// Returns the format of the legacy DDS pixel format (without DX10 header extension).
+static TextureFileFormatDesc FindDDSPixelFormat(const DDSPixelFormat& pixelFormat)
+{
+    if ((pixelFormat.flags & ddsPixelFourCC) != 0)
+    {
+        if (pixelFormat.fourCC == MakeFourCC('D', 'X', 'T', '1'))
+            return CompressedFormatDesc((pixelFormat.flags & ddsPixelAlphaPixels) != 0 ? TextureFormat::RGBA_DXT1 : TextureFormat::RGB_DXT1);
+        if (pixelFormat.fourCC == MakeFourCC('D', 'X', 'T', '3'))
+            return CompressedFormatDesc(TextureFormat::RGBA_DXT3);
+        if (pixelFormat.fourCC == MakeFourCC('D', 'X', 'T', '5'))
+            return CompressedFormatDesc(TextureFormat::RGBA_DXT5);
+
+        /* D3DFMT_A16B16G16R16F and D3DFMT_A32B32G32R32F */
+        if (pixelFormat.fourCC == 113)
+            return { TextureFormat::RGBA16Float, ImageFormat::RGBA, DataType::Float16 };
+        if (pixelFormat.fourCC == 116)
+            return { TextureFormat::RGBA32Float, ImageFormat::RGBA, DataType::Float };
+    }
+    else if ((pixelFormat.flags & ddsPixelRGB) != 0)
+    {
+        if (pixelFormat.rgbBitCount == 32)
+        {
+            if (pixelFormat.rBitMask == 0x000000FF && pixelFormat.gBitMask == 0x0000FF00 && pixelFormat.bBitMask == 0x00FF0000)
+                return { TextureFormat::RGBA8, ImageFormat::RGBA, DataType::UInt8 };
+            if (pixelFormat.rBitMask == 0x00FF0000 && pixelFormat.gBitMask == 0x0000FF00 && pixelFormat.bBitMask == 0x000000FF)
+                return { TextureFormat::RGBA8, ImageFormat::BGRA, DataType::UInt8 };
+        }
+        else if (pixelFormat.rgbBitCount == 24)
+        {
+            if (pixelFormat.rBitMask == 0x000000FF && pixelFormat.gBitMask == 0x0000FF00 && pixelFormat.bBitMask == 0x00FF0000)
+                return { TextureFormat::RGB8, ImageFormat::RGB, DataType::UInt8 };
+            if (pixelFormat.rBitMask == 0x00FF0000 && pixelFormat.gBitMask == 0x0000FF00 && pixelFormat.bBitMask == 0x000000FF)
+                return { TextureFormat::RGB8, ImageFormat::BGR, DataType::UInt8 };
+        }
+    }
+    else if ((pixelFormat.flags & ddsPixelLuminance) != 0)
+    {
+        if (pixelFormat.rgbBitCount == 8)
+            return { TextureFormat::R8, ImageFormat::R, DataType::UInt8 };
+    }
+    return UnsupportedFormatDesc();
+}
+
+// Returns the format of the DXGI_FORMAT value from the DDS DX10 header extension.
+static TextureFileFormatDesc FindDXGIFormat(std::uint32_t dxgiFormat)
+{
+    switch (dxgiFormat)
+    {
+        case  2: return { TextureFormat::RGBA32Float, ImageFormat::RGBA, DataType::Float   }; // DXGI_FORMAT_R32G32B32A32_FLOAT
+        case  6: return { TextureFormat::RGB32Float,  ImageFormat::RGB,  DataType::Float   }; // DXGI_FORMAT_R32G32B32_FLOAT
+        case 10: return { TextureFormat::RGBA16Float, ImageFormat::RGBA, DataType::Float16 }; // DXGI_FORMAT_R16G16B16A16_FLOAT
+        case 16: return { TextureFormat::RG32Float,   ImageFormat::RG,   DataType::Float   }; // DXGI_FORMAT_R32G32_FLOAT
+        case 28: // DXGI_FORMAT_R8G8B8A8_UNORM
+        case 29: return { TextureFormat::RGBA8,       ImageFormat::RGBA, DataType::UInt8   }; // DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+        case 34: return { TextureFormat::RG16Float,   ImageFormat::RG,   DataType::Float16 }; // DXGI_FORMAT_R16G16_FLOAT
+        case 41: return { TextureFormat::R32Float,    ImageFormat::R,    DataType::Float   }; // DXGI_FORMAT_R32_FLOAT
+        case 49: return { TextureFormat::RG8,         ImageFormat::RG,   DataType::UInt8   }; // DXGI_FORMAT_R8G8_UNORM
+        case 54: return { TextureFormat::R16Float,    ImageFormat::R,    DataType::Float16 }; // DXGI_FORMAT_R16_FLOAT
+        case 61: return { TextureFormat::R8,          ImageFormat::R,    DataType::UInt8   }; // DXGI_FORMAT_R8_UNORM
+        case 71: // DXGI_FORMAT_BC1_UNORM
+        case 72: return CompressedFormatDesc(TextureFormat::RGBA_DXT1); // DXGI_FORMAT_BC1_UNORM_SRGB
+        case 74: // DXGI_FORMAT_BC2_UNORM
+        case 75: return CompressedFormatDesc(TextureFormat::RGBA_DXT3); // DXGI_FORMAT_BC2_UNORM_SRGB
+        case 77: // DXGI_FORMAT_BC3_UNORM
+        case 78: return CompressedFormatDesc(TextureFormat::RGBA_DXT5); // DXGI_FORMAT_BC3_UNORM_SRGB
+        case 87: // DXGI_FORMAT_B8G8R8A8_UNORM
+        case 91: return { TextureFormat::RGBA8,       ImageFormat::BGRA, DataType::UInt8   }; // DXGI_FORMAT_B8G8R8A8_UNORM_SRGB
+        default: return UnsupportedFormatDesc();
+    }
+}
+
+// Returns the format of the OpenGL internal format, format, and type from the KTX header.
+static TextureFileFormatDesc FindKTXFormat(std::uint32_t glInternalFormat, std::uint32_t glFormat, std::uint32_t glType)
+{
+    /* Find compressed format (GL_EXT_texture_compression_s3tc) */
+    switch (glInternalFormat)
+    {
+        case 0x83F0: return CompressedFormatDesc(TextureFormat::RGB_DXT1);
+        case 0x83F1: return CompressedFormatDesc(TextureFormat::RGBA_DXT1);
+        case 0x83F2: return CompressedFormatDesc(TextureFormat::RGBA_DXT3);
+        case 0x83F3: return CompressedFormatDesc(TextureFormat::RGBA_DXT5);
+        default:     break;
+    }
+
+    TextureFileFormatDesc desc = UnsupportedFormatDesc();
+
+    /* Find uncompressed texture format */
+    switch (glInternalFormat)
+    {
+        case 0x8229: desc.textureFormat = TextureFormat::R8;            break; // GL_R8
+        case 0x822B: desc.textureFormat = TextureFormat::RG8;           break; // GL_RG8
+        case 0x8051: desc.textureFormat = TextureFormat::RGB8;          break; // GL_RGB8
+        case 0x8058: desc.textureFormat = TextureFormat::RGBA8;         break; // GL_RGBA8
+        case 0x822D: desc.textureFormat = TextureFormat::R16Float;      break; // GL_R16F
+        case 0x822F: desc.textureFormat = TextureFormat::RG16Float;     break; // GL_RG16F
+        case 0x881B: desc.textureFormat = TextureFormat::RGB16Float;    break; // GL_RGB16F
+        case 0x881A: desc.textureFormat = TextureFormat::RGBA16Float;   break; // GL_RGBA16F
+        case 0x822E: desc.textureFormat = TextureFormat::R32Float;      break; // GL_R32F
+        case 0x8230: desc.textureFormat = TextureFormat::RG32Float;     break; // GL_RG32F
+        case 0x8815: desc.textureFormat = TextureFormat::RGB32Float;    break; // GL_RGB32F
+        case 0x8814: desc.textureFormat = TextureFormat::RGBA32Float;   break; // GL_RGBA32F
+        default:     return UnsupportedFormatDesc();
+    }
+
+    /* Find image format */
+    switch (glFormat)
+    {
+        case 0x1903: desc.imageFormat = ImageFormat::R;     break; // GL_RED
+        case 0x8227: desc.imageFormat = ImageFormat::RG;    break; // GL_RG
+        case 0x1907: desc.imageFormat = ImageFormat::RGB;   break; // GL_RGB
+        case 0x80E0: desc.imageFormat = ImageFormat::BGR;   break; // GL_BGR
+        case 0x1908: desc.imageFormat = ImageFormat::RGBA;  break; // GL_RGBA
+        case 0x80E1: desc.imageFormat = ImageFormat::BGRA;  break; // GL_BGRA
+        default:     return UnsupportedFormatDesc();
+    }
+
+    /* Find data type */
+    switch (glType)
+    {
+        case 0x1401: desc.dataType = DataType::UInt8;   break; // GL_UNSIGNED_BYTE
+        case 0x140B: desc.dataType = DataType::Float16; break; // GL_HALF_FLOAT
+        case 0x1406: desc.dataType = DataType::Float;   break; // GL_FLOAT
+        default:     return UnsupportedFormatDesc();
+    }
+
+    return desc;
+}
+
+// Reads the structure at the specified offset from the mapped file and moves the offset behind it.
+template <typename T>
+void ReadFileStruct(const MappedFile& file, std::size_t& offset, T& data)
+{
+    if (offset + sizeof(T) > file.GetSize())
+        throw std::runtime_error("unexpected end of file");
+    ::memcpy(&data, static_cast<const char*>(file.GetData()) + offset, sizeof(T));
+    offset += sizeof(T);
+}
+
+static bool HasFileIdentifier(const MappedFile& file, const std::uint8_t* identifier, std::size_t size)
+{
+    return (file.GetSize() >= size && ::memcmp(file.GetData(), identifier, size) == 0);
+}
+
+
+/* ----- TextureFile class ----- */
+
+TextureFile::TextureFile(const std::string& filename) :
+    file_ { MappedFile::Open(filename) }
+{
+    try
+    {
+        /* Determine file format by its identifier */
+        if (HasFileIdentifier(*file_, ddsMagic, sizeof(ddsMagic)))
+            LoadDDS();
+        else if (HasFileIdentifier(*file_, ktxIdentifier, sizeof(ktxIdentifier)))
+            LoadKTX();
+        else
+            throw std::runtime_error("unknown file format");
+    }
+    catch (const std::runtime_error& e)
+    {
+        throw std::runtime_error("failed to load texture file \"" + filename + "\": " + e.what());
+    }
+}
+
+TextureFile::~TextureFile()
+{
+}
+
+ImageDescriptor TextureFile::GetImageDescriptor(unsigned int mipLevel, unsigned int layer) const
+{
+    const auto& subImage = GetSubImage(mipLevel, layer);
+    auto buffer = static_cast<const char*>(file_->GetData()) + subImage.offset;
+
+    if (IsCompressedFormat(imageFormat_))
+        return ImageDescriptor(imageFormat_, buffer, static_cast<unsigned int>(subImage.size));
+
+    ImageDescriptor imageDesc(imageFormat_, dataType_, buffer);
+    imageDesc.alignment = rowAlignment_;
+    return imageDesc;
+}
+
+SubTextureDescriptor TextureFile::GetSubTextureDescriptor(unsigned int mipLevel, unsigned int layer) const
+{
+    GetSubImage(mipLevel, layer);
+
+    auto size = GetMipLevelSize(mipLevel);
+
+    SubTextureDescriptor desc;
+    {
+        desc.mipLevel = mipLevel;
+
+        switch (textureDesc_.type)
+        {
+            case TextureType::Texture1D:
+            case TextureType::Texture1DArray:
+                desc.texture1D.x            = 0;
+                desc.texture1D.layerOffset  = layer;
+                desc.texture1D.width        = size.x;
+                desc.texture1D.layers       = 1;
+                break;
+
+            case TextureType::Texture2D:
+            case TextureType::Texture2DArray:
+                desc.texture2D.x            = 0;
+                desc.texture2D.y            = 0;
+                desc.texture2D.layerOffset  = layer;
+                desc.texture2D.width        = size.x;
+                desc.texture2D.height       = size.y;
+                desc.texture2D.layers       = 1;
+                break;
+
+            case TextureType::Texture3D:
+                desc.texture3D.x            = 0;
+                desc.texture3D.y            = 0;
+                desc.texture3D.z            = 0;
+                desc.texture3D.width        = size.x;
+                desc.texture3D.height       = size.y;
+                desc.texture3D.depth        = size.z;
+                break;
+
+            case TextureType::TextureCube:
+            case TextureType::TextureCubeArray:
+                desc.textureCube.x              = 0;
+                desc.textureCube.y              = 0;
+                desc.textureCube.layerOffset    = layer / 6;
+                desc.textureCube.width          = size.x;
+                desc.textureCube.height         = size.y;
+                desc.textureCube.cubeFaces      = 1;
+                desc.textureCube.cubeFaceOffset = static_cast<AxisDirection>(layer % 6);
+                break;
+
+            default:
+                break;
+        }
+    }
+    return desc;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void TextureFile::LoadDDS()
+{
+    fileFormat_ = TextureFileFormat::DDS;
+
+    /* Read DDS header */
+    std::size_t offset = sizeof(ddsMagic);
+
+    DDSHeader header;
+    ReadFileStruct(*file_, offset, header);
+
+    if (header.size != sizeof(DDSHeader) || header.pixelFormat.size != sizeof(DDSPixelFormat))
+        throw std::runtime_error("invalid DDS header");
+
+    bool            isCubeMap   = ((header.caps2 & ddsCaps2CubeMap) != 0);
+    bool            isVolume    = ((header.caps2 & ddsCaps2Volume) != 0 && (header.flags & ddsFlagDepth) != 0);
+    bool            is1D        = false;
+    unsigned int    arraySize   = 0;
+
+    TextureFileFormatDesc formatDesc;
+
+    if ((header.pixelFormat.flags & ddsPixelFourCC) != 0 && header.pixelFormat.fourCC == MakeFourCC('D', 'X', '1', '0'))
+    {
+        /* Read DX10 header extension */
+        DDSHeaderDX10 headerDX10;
+        ReadFileStruct(*file_, offset, headerDX10);
+
+        formatDesc  = FindDXGIFormat(headerDX10.dxgiFormat);
+        is1D        = (headerDX10.resourceDimension == dx10Texture1D);
+        isVolume    = (headerDX10.resourceDimension == dx10Texture3D);
+        isCubeMap   = ((headerDX10.miscFlag & dx10MiscTextureCube) != 0);
+        arraySize   = (headerDX10.arraySize > 1 ? headerDX10.arraySize : 0);
+    }
+    else
+    {
+        formatDesc = FindDDSPixelFormat(header.pixelFormat);
+        if (isCubeMap && (header.caps2 & ddsCaps2AllFaces) != ddsCaps2AllFaces)
+            throw std::runtime_error("DDS cube maps with missing faces are not supported");
+    }
+
+    if (formatDesc.textureFormat == TextureFormat::Unknown)
+        throw std::runtime_error("unsupported DDS pixel format");
+
+    textureDesc_.format = formatDesc.textureFormat;
+    imageFormat_        = formatDesc.imageFormat;
+    dataType_           = formatDesc.dataType;
+
+    auto numMipLevels = ((header.flags & ddsFlagMipMapCount) != 0 ? std::max(1u, header.mipMapCount) : 1u);
+
+    SetupTexture(
+        header.width,
+        (is1D ? 0 : header.height),
+        (isVolume ? header.depth : 0),
+        arraySize,
+        isCubeMap,
+        numMipLevels
+    );
+
+    /* Each layer is stored with its entire MIP-map chain one after another */
+    for (unsigned int layer = 0; layer < numLayers_; ++layer)
+    {
+        for (unsigned int mipLevel = 0; mipLevel < numMipLevels_; ++mipLevel)
+        {
+            auto size = GetSubImageSize(mipLevel);
+            SetSubImage(mipLevel, layer, offset, size);
+            offset += size;
+        }
+    }
+}
+
+void TextureFile::LoadKTX()
+{
+    fileFormat_ = TextureFileFormat::KTX;
+
+    /* Read KTX header */
+    std::size_t offset = 0;
+
+    KTXHeader header;
+    ReadFileStruct(*file_, offset, header);
+
+    if (header.endianness != ktxEndianness)
+        throw std::runtime_error("KTX files with swapped endianness are not supported");
+    if (header.numberOfFaces != 1 && header.numberOfFaces != 6)
+        throw std::runtime_error("invalid number of cube faces in KTX header");
+
+    auto formatDesc = FindKTXFormat(header.glInternalFormat, header.glFormat, header.glType);
+    if (formatDesc.textureFormat == TextureFormat::Unknown)
+        throw std::runtime_error("unsupported KTX texture format");
+
+    textureDesc_.format = formatDesc.textureFormat;
+    imageFormat_        = formatDesc.imageFormat;
+    dataType_           = formatDesc.dataType;
+
+    /* Skip key/value data */
+    offset += header.bytesOfKeyValueData;
+
+    SetupTexture(
+        header.pixelWidth,
+        header.pixelHeight,
+        header.pixelDepth,
+        header.numberOfArrayElements,
+        (header.numberOfFaces == 6),
+        std::max(1u, header.numberOfMipmapLevels)
+    );
+
+    /* KTX rows of uncompressed images are padded to 4 bytes */
+    rowAlignment_ = 4;
+
+    /* Each MIP-map level is stored with all its layers one after another (non-array cube maps specify the size of a single face) */
+    bool isNonArrayCubeMap = (header.numberOfFaces == 6 && header.numberOfArrayElements == 0);
+
+    for (unsigned int mipLevel = 0; mipLevel < numMipLevels_; ++mipLevel)
+    {
+        std::uint32_t imageSize = 0;
+        ReadFileStruct(*file_, offset, imageSize);
+
+        auto size = GetSubImageSize(mipLevel);
+        if (imageSize != (isNonArrayCubeMap ? size : size * numLayers_))
+            throw std::runtime_error("invalid image size in KTX file");
+
+        for (unsigned int layer = 0; layer < numLayers_; ++layer)
+        {
+            SetSubImage(mipLevel, layer, offset, size);
+            offset += size;
+        }
+
+        /* Skip MIP-map padding */
+        offset = (offset + 3) & ~static_cast<std::size_t>(3);
+    }
+}
+
+void TextureFile::SetupTexture(
+    unsigned int width, unsigned int height, unsigned int depth, unsigned int arraySize, bool isCubeMap, unsigned int numMipLevels)
+{
+    if (width == 0)
+        throw std::runtime_error("invalid texture size");
+    if (depth > 1 && (arraySize > 0 || isCubeMap))
+        throw std::runtime_error("3D texture arrays are not supported");
+
+    /* Setup texture type and size (height is 0 for 1D textures, and depth is 0 for non-3D textures) */
+    if (isCubeMap)
+    {
+        textureDesc_.type                   = (arraySize > 0 ? TextureType::TextureCubeArray : TextureType::TextureCube);
+        textureDesc_.textureCube.width      = width;
+        textureDesc_.textureCube.height     = height;
+        textureDesc_.textureCube.layers     = std::max(1u, arraySize);
+        size_                               = { width, height, 1u };
+        numLayers_                          = std::max(1u, arraySize) * 6;
+    }
+    else if (depth > 1)
+    {
+        textureDesc_.type                   = TextureType::Texture3D;
+        textureDesc_.texture3D.width        = width;
+        textureDesc_.texture3D.height       = height;
+        textureDesc_.texture3D.depth        = depth;
+        size_                               = { width, height, depth };
+        numLayers_                          = 1;
+    }
+    else if (height == 0)
+    {
+        textureDesc_.type                   = (arraySize > 0 ? TextureType::Texture1DArray : TextureType::Texture1D);
+        textureDesc_.texture1D.width        = width;
+        textureDesc_.texture1D.layers       = std::max(1u, arraySize);
+        size_                               = { width, 1u, 1u };
+        numLayers_                          = std::max(1u, arraySize);
+    }
+    else
+    {
+        textureDesc_.type                   = (arraySize > 0 ? TextureType::Texture2DArray : TextureType::Texture2D);
+        textureDesc_.texture2D.width        = width;
+        textureDesc_.texture2D.height       = height;
+        textureDesc_.texture2D.layers       = std::max(1u, arraySize);
+        size_                               = { width, height, 1u };
+        numLayers_                          = std::max(1u, arraySize);
+    }
+
+    if (numMipLevels > NumMipLevels(size_.x, size_.y, size_.z))
+        throw std::runtime_error("invalid number of MIP-map levels");
+
+    numMipLevels_           = numMipLevels;
+    textureDesc_.mipLevels  = numMipLevels;
+    subImages_.resize(numMipLevels_ * numLayers_);
+}
+
+void TextureFile::SetSubImage(unsigned int mipLevel, unsigned int layer, std::size_t offset, std::size_t size)
+{
+    if (offset + size > file_->GetSize())
+        throw std::runtime_error("unexpected end of file");
+    subImages_[mipLevel * numLayers_ + layer] = { offset, size };
+}
+
+Gs::Vector3ui TextureFile::GetMipLevelSize(unsigned int mipLevel) const
+{
+    return
+    {
+        std::max(1u, size_.x >> mipLevel),
+        std::max(1u, size_.y >> mipLevel),
+        std::max(1u, size_.z >> mipLevel)
+    };
+}
+
+std::size_t TextureFile::GetSubImageSize(unsigned int mipLevel) const
+{
+    auto size = GetMipLevelSize(mipLevel);
+    if (IsCompressedFormat(textureDesc_.format))
+        return (CompressedImageSize(textureDesc_.format, size.x, size.y) * size.z);
+    else
+    {
+        ImageDescriptor imageDesc(imageFormat_, dataType_, nullptr);
+        imageDesc.alignment = rowAlignment_;
+        return (imageDesc.GetImageStride(size.x, size.y) * size.z);
+    }
+}
+
+const TextureFile::SubImage& TextureFile::GetSubImage(unsigned int mipLevel, unsigned int layer) const
+{
+    if (mipLevel >= numMipLevels_ || layer >= numLayers_)
+        throw std::out_of_range("MIP-map level or array layer out of range for texture file");
+    return subImages_[mipLevel * numLayers_ + layer];
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,209 @@
+/*
+ * ThreadPool.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ThreadPool.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Number of chunks each participating thread shall get, so that idle threads have something to steal
+static const std::size_t chunksPerThread = 4;
+
+ThreadPool::ThreadPool(std::size_t maxNumWorkerThreads) :
+    maxNumWorkerThreads_( maxNumWorkerThreads ),
+    numWorkerThreads_   ( 0                   ),
+    numJobs_            ( 0                   ),
+    numChunks_          ( 0                   ),
+    numStolenChunks_    ( 0                   )
+{
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        stop_ = true;
+    }
+    queueVar_.notify_all();
+
+    for (auto& w : workers_)
+        w.join();
+}
+
+void ThreadPool::ParallelFor(std::size_t count, std::size_t threadCount, std::size_t minChunkSize, const Task& task)
+{
+    /* Create worker threads on first use */
+    std::call_once(workersCreated_, &ThreadPool::CreateWorkerThreads, this);
+
+    threadCount = std::min(threadCount, workers_.size() + 1);
+
+    if (threadCount < 2 || count == 0)
+    {
+        task(0, count);
+        return;
+    }
+
+    /* Split work into chunks and distribute them equally over the participating threads */
+    auto job = std::make_shared<Job>();
+
+    job->task       = (&task);
+    job->count      = count;
+    job->chunkSize  = std::max(minChunkSize, (count + threadCount*chunksPerThread - 1) / (threadCount*chunksPerThread));
+
+    auto numChunks  = (count + job->chunkSize - 1) / job->chunkSize;
+
+    job->numRanges  = std::min(threadCount, numChunks);
+    job->ranges     = std::unique_ptr<ChunkRange[]>(new ChunkRange[job->numRanges]);
+    job->chunksPending.store(numChunks);
+
+    for (std::size_t i = 0, first = 0; i < job->numRanges; ++i)
+    {
+        auto last = numChunks * (i + 1) / job->numRanges;
+        job->ranges[i].next.store(first);
+        job->ranges[i].end = last;
+        first = last;
+    }
+
+    ++numJobs_;
+
+    /* Let the worker threads join this job, the calling thread takes the first slot */
+    if (job->numRanges > 1)
+    {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            queue_.push_back(job);
+        }
+        queueVar_.notify_all();
+    }
+
+    ProcessJob(*job, 0);
+
+    /* Wait until all chunks (also those processed by other threads) are done */
+    {
+        std::unique_lock<std::mutex> lock(job->doneMutex);
+        job->doneVar.wait(lock, [&job]{ return (job->chunksPending.load() == 0); });
+    }
+
+    /* Remove job from queue if not all slots have been taken */
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        auto it = std::find(queue_.begin(), queue_.end(), job);
+        if (it != queue_.end())
+            queue_.erase(it);
+    }
+}
+
+ThreadPool::Statistics ThreadPool::GetStatistics() const
+{
+    Statistics stats;
+    {
+        stats.numWorkerThreads  = numWorkerThreads_.load();
+        stats.numJobs           = numJobs_.load();
+        stats.numChunks         = numChunks_.load();
+        stats.numStolenChunks   = numStolenChunks_.load();
+    }
+    return stats;
+}
+
+void ThreadPool::ResetStatistics()
+{
+    numJobs_.store(0);
+    numChunks_.store(0);
+    numStolenChunks_.store(0);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void ThreadPool::CreateWorkerThreads()
+{
+    workers_.reserve(maxNumWorkerThreads_);
+    for (std::size_t i = 0; i < maxNumWorkerThreads_; ++i)
+        workers_.emplace_back(&ThreadPool::WorkerThreadProc, this);
+    numWorkerThreads_.store(workers_.size());
+}
+
+void ThreadPool::WorkerThreadProc()
+{
+    while (true)
+    {
+        JobPtr job;
+        std::size_t slot = 0;
+
+        {
+            /* Wait for next job */
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueVar_.wait(lock, [this]{ return (stop_ || !queue_.empty()); });
+
+            if (stop_)
+                return;
+
+            /* Take next free slot of this job, and remove it from the queue once all slots are taken */
+            job = queue_.front();
+            slot = job->nextSlot++;
+
+            if (job->nextSlot >= job->numRanges)
+                queue_.pop_front();
+        }
+
+        ProcessJob(*job, slot);
+    }
+}
+
+void ThreadPool::ProcessJob(Job& job, std::size_t slot)
+{
+    /* Process own chunks first */
+    while (ProcessChunkRange(job, job.ranges[slot]))
+    {
+        /* Continue with next chunk */
+    }
+
+    /* Steal remaining chunks from the other threads */
+    for (std::size_t i = 1; i < job.numRanges; ++i)
+    {
+        auto& range = job.ranges[(slot + i) % job.numRanges];
+        while (ProcessChunkRange(job, range))
+            ++numStolenChunks_;
+    }
+}
+
+// Processes the next chunk of the specified range. Returns false if no chunk was left in this range.
+bool ThreadPool::ProcessChunkRange(Job& job, ChunkRange& range)
+{
+    auto chunk = range.next.fetch_add(1);
+    if (chunk >= range.end)
+        return false;
+
+    /* Run task for this chunk */
+    auto idxBegin   = chunk * job.chunkSize;
+    auto idxEnd     = std::min(idxBegin + job.chunkSize, job.count);
+
+    (*job.task)(idxBegin, idxEnd);
+
+    ++numChunks_;
+
+    /* Notify waiting thread when the last chunk is done */
+    if (--job.chunksPending == 0)
+    {
+        std::lock_guard<std::mutex> lock(job.doneMutex);
+        job.doneVar.notify_all();
+    }
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,123 @@
+/*
+ * ThreadPool.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_THREAD_POOL_H__
+#define __LLGL_THREAD_POOL_H__
+
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <deque>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Persistent pool of worker threads for data parallel tasks.
+\remarks Each task is split into chunks which are distributed over the participating threads.
+Threads that run out of chunks steal the remaining chunks of other threads.
+The worker threads are created on the first call to "ParallelFor" and are reused afterwards.
+*/
+class ThreadPool
+{
+
+    public:
+
+        //! Task procedure for the entries in the range [idxBegin, idxEnd).
+        using Task = std::function<void(std::size_t idxBegin, std::size_t idxEnd)>;
+
+        //! Pool statistics structure.
+        struct Statistics
+        {
+            std::size_t numWorkerThreads    = 0;
+            std::size_t numJobs             = 0;
+            std::size_t numChunks           = 0;
+            std::size_t numStolenChunks     = 0;
+        };
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator = (const ThreadPool&) = delete;
+
+        //! Initializes the pool with the specified maximal number of worker threads. No threads are created yet.
+        ThreadPool(std::size_t maxNumWorkerThreads);
+        ~ThreadPool();
+
+        /**
+        \brief Runs the specified task for the entries in the range [0, count) on at most 'threadCount' threads.
+        \param[in] minChunkSize Specifies the minimal number of entries each chunk shall contain.
+        \remarks The calling thread participates in the work and this function returns once all entries have been processed.
+        This function is thread-safe.
+        */
+        void ParallelFor(std::size_t count, std::size_t threadCount, std::size_t minChunkSize, const Task& task);
+
+        //! Returns the current statistics of this pool.
+        Statistics GetStatistics() const;
+
+        //! Resets the job and chunk counters of the statistics.
+        void ResetStatistics();
+
+    private:
+
+        struct ChunkRange
+        {
+            std::atomic<std::size_t>    next;
+            std::size_t                 end;
+        };
+
+        struct Job
+        {
+            const Task*                     task            = nullptr;
+            std::size_t                     count           = 0;
+            std::size_t                     chunkSize       = 0;
+            std::size_t                     numRanges       = 0;
+            std::unique_ptr<ChunkRange[]>   ranges;
+            std::size_t                     nextSlot        = 1;
+            std::atomic<std::size_t>        chunksPending;
+            std::mutex                      doneMutex;
+            std::condition_variable         doneVar;
+        };
+
+        using JobPtr = std::shared_ptr<Job>;
+
+        void CreateWorkerThreads();
+        void WorkerThreadProc();
+
+        void ProcessJob(Job& job, std::size_t slot);
+        bool ProcessChunkRange(Job& job, ChunkRange& range);
+
+        std::size_t                 maxNumWorkerThreads_    = 0;
+        std::vector<std::thread>    workers_;
+        std::once_flag              workersCreated_;
+
+        std::mutex                  queueMutex_;
+        std::condition_variable     queueVar_;
+        std::deque<JobPtr>          queue_;
+        bool                        stop_                   = false;
+
+        std::atomic<std::size_t>    numWorkerThreads_;
+        std::atomic<std::size_t>    numJobs_;
+        std::atomic<std::size_t>    numChunks_;
+        std::atomic<std::size_t>    numStolenChunks_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
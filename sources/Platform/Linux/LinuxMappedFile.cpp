@@ -0,0 +1,80 @@
+/*
+ * LinuxMappedFile.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "LinuxMappedFile.h"
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace LLGL
+{
+
+
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& filename)
+{
+    return std::unique_ptr<MappedFile>(new LinuxMappedFile(filename));
+}
+
+LinuxMappedFile::LinuxMappedFile(const std::string& filename)
+{
+    /* Open file for reading */
+    auto fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1)
+        throw std::runtime_error("failed to open file \"" + filename + "\"");
+
+    /* Query file size (empty files can not be mapped) */
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == -1)
+    {
+        close(fd);
+        throw std::runtime_error("failed to query size of file \"" + filename + "\"");
+    }
+
+    size_ = static_cast<std::size_t>(fileStat.st_size);
+
+    if (size_ > 0)
+    {
+        /* Map entire file into memory (the mapping stays valid after the file descriptor is closed) */
+        data_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data_ == MAP_FAILED)
+        {
+            close(fd);
+            throw std::runtime_error("failed to map file \"" + filename + "\" into memory");
+        }
+
+        /* File content is usually read front to back */
+        madvise(data_, size_, MADV_SEQUENTIAL);
+    }
+
+    close(fd);
+}
+
+LinuxMappedFile::~LinuxMappedFile()
+{
+    if (data_)
+        munmap(data_, size_);
+}
+
+const void* LinuxMappedFile::GetData() const
+{
+    return data_;
+}
+
+std::size_t LinuxMappedFile::GetSize() const
+{
+    return size_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
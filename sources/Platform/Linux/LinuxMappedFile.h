@@ -0,0 +1,48 @@
+/*
+ * LinuxMappedFile.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_LINUX_MAPPED_FILE_H__
+#define __LLGL_LINUX_MAPPED_FILE_H__
+
+
+#include "../MappedFile.h"
+
+
+namespace LLGL
+{
+
+
+class LinuxMappedFile : public MappedFile
+{
+
+    public:
+
+        LinuxMappedFile(const std::string& filename);
+        ~LinuxMappedFile();
+
+        LinuxMappedFile(const LinuxMappedFile&) = delete;
+        LinuxMappedFile& operator = (const LinuxMappedFile&) = delete;
+
+        const void* GetData() const override;
+        std::size_t GetSize() const override;
+
+    private:
+
+        void*       data_ = nullptr;
+        std::size_t size_ = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
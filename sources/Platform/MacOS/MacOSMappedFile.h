@@ -0,0 +1,48 @@
+/*
+ * MacOSMappedFile.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_MACOS_MAPPED_FILE_H__
+#define __LLGL_MACOS_MAPPED_FILE_H__
+
+
+#include "../MappedFile.h"
+
+
+namespace LLGL
+{
+
+
+class MacOSMappedFile : public MappedFile
+{
+
+    public:
+
+        MacOSMappedFile(const std::string& filename);
+        ~MacOSMappedFile();
+
+        MacOSMappedFile(const MacOSMappedFile&) = delete;
+        MacOSMappedFile& operator = (const MacOSMappedFile&) = delete;
+
+        const void* GetData() const override;
+        std::size_t GetSize() const override;
+
+    private:
+
+        void*       data_ = nullptr;
+        std::size_t size_ = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,58 @@
+/*
+ * MappedFile.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_MAPPED_FILE_H__
+#define __LLGL_MAPPED_FILE_H__
+
+
+#include <memory>
+#include <string>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+//! Read-only memory-mapped file class (the file content is paged in on demand by the operating system).
+class MappedFile
+{
+
+    public:
+
+        MappedFile() = default;
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator = (const MappedFile&) = delete;
+
+        virtual ~MappedFile()
+        {
+        }
+
+        /**
+        \brief Maps the entire content of the specified file into memory for reading.
+        \throw std::runtime_error If the file could not be opened or mapped.
+        */
+        static std::unique_ptr<MappedFile> Open(const std::string& filename);
+
+        //! Returns a pointer to the beginning of the mapped file content, or null if the file is empty.
+        virtual const void* GetData() const = 0;
+
+        //! Returns the size (in bytes) of the mapped file content.
+        virtual std::size_t GetSize() const = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,84 @@
+/*
+ * Win32MappedFile.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Win32MappedFile.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& filename)
+{
+    return std::unique_ptr<MappedFile>(new Win32MappedFile(filename));
+}
+
+Win32MappedFile::Win32MappedFile(const std::string& filename)
+{
+    /* Open file for reading */
+    HANDLE file = CreateFileA(
+        filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+    );
+
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("failed to open file \"" + filename + "\"");
+
+    /* Query file size (empty files can not be mapped) */
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        throw std::runtime_error("failed to query size of file \"" + filename + "\"");
+    }
+
+    size_ = static_cast<std::size_t>(fileSize.QuadPart);
+
+    if (size_ > 0)
+    {
+        /* Map entire file into memory (the mapping keeps its own reference to the file) */
+        mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_)
+            data_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+
+        if (!data_)
+        {
+            if (mapping_)
+                CloseHandle(mapping_);
+            CloseHandle(file);
+            throw std::runtime_error("failed to map file \"" + filename + "\" into memory");
+        }
+    }
+
+    CloseHandle(file);
+}
+
+Win32MappedFile::~Win32MappedFile()
+{
+    if (data_)
+        UnmapViewOfFile(data_);
+    if (mapping_)
+        CloseHandle(mapping_);
+}
+
+const void* Win32MappedFile::GetData() const
+{
+    return data_;
+}
+
+std::size_t Win32MappedFile::GetSize() const
+{
+    return size_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,51 @@
+/*
+ * Win32MappedFile.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_WIN32_MAPPED_FILE_H__
+#define __LLGL_WIN32_MAPPED_FILE_H__
+
+
+#include "../MappedFile.h"
+
+#include <Windows.h>
+
+
+namespace LLGL
+{
+
+
+class Win32MappedFile : public MappedFile
+{
+
+    public:
+
+        Win32MappedFile(const std::string& filename);
+        ~Win32MappedFile();
+
+        Win32MappedFile(const Win32MappedFile&) = delete;
+        Win32MappedFile& operator = (const Win32MappedFile&) = delete;
+
+        const void* GetData() const override;
+        std::size_t GetSize() const override;
+
+    private:
+
+        HANDLE      mapping_    = 0;
+        LPVOID      data_       = nullptr;
+        std::size_t size_       = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,215 @@
+/*
+ * BufferPool.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/BufferPool.h>
+#include <LLGL/RenderSystem.h>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal functions ----- */
+
+// Allocates a contiguous range with the first-fit strategy and returns the first element of this range.
+static unsigned int AllocFreeRange(std::map<unsigned int, unsigned int>& freeRanges, unsigned int count, const char* elementName)
+{
+    for (auto it = freeRanges.begin(); it != freeRanges.end(); ++it)
+    {
+        if (it->second >= count)
+        {
+            auto first      = it->first;
+            auto remaining  = it->second - count;
+
+            freeRanges.erase(it);
+            if (remaining > 0)
+                freeRanges[first + count] = remaining;
+
+            return first;
+        }
+    }
+    throw std::out_of_range(
+        "no free contiguous range for " + std::to_string(count) + " " + std::string(elementName) + " in buffer pool"
+    );
+}
+
+// Releases the specified range and merges it with its adjacent free ranges.
+static void FreeRange(std::map<unsigned int, unsigned int>& freeRanges, unsigned int first, unsigned int count)
+{
+    /* Merge with succeeding free range */
+    auto next = freeRanges.find(first + count);
+    if (next != freeRanges.end())
+    {
+        count += next->second;
+        freeRanges.erase(next);
+    }
+
+    /* Merge with preceding free range */
+    auto it = freeRanges.lower_bound(first);
+    if (it != freeRanges.begin())
+    {
+        auto prev = std::prev(it);
+        if (prev->first + prev->second == first)
+        {
+            prev->second += count;
+            return;
+        }
+    }
+
+    freeRanges[first] = count;
+}
+
+// Returns the size (in bytes) of a buffer with the specified number of elements, and throws if it exceeds the range of BufferDescriptor::size.
+static unsigned int GetBufferSize(unsigned int numElements, unsigned int stride, const char* elementName)
+{
+    auto size = static_cast<std::size_t>(numElements) * stride;
+    if ((stride > 0 && size / stride != numElements) || size > std::numeric_limits<unsigned int>::max())
+    {
+        throw std::invalid_argument(
+            "buffer pool size for " + std::to_string(numElements) + " " + std::string(elementName) + " exceeds the maximal buffer size"
+        );
+    }
+    return static_cast<unsigned int>(size);
+}
+
+
+/* ----- BufferPool class ----- */
+
+BufferPool::BufferPool(RenderSystem& renderSystem, const BufferPoolDescriptor& desc) :
+    renderSystem_   ( renderSystem                     ),
+    vertexStride_   ( desc.vertexFormat.stride         ),
+    indexStride_    ( desc.indexFormat.GetFormatSize() )
+{
+    if (desc.numVertices == 0)
+        throw std::invalid_argument("cannot create buffer pool with zero vertices");
+    if (vertexStride_ == 0)
+        throw std::invalid_argument("cannot create buffer pool with vertex format of zero stride");
+
+    /* Create shared vertex buffer */
+    BufferDescriptor vertexBufferDesc;
+    {
+        vertexBufferDesc.type                   = BufferType::Vertex;
+        vertexBufferDesc.size                   = GetBufferSize(desc.numVertices, vertexStride_, "vertices");
+        vertexBufferDesc.flags                  = desc.flags;
+        vertexBufferDesc.vertexBuffer.format    = desc.vertexFormat;
+    }
+    vertexBuffer_ = renderSystem_.CreateBuffer(vertexBufferDesc);
+
+    freeVertexRanges_[0]    = desc.numVertices;
+    numFreeVertices_        = desc.numVertices;
+
+    /* Create shared index buffer */
+    if (desc.numIndices > 0)
+    {
+        try
+        {
+            BufferDescriptor indexBufferDesc;
+            {
+                indexBufferDesc.type                = BufferType::Index;
+                indexBufferDesc.size                = GetBufferSize(desc.numIndices, indexStride_, "indices");
+                indexBufferDesc.flags               = desc.flags;
+                indexBufferDesc.indexBuffer.format  = desc.indexFormat;
+            }
+            indexBuffer_ = renderSystem_.CreateBuffer(indexBufferDesc);
+        }
+        catch (...)
+        {
+            /* Release the vertex buffer, since the destructor is not called when the constructor throws */
+            renderSystem_.Release(*vertexBuffer_);
+            throw;
+        }
+
+        freeIndexRanges_[0] = desc.numIndices;
+        numFreeIndices_     = desc.numIndices;
+    }
+}
+
+BufferPool::~BufferPool()
+{
+    if (indexBuffer_)
+        renderSystem_.Release(*indexBuffer_);
+    renderSystem_.Release(*vertexBuffer_);
+}
+
+BufferPoolRange BufferPool::Alloc(unsigned int numVertices, const void* vertexData, unsigned int numIndices, const void* indexData)
+{
+    if (numVertices == 0)
+        throw std::invalid_argument("cannot allocate buffer pool range with zero vertices");
+    if (numIndices > 0 && !indexBuffer_)
+        throw std::invalid_argument("cannot allocate indices from buffer pool without index buffer");
+
+    BufferPoolRange range;
+
+    /* Allocate vertex and index range */
+    range.firstVertex   = AllocFreeRange(freeVertexRanges_, numVertices, "vertices");
+    range.numVertices   = numVertices;
+
+    if (numIndices > 0)
+    {
+        try
+        {
+            range.firstIndex = AllocFreeRange(freeIndexRanges_, numIndices, "indices");
+        }
+        catch (const std::out_of_range&)
+        {
+            FreeRange(freeVertexRanges_, range.firstVertex, numVertices);
+            throw;
+        }
+        range.numIndices = numIndices;
+    }
+
+    numFreeVertices_    -= range.numVertices;
+    numFreeIndices_     -= range.numIndices;
+
+    /* Write initial data into the allocated ranges */
+    if (vertexData)
+    {
+        renderSystem_.WriteBuffer(
+            *vertexBuffer_,
+            vertexData,
+            static_cast<std::size_t>(numVertices) * vertexStride_,
+            static_cast<std::size_t>(range.firstVertex) * vertexStride_
+        );
+    }
+
+    if (indexData && numIndices > 0)
+    {
+        renderSystem_.WriteBuffer(
+            *indexBuffer_,
+            indexData,
+            static_cast<std::size_t>(numIndices) * indexStride_,
+            static_cast<std::size_t>(range.firstIndex) * indexStride_
+        );
+    }
+
+    return range;
+}
+
+void BufferPool::Free(const BufferPoolRange& range)
+{
+    if (range.numVertices > 0)
+    {
+        FreeRange(freeVertexRanges_, range.firstVertex, range.numVertices);
+        numFreeVertices_ += range.numVertices;
+    }
+    if (range.numIndices > 0)
+    {
+        FreeRange(freeIndexRanges_, range.firstIndex, range.numIndices);
+        numFreeIndices_ += range.numIndices;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
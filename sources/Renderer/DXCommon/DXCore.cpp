@@ -166,9 +166,11 @@ void DXGetRenderingCaps(RenderingCaps& caps, D3D_FEATURE_LEVEL featureLevel)
     caps.hasViewportArrays              = true;
     caps.hasConservativeRasterization   = (featureLevel >= D3D_FEATURE_LEVEL_11_1);
     caps.hasStreamOutputs               = (featureLevel >= D3D_FEATURE_LEVEL_10_0);
+    caps.hasIndirectDrawing             = (featureLevel >= D3D_FEATURE_LEVEL_11_0);
     caps.maxNumTextureArrayLayers       = (featureLevel >= D3D_FEATURE_LEVEL_10_0 ? 2048 : 256);
     caps.maxNumRenderTargetAttachments  = GetMaxRenderTargets(featureLevel);
     caps.maxConstantBufferSize          = 16384;
+    caps.constantBufferOffsetAlignment  = 256;
     caps.maxPatchVertices               = 32;
     caps.max1DTextureSize               = GetMaxTextureDimension(featureLevel);
     caps.max2DTextureSize               = GetMaxTextureDimension(featureLevel);
@@ -349,6 +351,7 @@ D3DTextureFormatDescriptor DXGetTextureFormatDesc(DXGI_FORMAT format)
         case DXGI_FORMAT_R16_SNORM:             return { ImageFormat::R,                DataType::Int16  };
         case DXGI_FORMAT_R32_UINT:              return { ImageFormat::R,                DataType::UInt32 };
         case DXGI_FORMAT_R32_SINT:              return { ImageFormat::R,                DataType::Int32  };
+        case DXGI_FORMAT_R16_FLOAT:             return { ImageFormat::R,                DataType::Float16 };
         case DXGI_FORMAT_R32_FLOAT:             return { ImageFormat::R,                DataType::Float  };
         case DXGI_FORMAT_R8G8_UNORM:            return { ImageFormat::RG,               DataType::UInt8  };
         case DXGI_FORMAT_R8G8_SNORM:            return { ImageFormat::RG,               DataType::Int8   };
@@ -356,6 +359,7 @@ D3DTextureFormatDescriptor DXGetTextureFormatDesc(DXGI_FORMAT format)
         case DXGI_FORMAT_R16G16_SNORM:          return { ImageFormat::RG,               DataType::Int16  };
         case DXGI_FORMAT_R32G32_UINT:           return { ImageFormat::RG,               DataType::UInt32 };
         case DXGI_FORMAT_R32G32_SINT:           return { ImageFormat::RG,               DataType::Int32  };
+        case DXGI_FORMAT_R16G16_FLOAT:          return { ImageFormat::RG,               DataType::Float16 };
         case DXGI_FORMAT_R32G32_FLOAT:          return { ImageFormat::RG,               DataType::Float  };
         case DXGI_FORMAT_R32G32B32_UINT:        return { ImageFormat::RGB,              DataType::UInt32 };
         case DXGI_FORMAT_R32G32B32_SINT:        return { ImageFormat::RGB,              DataType::Int32  };
@@ -366,6 +370,7 @@ D3DTextureFormatDescriptor DXGetTextureFormatDesc(DXGI_FORMAT format)
         case DXGI_FORMAT_R16G16B16A16_SNORM:    return { ImageFormat::RGBA,             DataType::Int16  };
         case DXGI_FORMAT_R32G32B32A32_UINT:     return { ImageFormat::RGBA,             DataType::UInt32 };
         case DXGI_FORMAT_R32G32B32A32_SINT:     return { ImageFormat::RGBA,             DataType::Int32  };
+        case DXGI_FORMAT_R16G16B16A16_FLOAT:    return { ImageFormat::RGBA,             DataType::Float16 };
         case DXGI_FORMAT_R32G32B32A32_FLOAT:    return { ImageFormat::RGBA,             DataType::Float  };
         case DXGI_FORMAT_BC1_UNORM:             return { ImageFormat::CompressedRGB,    DataType::UInt8  };
         case DXGI_FORMAT_BC2_UNORM:             return { ImageFormat::CompressedRGBA,   DataType::UInt8  };
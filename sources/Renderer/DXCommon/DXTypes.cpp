@@ -45,6 +45,10 @@ DXGI_FORMAT Map(const VectorType vectorType)
         case VectorType::UInt2:     return DXGI_FORMAT_R32G32_UINT;
         case VectorType::UInt3:     return DXGI_FORMAT_R32G32B32_UINT;
         case VectorType::UInt4:     return DXGI_FORMAT_R32G32B32A32_UINT;
+        case VectorType::Half:      return DXGI_FORMAT_R16_FLOAT;
+        case VectorType::Half2:     return DXGI_FORMAT_R16G16_FLOAT;
+        case VectorType::Half3:     break;
+        case VectorType::Half4:     return DXGI_FORMAT_R16G16B16A16_FLOAT;
     }
     MapFailed("VectorType", "DXGI_FORMAT");
 }
@@ -59,6 +63,7 @@ DXGI_FORMAT Map(const DataType dataType)
         case DataType::UInt16:  return DXGI_FORMAT_R16_UINT;
         case DataType::Int32:   return DXGI_FORMAT_R32_SINT;
         case DataType::UInt32:  return DXGI_FORMAT_R32_UINT;
+        case DataType::Float16: return DXGI_FORMAT_R16_FLOAT;
         case DataType::Float:   return DXGI_FORMAT_R32_FLOAT;
         case DataType::Double:  break;
     }
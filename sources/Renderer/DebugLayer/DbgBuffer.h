@@ -29,8 +29,14 @@ class DbgBuffer : public Buffer
 
         LLGL::Buffer&       instance;
         BufferDescriptor    desc;
-        unsigned int        elements    = 0;
-        bool                initialized = false;
+        unsigned int        elements        = 0;
+        bool                initialized     = false;
+
+        // Buffer range which is currently mapped with "MapBufferRange"
+        bool                rangeMapped     = false;
+        std::size_t         mappedOffset    = 0;
+        std::size_t         mappedSize      = 0;
+        long                mappedFlags     = 0;
 
 };
 
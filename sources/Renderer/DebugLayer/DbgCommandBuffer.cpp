@@ -17,6 +17,8 @@
 #include "DbgShaderProgram.h"
 #include "DbgQuery.h"
 
+#include <algorithm>
+
 
 namespace LLGL
 {
@@ -171,6 +173,36 @@ void DbgCommandBuffer::SetConstantBufferArray(BufferArray& bufferArray, unsigned
     LLGL_DBG_PROFILER_DO(setConstantBuffer.Inc());
 }
 
+void DbgCommandBuffer::SetConstantBufferRange(Buffer& buffer, unsigned int slot, std::size_t offset, std::size_t size, long shaderStageFlags)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugBufferType(buffer.GetType(), BufferType::Constant);
+        DebugShaderStageFlags(shaderStageFlags, ShaderStageFlags::AllStages);
+
+        if (size == 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "constant buffer range must not be empty");
+
+        auto alignment = caps_.constantBufferOffsetAlignment;
+        if (alignment > 0 && offset % alignment != 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "constant buffer range offset is not a multiple of the offset alignment (" + std::to_string(alignment) + " bytes)"
+            );
+        }
+
+        DebugBufferRange(bufferDbg, offset, size, "constant buffer");
+    }
+
+    instance.SetConstantBufferRange(bufferDbg.instance, slot, offset, size, shaderStageFlags);
+
+    LLGL_DBG_PROFILER_DO(setConstantBuffer.Inc());
+}
+
 void DbgCommandBuffer::SetStorageBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags)
 {
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
@@ -258,6 +290,29 @@ void DbgCommandBuffer::EndStreamOutput()
     instance.EndStreamOutput();
 }
 
+void DbgCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::size_t dstOffset, Buffer& srcBuffer, std::size_t srcOffset, std::size_t size)
+{
+    auto& dstBufferDbg = LLGL_CAST(DbgBuffer&, dstBuffer);
+    auto& srcBufferDbg = LLGL_CAST(DbgBuffer&, srcBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+
+        DebugBufferRange(srcBufferDbg, srcOffset, size, "source");
+        DebugBufferRange(dstBufferDbg, dstOffset, size, "destination");
+
+        if (&dstBuffer == &srcBuffer && srcOffset < dstOffset + size && dstOffset < srcOffset + size)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "overlapping source and destination range in buffer copy");
+        if (size == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "buffer copy with zero size");
+    }
+
+    instance.CopyBuffer(dstBufferDbg.instance, dstOffset, srcBufferDbg.instance, srcOffset, size);
+
+    LLGL_DBG_PROFILER_DO(copyBuffer.Inc());
+}
+
 /* ----- Textures ----- */
 
 void DbgCommandBuffer::SetTexture(Texture& texture, unsigned int slot, long shaderStageFlags)
@@ -288,6 +343,52 @@ void DbgCommandBuffer::SetTextureArray(TextureArray& textureArray, unsigned int
     LLGL_DBG_PROFILER_DO(setTexture.Inc());
 }
 
+void DbgCommandBuffer::CopyTexture(Texture& dstTexture, Texture& srcTexture)
+{
+    auto& dstTextureDbg = LLGL_CAST(DbgTexture&, dstTexture);
+    auto& srcTextureDbg = LLGL_CAST(DbgTexture&, srcTexture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+
+        if (dstTexture.GetType() != srcTexture.GetType())
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "mismatch between source and destination texture type in texture copy");
+        if (dstTextureDbg.desc.format != srcTextureDbg.desc.format)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "mismatch between source and destination texture format in texture copy");
+        if (dstTextureDbg.mipLevels != srcTextureDbg.mipLevels)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "mismatch between source and destination MIP-map levels in texture copy");
+    }
+
+    instance.CopyTexture(dstTextureDbg.instance, srcTextureDbg.instance);
+
+    LLGL_DBG_PROFILER_DO(copyTexture.Inc());
+}
+
+void DbgCommandBuffer::CopyTextureRegion(
+    Texture& dstTexture, const TextureLocation& dstLocation,
+    Texture& srcTexture, const TextureLocation& srcLocation,
+    const Gs::Vector3ui& extent, unsigned int numLayers)
+{
+    auto& dstTextureDbg = LLGL_CAST(DbgTexture&, dstTexture);
+    auto& srcTextureDbg = LLGL_CAST(DbgTexture&, srcTexture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+
+        DebugTextureLocation(srcTextureDbg, srcLocation, "source");
+        DebugTextureLocation(dstTextureDbg, dstLocation, "destination");
+
+        if (extent.x == 0 || extent.y == 0 || extent.z == 0 || numLayers == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "texture copy with empty region");
+    }
+
+    instance.CopyTextureRegion(dstTextureDbg.instance, dstLocation, srcTextureDbg.instance, srcLocation, extent, numLayers);
+
+    LLGL_DBG_PROFILER_DO(copyTexture.Inc());
+}
+
 /* ----- Sampler States ----- */
 
 void DbgCommandBuffer::SetSampler(Sampler& sampler, unsigned int slot, long shaderStageFlags)
@@ -531,6 +632,118 @@ void DbgCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned i
     LLGL_DBG_PROFILER_DO(RecordDrawCall(topology_, numVertices, numInstances));
 }
 
+void DbgCommandBuffer::MultiDraw(const DrawArguments* argsArray, unsigned int numDraws)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugMultiDraw(argsArray, numDraws);
+    }
+
+    instance.MultiDraw(argsArray, numDraws);
+
+    if (profiler_ && argsArray)
+    {
+        for (unsigned int i = 0; i < numDraws; ++i)
+            profiler_->RecordDrawCall(topology_, argsArray[i].numVertices);
+    }
+}
+
+void DbgCommandBuffer::MultiDrawIndexed(const DrawIndexedArguments* argsArray, unsigned int numDraws)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugMultiDrawIndexed(argsArray, numDraws);
+    }
+
+    instance.MultiDrawIndexed(argsArray, numDraws);
+
+    if (profiler_ && argsArray)
+    {
+        for (unsigned int i = 0; i < numDraws; ++i)
+            profiler_->RecordDrawCall(topology_, argsArray[i].numIndices);
+    }
+}
+
+void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::size_t offset)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugIndirectDrawing();
+        DebugGraphicsPipelineSet();
+        DebugVertexBufferSet();
+        DebugVertexLayout();
+        DebugIndirectArguments(bufferDbg, offset, 1, 0, sizeof(DrawIndirectArguments));
+    }
+
+    instance.DrawIndirect(bufferDbg.instance, offset);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc());
+}
+
+void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::size_t offset)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugIndirectDrawing();
+        DebugGraphicsPipelineSet();
+        DebugVertexBufferSet();
+        DebugIndexBufferSet();
+        DebugVertexLayout();
+        DebugIndirectArguments(bufferDbg, offset, 1, 0, sizeof(DrawIndexedIndirectArguments));
+    }
+
+    instance.DrawIndexedIndirect(bufferDbg.instance, offset);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc());
+}
+
+void DbgCommandBuffer::MultiDrawIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugIndirectDrawing();
+        DebugGraphicsPipelineSet();
+        DebugVertexBufferSet();
+        DebugVertexLayout();
+        DebugIndirectArguments(bufferDbg, offset, numCommands, stride, sizeof(DrawIndirectArguments));
+    }
+
+    instance.MultiDrawIndirect(bufferDbg.instance, offset, numCommands, stride);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc(numCommands));
+}
+
+void DbgCommandBuffer::MultiDrawIndexedIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugIndirectDrawing();
+        DebugGraphicsPipelineSet();
+        DebugVertexBufferSet();
+        DebugIndexBufferSet();
+        DebugVertexLayout();
+        DebugIndirectArguments(bufferDbg, offset, numCommands, stride, sizeof(DrawIndexedIndirectArguments));
+    }
+
+    instance.MultiDrawIndexedIndirect(bufferDbg.instance, offset, numCommands, stride);
+
+    LLGL_DBG_PROFILER_DO(drawCalls.Inc(numCommands));
+}
+
 /* ----- Compute ----- */
 
 void DbgCommandBuffer::DebugThreadGroupLimit(unsigned int size, unsigned int limit)
@@ -565,6 +778,22 @@ void DbgCommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSizeY
     LLGL_DBG_PROFILER_DO(dispatchComputeCalls.Inc());
 }
 
+void DbgCommandBuffer::DispatchIndirect(Buffer& buffer, std::size_t offset)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugComputePipelineSet();
+        DebugIndirectArguments(bufferDbg, offset, 1, 0, sizeof(DispatchIndirectArguments));
+    }
+
+    instance.DispatchIndirect(bufferDbg.instance, offset);
+
+    LLGL_DBG_PROFILER_DO(dispatchComputeCalls.Inc());
+}
+
 /* ----- Misc ----- */
 
 void DbgCommandBuffer::SyncGPU()
@@ -727,12 +956,96 @@ void DbgCommandBuffer::DebugDrawIndexed(
         DebugVertexLimit(numVertices + firstIndex, static_cast<unsigned int>(bindings_.indexBuffer->elements));
 }
 
+void DbgCommandBuffer::DebugMultiDraw(const DrawArguments* argsArray, unsigned int numDraws)
+{
+    /* Validate bindings only once for all draw commands */
+    DebugGraphicsPipelineSet();
+    DebugVertexBufferSet();
+    DebugVertexLayout();
+
+    if (numDraws == 0)
+        LLGL_DBG_WARN(WarningType::PointlessOperation, "no draw commands will be generated");
+    else if (!argsArray)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid array of draw arguments");
+    else
+    {
+        /* Validate vertex counts and determine the vertex range of all draw commands */
+        unsigned int vertexCount = 0;
+
+        for (unsigned int i = 0; i < numDraws; ++i)
+        {
+            DebugNumVertices(argsArray[i].numVertices);
+            vertexCount = std::max(vertexCount, argsArray[i].numVertices + argsArray[i].firstVertex);
+        }
+
+        if (bindings_.vertexBuffer)
+            DebugVertexLimit(vertexCount, static_cast<unsigned int>(bindings_.vertexBuffer->elements));
+    }
+}
+
+void DbgCommandBuffer::DebugMultiDrawIndexed(const DrawIndexedArguments* argsArray, unsigned int numDraws)
+{
+    /* Validate bindings only once for all draw commands */
+    DebugGraphicsPipelineSet();
+    DebugVertexBufferSet();
+    DebugIndexBufferSet();
+    DebugVertexLayout();
+
+    if (numDraws == 0)
+        LLGL_DBG_WARN(WarningType::PointlessOperation, "no draw commands will be generated");
+    else if (!argsArray)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid array of draw arguments");
+    else
+    {
+        /* Validate index counts and determine the index range of all draw commands */
+        unsigned int indexCount = 0;
+
+        for (unsigned int i = 0; i < numDraws; ++i)
+        {
+            DebugNumVertices(argsArray[i].numIndices);
+            indexCount = std::max(indexCount, argsArray[i].numIndices + argsArray[i].firstIndex);
+        }
+
+        if (bindings_.indexBuffer)
+            DebugVertexLimit(indexCount, static_cast<unsigned int>(bindings_.indexBuffer->elements));
+    }
+}
+
 void DbgCommandBuffer::DebugInstancing()
 {
     if (!caps_.hasInstancing)
         LLGL_DBG_ERROR_NOT_SUPPORTED("instancing");
 }
 
+void DbgCommandBuffer::DebugIndirectDrawing()
+{
+    if (!caps_.hasIndirectDrawing)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing");
+}
+
+void DbgCommandBuffer::DebugIndirectArguments(
+    const DbgBuffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride, std::size_t argumentsSize)
+{
+    DebugBufferType(buffer.GetType(), BufferType::Indirect);
+
+    /* Validate alignment of argument structures */
+    if (offset % 4 != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "indirect argument offset is not a multiple of 4 bytes");
+
+    if (stride == 0)
+        stride = static_cast<unsigned int>(argumentsSize);
+    else if (stride % 4 != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "indirect argument stride is not a multiple of 4 bytes");
+    else if (stride < argumentsSize)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "indirect argument stride is less than the size of an argument structure");
+
+    /* Validate range of all argument structures at once */
+    if (numCommands == 0)
+        LLGL_DBG_WARN(WarningType::PointlessOperation, "no draw commands will be generated");
+    else
+        DebugBufferRange(buffer, offset, static_cast<std::size_t>(numCommands - 1) * stride + argumentsSize, "indirect argument");
+}
+
 void DbgCommandBuffer::DebugVertexLimit(unsigned int vertexCount, unsigned int vertexLimit)
 {
     if (vertexCount > vertexLimit)
@@ -753,6 +1066,30 @@ void DbgCommandBuffer::DebugShaderStageFlags(long shaderStageFlags, long validFl
         LLGL_DBG_WARN(WarningType::PointlessOperation, "unknown shader stage flag is specified");
 }
 
+void DbgCommandBuffer::DebugBufferRange(const DbgBuffer& buffer, std::size_t offset, std::size_t size, const char* rangeName)
+{
+    if (offset + size > buffer.desc.size)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            std::string(rangeName) + " range out of bounds (" + std::to_string(offset + size) +
+            " specified but limit is " + std::to_string(buffer.desc.size) + ")"
+        );
+    }
+}
+
+void DbgCommandBuffer::DebugTextureLocation(const DbgTexture& texture, const TextureLocation& location, const char* locationName)
+{
+    if (static_cast<int>(location.mipLevel) >= texture.mipLevels)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            std::string(locationName) + " mip level out of bounds (" + std::to_string(location.mipLevel) +
+            " specified but limit is " + std::to_string(texture.mipLevels - 1) + ")"
+        );
+    }
+}
+
 void DbgCommandBuffer::DebugBufferType(const BufferType bufferType, const BufferType compareType)
 {
     if (bufferType != compareType)
@@ -21,6 +21,7 @@ namespace LLGL
 
 
 class DbgBuffer;
+class DbgTexture;
 
 class DbgCommandBuffer : public CommandBuffer
 {
@@ -61,6 +62,7 @@ class DbgCommandBuffer : public CommandBuffer
         
         void SetConstantBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         void SetConstantBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetConstantBufferRange(Buffer& buffer, unsigned int slot, std::size_t offset, std::size_t size, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         
         void SetStorageBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         void SetStorageBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
@@ -71,11 +73,21 @@ class DbgCommandBuffer : public CommandBuffer
         void BeginStreamOutput(const PrimitiveType primitiveType) override;
         void EndStreamOutput() override;
 
+        void CopyBuffer(Buffer& dstBuffer, std::size_t dstOffset, Buffer& srcBuffer, std::size_t srcOffset, std::size_t size) override;
+
         /* ----- Textures ----- */
 
         void SetTexture(Texture& texture, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         void SetTextureArray(TextureArray& textureArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
 
+        void CopyTexture(Texture& dstTexture, Texture& srcTexture) override;
+
+        void CopyTextureRegion(
+            Texture& dstTexture, const TextureLocation& dstLocation,
+            Texture& srcTexture, const TextureLocation& srcLocation,
+            const Gs::Vector3ui& extent, unsigned int numLayers = 1
+        ) override;
+
         /* ----- Sampler States ----- */
 
         void SetSampler(Sampler& sampler, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
@@ -115,9 +127,19 @@ class DbgCommandBuffer : public CommandBuffer
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset) override;
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset) override;
 
+        void MultiDraw(const DrawArguments* argsArray, unsigned int numDraws) override;
+        void MultiDrawIndexed(const DrawIndexedArguments* argsArray, unsigned int numDraws) override;
+
+        void DrawIndirect(Buffer& buffer, std::size_t offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::size_t offset) override;
+
+        void MultiDrawIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride = 0) override;
+        void MultiDrawIndexedIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride = 0) override;
+
         /* ----- Compute ----- */
 
         void Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, std::size_t offset) override;
 
         /* ----- Misc ----- */
 
@@ -141,12 +163,19 @@ class DbgCommandBuffer : public CommandBuffer
         void DebugDraw(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int instanceOffset);
         void DebugDrawIndexed(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset);
 
+        void DebugMultiDraw(const DrawArguments* argsArray, unsigned int numDraws);
+        void DebugMultiDrawIndexed(const DrawIndexedArguments* argsArray, unsigned int numDraws);
+
         void DebugInstancing();
+        void DebugIndirectDrawing();
+        void DebugIndirectArguments(const DbgBuffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride, std::size_t argumentsSize);
         void DebugVertexLimit(unsigned int vertexCount, unsigned int vertexLimit);
         void DebugThreadGroupLimit(unsigned int size, unsigned int limit);
 
         void DebugShaderStageFlags(long shaderStageFlags, long validFlags);
         void DebugBufferType(const BufferType bufferType, const BufferType compareType);
+        void DebugBufferRange(const DbgBuffer& buffer, std::size_t offset, std::size_t size, const char* rangeName);
+        void DebugTextureLocation(const DbgTexture& texture, const TextureLocation& location, const char* locationName);
 
         void WarnImproperVertices(const std::string& topologyName, unsigned int unusedVertices);
 
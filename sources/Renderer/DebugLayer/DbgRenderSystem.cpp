@@ -9,6 +9,7 @@
 #include "DbgCore.h"
 #include "../../Core/Helper.h"
 #include "../CheckedCast.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -193,6 +194,112 @@ void DbgRenderSystem::UnmapBuffer(Buffer& buffer)
 {
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
     instance_->UnmapBuffer(bufferDbg.instance);
+    bufferDbg.rangeMapped = false;
+}
+
+void* DbgRenderSystem::MapBufferRange(Buffer& buffer, std::size_t offset, std::size_t size, long mapFlags)
+{
+    void* result = nullptr;
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugBufferSize(bufferDbg.desc.size, size, offset);
+        DebugBufferMapFlags(mapFlags);
+    }
+
+    result = instance_->MapBufferRange(bufferDbg.instance, offset, size, mapFlags);
+
+    /* Store mapped range to validate flushes, which are relative to the mapped range */
+    if (result)
+    {
+        bufferDbg.rangeMapped   = true;
+        bufferDbg.mappedOffset  = offset;
+        bufferDbg.mappedSize    = size;
+        bufferDbg.mappedFlags   = mapFlags;
+    }
+
+    LLGL_DBG_PROFILER_DO(mapBuffer.Inc());
+
+    return result;
+}
+
+void DbgRenderSystem::FlushMappedRange(Buffer& buffer, std::size_t offset, std::size_t size)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (!bufferDbg.rangeMapped)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot flush buffer range while no range is mapped with 'MapBufferRange'");
+        else if ((bufferDbg.mappedFlags & BufferMapFlags::ExplicitFlush) == 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot flush buffer range which is mapped without 'BufferMapFlags::ExplicitFlush'");
+        else if (offset + size > bufferDbg.mappedSize)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "flushed buffer range out of bounds of the mapped range");
+    }
+
+    instance_->FlushMappedRange(bufferDbg.instance, offset, size);
+}
+
+Readback* DbgRenderSystem::ReadBufferAsync(const Buffer& buffer, std::size_t offset, std::size_t size)
+{
+    auto& bufferDbg = LLGL_CAST(const DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugBufferSize(bufferDbg.desc.size, size, offset);
+    }
+
+    return instance_->ReadBufferAsync(bufferDbg.instance, offset, size);
+}
+
+/* ----- Streaming buffers ----- */
+
+StreamingBuffer* DbgRenderSystem::CreateStreamingBuffer(const StreamingBufferDescriptor& desc)
+{
+    /* Determine upper bound of the buffer size (each frame partition is aligned to the constant buffer offset alignment) */
+    auto alignment  = std::max(1u, GetRenderingCaps().constantBufferOffsetAlignment);
+    auto bufferSize = GetAlignedSize(desc.size, static_cast<std::size_t>(alignment)) * desc.numFrames;
+
+    return TakeOwnership(
+        streamingBuffers_,
+        MakeUnique<DbgStreamingBuffer>(*instance_->CreateStreamingBuffer(desc), desc, bufferSize)
+    );
+}
+
+void DbgRenderSystem::Release(StreamingBuffer& streamingBuffer)
+{
+    ReleaseDbg(streamingBuffers_, streamingBuffer);
+}
+
+std::size_t DbgRenderSystem::WriteStreamingBuffer(StreamingBuffer& streamingBuffer, const void* data, std::size_t dataSize)
+{
+    auto& streamingBufferDbg = LLGL_CAST(DbgStreamingBuffer&, streamingBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (!data)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot write streaming buffer with null pointer as data");
+        if (dataSize == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "writing streaming buffer with zero data size");
+        DebugBufferSize(streamingBufferDbg.desc.size, dataSize, 0);
+    }
+
+    auto offset = instance_->WriteStreamingBuffer(streamingBufferDbg.instance, data, dataSize);
+
+    LLGL_DBG_PROFILER_DO(writeStreamingBuffer.Inc());
+
+    return offset;
+}
+
+void DbgRenderSystem::AdvanceStreamingBuffer(StreamingBuffer& streamingBuffer)
+{
+    auto& streamingBufferDbg = LLGL_CAST(DbgStreamingBuffer&, streamingBuffer);
+    instance_->AdvanceStreamingBuffer(streamingBufferDbg.instance);
 }
 
 /* ----- Textures ----- */
@@ -203,8 +310,16 @@ Texture* DbgRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, co
     {
         LLGL_DBG_SOURCE;
         DebugTextureDescriptor(textureDesc);
+        if (imageDesc)
+            DebugImageDescriptor(*imageDesc);
     }
-    return TakeOwnership(textures_, MakeUnique<DbgTexture>(*instance_->CreateTexture(textureDesc, imageDesc), textureDesc));
+
+    auto textureDbg = MakeUnique<DbgTexture>(*instance_->CreateTexture(textureDesc, imageDesc), textureDesc);
+
+    /* Renderers allocate all MIP-map levels at creation time (see NumMipLevels) */
+    textureDbg->mipLevels = static_cast<int>(NumMipLevels(textureDesc));
+
+    return TakeOwnership(textures_, std::move(textureDbg));
 }
 
 TextureArray* DbgRenderSystem::CreateTextureArray(unsigned int numTextures, Texture* const * textureArray)
@@ -247,6 +362,7 @@ void DbgRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor&
     {
         LLGL_DBG_SOURCE;
         DebugMipLevelLimit(subTextureDesc.mipLevel, textureDbg.mipLevels);
+        DebugImageDescriptor(imageDesc);
     }
     
     instance_->WriteTexture(textureDbg.instance, subTextureDesc, imageDesc);
@@ -265,14 +381,26 @@ void DbgRenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageFor
     instance_->ReadTexture(textureDbg.instance, mipLevel, imageFormat, dataType, buffer);
 }
 
+Readback* DbgRenderSystem::ReadTextureAsync(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType)
+{
+    auto& textureDbg = LLGL_CAST(const DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        DebugMipLevelLimit(mipLevel, textureDbg.mipLevels);
+    }
+
+    return instance_->ReadTextureAsync(textureDbg.instance, mipLevel, imageFormat, dataType);
+}
+
 void DbgRenderSystem::GenerateMips(Texture& texture)
 {
     auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
     {
         instance_->GenerateMips(textureDbg.instance);
     }
-    const auto& tex3DDesc = textureDbg.desc.texture3D;
-    textureDbg.mipLevels = NumMipLevels(tex3DDesc.width, tex3DDesc.height, tex3DDesc.depth);
+    textureDbg.mipLevels = static_cast<int>(NumMipLevels(textureDbg.desc));
 }
 
 /* ----- Sampler States ---- */
@@ -419,6 +547,23 @@ void DbgRenderSystem::Release(Query& query)
     ReleaseDbg(queries_, query);
 }
 
+/* ----- Readbacks ----- */
+
+const void* DbgRenderSystem::MapReadback(Readback& readback)
+{
+    return instance_->MapReadback(readback);
+}
+
+void DbgRenderSystem::UnmapReadback(Readback& readback)
+{
+    instance_->UnmapReadback(readback);
+}
+
+void DbgRenderSystem::Release(Readback& readback)
+{
+    instance_->Release(readback);
+}
+
 
 /*
  * ======= Private: =======
@@ -442,6 +587,20 @@ void DbgRenderSystem::DebugMipLevelLimit(int mipLevel, int mipLevelCount)
     }
 }
 
+void DbgRenderSystem::DebugBufferMapFlags(long mapFlags)
+{
+    const long writeFlags = (BufferMapFlags::Write | BufferMapFlags::WriteDiscard | BufferMapFlags::NoOverwrite);
+
+    if ((mapFlags & (BufferMapFlags::Read | writeFlags)) == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "buffer mapping flags specify neither read nor write access");
+
+    if ((mapFlags & BufferMapFlags::Read) != 0 && (mapFlags & (BufferMapFlags::WriteDiscard | BufferMapFlags::NoOverwrite)) != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot combine read access with discard or no-overwrite buffer mapping");
+
+    if ((mapFlags & BufferMapFlags::ExplicitFlush) != 0 && (mapFlags & writeFlags) == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "explicit flush of buffer mapping requires write access");
+}
+
 void DbgRenderSystem::DebugTextureDescriptor(const TextureDescriptor& desc)
 {
     switch (desc.type)
@@ -506,6 +665,14 @@ void DbgRenderSystem::DebugTextureSize(unsigned int size)
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid texture size");
 }
 
+void DbgRenderSystem::DebugImageDescriptor(const ImageDescriptor& desc)
+{
+    if (desc.alignment != 1 && desc.alignment != 2 && desc.alignment != 4 && desc.alignment != 8)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid image row alignment (must be 1, 2, 4, or 8)");
+    if (IsCompressedFormat(desc.format) && (desc.rowLength != 0 || desc.imageHeight != 0))
+        LLGL_DBG_WARN(WarningType::ImproperArgument, "image row length and image height are ignored for compressed images");
+}
+
 void DbgRenderSystem::WarnTextureLayersGreaterOne()
 {
     LLGL_DBG_WARN(WarningType::ImproperArgument, "texture layers is greater than 1 but no array texture is specified");
@@ -14,6 +14,7 @@
 #include "DbgCommandBuffer.h"
 
 #include "DbgBuffer.h"
+#include "DbgStreamingBuffer.h"
 #include "DbgGraphicsPipeline.h"
 #include "DbgTexture.h"
 #include "DbgRenderTarget.h"
@@ -65,6 +66,21 @@ class DbgRenderSystem : public RenderSystem
         void* MapBuffer(Buffer& buffer, const BufferCPUAccess access) override;
         void UnmapBuffer(Buffer& buffer) override;
 
+        void* MapBufferRange(Buffer& buffer, std::size_t offset, std::size_t size, long mapFlags) override;
+        void FlushMappedRange(Buffer& buffer, std::size_t offset, std::size_t size) override;
+
+        Readback* ReadBufferAsync(const Buffer& buffer, std::size_t offset, std::size_t size) override;
+
+        /* ----- Streaming buffers ----- */
+
+        StreamingBuffer* CreateStreamingBuffer(const StreamingBufferDescriptor& desc) override;
+
+        void Release(StreamingBuffer& streamingBuffer) override;
+
+        std::size_t WriteStreamingBuffer(StreamingBuffer& streamingBuffer, const void* data, std::size_t dataSize) override;
+
+        void AdvanceStreamingBuffer(StreamingBuffer& streamingBuffer) override;
+
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const ImageDescriptor* imageDesc = nullptr) override;
@@ -79,6 +95,8 @@ class DbgRenderSystem : public RenderSystem
 
         void ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) override;
 
+        Readback* ReadTextureAsync(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType) override;
+
         void GenerateMips(Texture& texture) override;
 
         /* ----- Sampler States ---- */
@@ -117,13 +135,22 @@ class DbgRenderSystem : public RenderSystem
 
         void Release(Query& query) override;
 
+        /* ----- Readbacks ----- */
+
+        const void* MapReadback(Readback& readback) override;
+        void UnmapReadback(Readback& readback) override;
+
+        void Release(Readback& readback) override;
+
     private:
 
         void DebugBufferSize(std::size_t bufferSize, std::size_t dataSize, std::size_t dataOffset);
         void DebugMipLevelLimit(int mipLevel, int mipLevelCount);
+        void DebugBufferMapFlags(long mapFlags);
 
         void DebugTextureDescriptor(const TextureDescriptor& desc);
         void DebugTextureSize(unsigned int size);
+        void DebugImageDescriptor(const ImageDescriptor& desc);
         void WarnTextureLayersGreaterOne();
         void ErrTextureLayersEqualZero();
 
@@ -142,6 +169,7 @@ class DbgRenderSystem : public RenderSystem
         HWObjectContainer<DbgRenderContext>     renderContexts_;
         HWObjectContainer<DbgCommandBuffer>     commandBuffers_;
         HWObjectContainer<DbgBuffer>            buffers_;
+        HWObjectContainer<DbgStreamingBuffer>   streamingBuffers_;
         HWObjectContainer<DbgTexture>           textures_;
         HWObjectContainer<DbgRenderTarget>      renderTargets_;
         HWObjectContainer<DbgShader>            shaders_;
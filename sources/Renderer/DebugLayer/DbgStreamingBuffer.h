@@ -0,0 +1,57 @@
+/*
+ * DbgStreamingBuffer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_DBG_STREAMING_BUFFER_H__
+#define __LLGL_DBG_STREAMING_BUFFER_H__
+
+
+#include <LLGL/StreamingBuffer.h>
+#include "DbgBuffer.h"
+
+
+namespace LLGL
+{
+
+
+class DbgStreamingBuffer : public StreamingBuffer
+{
+
+    public:
+
+        DbgStreamingBuffer(LLGL::StreamingBuffer& instance, const StreamingBufferDescriptor& desc, std::size_t bufferSize) :
+            instance( instance                                      ),
+            desc    ( desc                                          ),
+            buffer_ ( instance.GetBuffer(), BufferType::Constant    )
+        {
+            buffer_.desc.type   = BufferType::Constant;
+            buffer_.desc.size   = static_cast<unsigned int>(bufferSize);
+            buffer_.initialized = true;
+        }
+
+        Buffer& GetBuffer() override
+        {
+            return buffer_;
+        }
+
+        LLGL::StreamingBuffer&      instance;
+        StreamingBufferDescriptor   desc;
+
+    private:
+
+        DbgBuffer                   buffer_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,1018 @@
+/*
+ * DeferredCommandBuffer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/DeferredCommandBuffer.h>
+#include "../Core/Exception.h"
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal structures ----- */
+
+/*
+Each command is encoded as a single opcode byte, followed by its arguments structure (at the alignment of this structure),
+followed by an optional payload for array arguments. The arguments structures are only copied into the command stream
+and never destroyed, so they must only consist of trivially destructible types.
+*/
+enum class Opcode : std::uint8_t
+{
+    SetGraphicsAPIDependentState,
+    SetViewport,
+    SetViewportArray,
+    SetScissor,
+    SetScissorArray,
+    SetClearColor,
+    SetClearDepth,
+    SetClearStencil,
+    Clear,
+
+    SetVertexBuffer,
+    SetVertexBufferArray,
+    SetIndexBuffer,
+    SetConstantBuffer,
+    SetConstantBufferArray,
+    SetConstantBufferRange,
+    SetStorageBuffer,
+    SetStorageBufferArray,
+    SetStreamOutputBuffer,
+    SetStreamOutputBufferArray,
+    BeginStreamOutput,
+    EndStreamOutput,
+    CopyBuffer,
+
+    SetTexture,
+    SetTextureArray,
+    CopyTexture,
+    CopyTextureRegion,
+
+    SetSampler,
+    SetSamplerArray,
+
+    SetRenderTarget,
+    SetRenderTargetContext,
+
+    SetGraphicsPipeline,
+    SetComputePipeline,
+
+    BeginQuery,
+    EndQuery,
+    BeginRenderCondition,
+    EndRenderCondition,
+
+    Draw,
+    DrawIndexed,
+    DrawIndexedOffset,
+    DrawInstanced,
+    DrawInstancedOffset,
+    DrawIndexedInstanced,
+    DrawIndexedInstancedOffset,
+    DrawIndexedInstancedOffsets,
+    MultiDraw,
+    MultiDrawIndexed,
+    DrawIndirect,
+    DrawIndexedIndirect,
+    MultiDrawIndirect,
+    MultiDrawIndexedIndirect,
+
+    Dispatch,
+    DispatchIndirect,
+
+    SyncGPU,
+};
+
+// Arguments for commands with no arguments.
+struct CmdEmpty
+{
+};
+
+template <typename T>
+struct CmdValue
+{
+    T value;
+};
+
+template <typename T>
+struct CmdArray
+{
+    unsigned int count; // Number of elements in the payload
+};
+
+template <typename T>
+struct CmdResourceSlot
+{
+    T*              resource;
+    unsigned int    slot;
+    long            shaderStageFlags;
+};
+
+struct CmdSetConstantBufferRange
+{
+    Buffer*         buffer;
+    unsigned int    slot;
+    std::size_t     offset;
+    std::size_t     size;
+    long            shaderStageFlags;
+};
+
+struct CmdCopyBuffer
+{
+    Buffer*         dstBuffer;
+    std::size_t     dstOffset;
+    Buffer*         srcBuffer;
+    std::size_t     srcOffset;
+    std::size_t     size;
+};
+
+struct CmdCopyTexture
+{
+    Texture*        dstTexture;
+    Texture*        srcTexture;
+};
+
+struct CmdCopyTextureRegion
+{
+    Texture*        dstTexture;
+    TextureLocation dstLocation;
+    Texture*        srcTexture;
+    TextureLocation srcLocation;
+    Gs::Vector3ui   extent;
+    unsigned int    numLayers;
+};
+
+struct CmdBeginRenderCondition
+{
+    Query*              query;
+    RenderConditionMode mode;
+};
+
+struct CmdDraw
+{
+    unsigned int    numVertices;
+    unsigned int    first;
+    int             vertexOffset;
+    unsigned int    numInstances;
+    unsigned int    instanceOffset;
+};
+
+struct CmdDrawIndirect
+{
+    Buffer*         buffer;
+    std::size_t     offset;
+    unsigned int    numCommands;
+    unsigned int    stride;
+};
+
+struct CmdDispatch
+{
+    unsigned int    groupSizeX;
+    unsigned int    groupSizeY;
+    unsigned int    groupSizeZ;
+};
+
+// Returns the specified address aligned to the specified (power of two) alignment.
+static std::uintptr_t AlignAddress(std::uintptr_t address, std::size_t alignment)
+{
+    return ((address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1));
+}
+
+// Reads the arguments of the current command and moves the reader position behind them.
+template <typename T>
+static const T& ReadCommand(const char*& pos)
+{
+    auto args = reinterpret_cast<const T*>(AlignAddress(reinterpret_cast<std::uintptr_t>(pos), alignof(T)));
+    pos = reinterpret_cast<const char*>(args + 1);
+    return *args;
+}
+
+// Reads the payload array of the current command and moves the reader position behind it.
+template <typename T>
+static const T* ReadPayload(const char*& pos, unsigned int count)
+{
+    auto payload = reinterpret_cast<const T*>(pos);
+    pos += sizeof(T) * count;
+    return payload;
+}
+
+
+/* ----- Common ----- */
+
+DeferredCommandBuffer::DeferredCommandBuffer(std::size_t chunkSize) :
+    chunkSize_ ( chunkSize )
+{
+    if (chunkSize_ == 0)
+        throw std::invalid_argument("cannot create deferred command buffer with chunk size of zero");
+}
+
+DeferredCommandBuffer::DeferredCommandBuffer(DeferredCommandBuffer&& rhs) :
+    chunkSize_      ( rhs.chunkSize_         ),
+    chunks_         ( std::move(rhs.chunks_) ),
+    currentChunk_   ( rhs.currentChunk_      ),
+    numCommands_    ( rhs.numCommands_       )
+{
+    rhs.chunks_.clear();
+    rhs.currentChunk_   = 0;
+    rhs.numCommands_    = 0;
+}
+
+DeferredCommandBuffer& DeferredCommandBuffer::operator = (DeferredCommandBuffer&& rhs)
+{
+    if (this != &rhs)
+    {
+        chunkSize_      = rhs.chunkSize_;
+        chunks_         = std::move(rhs.chunks_);
+        currentChunk_   = rhs.currentChunk_;
+        numCommands_    = rhs.numCommands_;
+
+        rhs.chunks_.clear();
+        rhs.currentChunk_   = 0;
+        rhs.numCommands_    = 0;
+    }
+    return *this;
+}
+
+void DeferredCommandBuffer::Execute(CommandBuffer& commandBuffer) const
+{
+    for (std::size_t i = 0; i < chunks_.size() && i <= currentChunk_; ++i)
+    {
+        const auto& chunk = chunks_[i];
+
+        auto pos = static_cast<const char*>(chunk.data.get());
+        auto end = pos + chunk.size;
+
+        while (pos < end)
+        {
+            auto opcode = static_cast<Opcode>(*pos++);
+
+            switch (opcode)
+            {
+                /* ----- Configuration ----- */
+
+                case Opcode::SetGraphicsAPIDependentState:
+                {
+                    auto& cmd = ReadCommand<CmdValue<GraphicsAPIDependentStateDescriptor>>(pos);
+                    commandBuffer.SetGraphicsAPIDependentState(cmd.value);
+                }
+                break;
+
+                case Opcode::SetViewport:
+                {
+                    auto& cmd = ReadCommand<CmdValue<Viewport>>(pos);
+                    commandBuffer.SetViewport(cmd.value);
+                }
+                break;
+
+                case Opcode::SetViewportArray:
+                {
+                    auto& cmd = ReadCommand<CmdArray<Viewport>>(pos);
+                    commandBuffer.SetViewportArray(cmd.count, ReadPayload<Viewport>(pos, cmd.count));
+                }
+                break;
+
+                case Opcode::SetScissor:
+                {
+                    auto& cmd = ReadCommand<CmdValue<Scissor>>(pos);
+                    commandBuffer.SetScissor(cmd.value);
+                }
+                break;
+
+                case Opcode::SetScissorArray:
+                {
+                    auto& cmd = ReadCommand<CmdArray<Scissor>>(pos);
+                    commandBuffer.SetScissorArray(cmd.count, ReadPayload<Scissor>(pos, cmd.count));
+                }
+                break;
+
+                case Opcode::SetClearColor:
+                {
+                    auto& cmd = ReadCommand<CmdValue<ColorRGBAf>>(pos);
+                    commandBuffer.SetClearColor(cmd.value);
+                }
+                break;
+
+                case Opcode::SetClearDepth:
+                {
+                    auto& cmd = ReadCommand<CmdValue<float>>(pos);
+                    commandBuffer.SetClearDepth(cmd.value);
+                }
+                break;
+
+                case Opcode::SetClearStencil:
+                {
+                    auto& cmd = ReadCommand<CmdValue<int>>(pos);
+                    commandBuffer.SetClearStencil(cmd.value);
+                }
+                break;
+
+                case Opcode::Clear:
+                {
+                    auto& cmd = ReadCommand<CmdValue<long>>(pos);
+                    commandBuffer.Clear(cmd.value);
+                }
+                break;
+
+                /* ----- Buffers ----- */
+
+                case Opcode::SetVertexBuffer:
+                {
+                    auto& cmd = ReadCommand<CmdValue<Buffer*>>(pos);
+                    commandBuffer.SetVertexBuffer(*cmd.value);
+                }
+                break;
+
+                case Opcode::SetVertexBufferArray:
+                {
+                    auto& cmd = ReadCommand<CmdValue<BufferArray*>>(pos);
+                    commandBuffer.SetVertexBufferArray(*cmd.value);
+                }
+                break;
+
+                case Opcode::SetIndexBuffer:
+                {
+                    auto& cmd = ReadCommand<CmdValue<Buffer*>>(pos);
+                    commandBuffer.SetIndexBuffer(*cmd.value);
+                }
+                break;
+
+                case Opcode::SetConstantBuffer:
+                {
+                    auto& cmd = ReadCommand<CmdResourceSlot<Buffer>>(pos);
+                    commandBuffer.SetConstantBuffer(*cmd.resource, cmd.slot, cmd.shaderStageFlags);
+                }
+                break;
+
+                case Opcode::SetConstantBufferArray:
+                {
+                    auto& cmd = ReadCommand<CmdResourceSlot<BufferArray>>(pos);
+                    commandBuffer.SetConstantBufferArray(*cmd.resource, cmd.slot, cmd.shaderStageFlags);
+                }
+                break;
+
+                case Opcode::SetConstantBufferRange:
+                {
+                    auto& cmd = ReadCommand<CmdSetConstantBufferRange>(pos);
+                    commandBuffer.SetConstantBufferRange(*cmd.buffer, cmd.slot, cmd.offset, cmd.size, cmd.shaderStageFlags);
+                }
+                break;
+
+                case Opcode::SetStorageBuffer:
+                {
+                    auto& cmd = ReadCommand<CmdResourceSlot<Buffer>>(pos);
+                    commandBuffer.SetStorageBuffer(*cmd.resource, cmd.slot, cmd.shaderStageFlags);
+                }
+                break;
+
+                case Opcode::SetStorageBufferArray:
+                {
+                    auto& cmd = ReadCommand<CmdResourceSlot<BufferArray>>(pos);
+                    commandBuffer.SetStorageBufferArray(*cmd.resource, cmd.slot, cmd.shaderStageFlags);
+                }
+                break;
+
+                case Opcode::SetStreamOutputBuffer:
+                {
+                    auto& cmd = ReadCommand<CmdValue<Buffer*>>(pos);
+                    commandBuffer.SetStreamOutputBuffer(*cmd.value);
+                }
+                break;
+
+                case Opcode::SetStreamOutputBufferArray:
+                {
+                    auto& cmd = ReadCommand<CmdValue<BufferArray*>>(pos);
+                    commandBuffer.SetStreamOutputBufferArray(*cmd.value);
+                }
+                break;
+
+                case Opcode::BeginStreamOutput:
+                {
+                    auto& cmd = ReadCommand<CmdValue<PrimitiveType>>(pos);
+                    commandBuffer.BeginStreamOutput(cmd.value);
+                }
+                break;
+
+                case Opcode::EndStreamOutput:
+                {
+                    ReadCommand<CmdEmpty>(pos);
+                    commandBuffer.EndStreamOutput();
+                }
+                break;
+
+                case Opcode::CopyBuffer:
+                {
+                    auto& cmd = ReadCommand<CmdCopyBuffer>(pos);
+                    commandBuffer.CopyBuffer(*cmd.dstBuffer, cmd.dstOffset, *cmd.srcBuffer, cmd.srcOffset, cmd.size);
+                }
+                break;
+
+                /* ----- Textures ----- */
+
+                case Opcode::SetTexture:
+                {
+                    auto& cmd = ReadCommand<CmdResourceSlot<Texture>>(pos);
+                    commandBuffer.SetTexture(*cmd.resource, cmd.slot, cmd.shaderStageFlags);
+                }
+                break;
+
+                case Opcode::SetTextureArray:
+                {
+                    auto& cmd = ReadCommand<CmdResourceSlot<TextureArray>>(pos);
+                    commandBuffer.SetTextureArray(*cmd.resource, cmd.slot, cmd.shaderStageFlags);
+                }
+                break;
+
+                case Opcode::CopyTexture:
+                {
+                    auto& cmd = ReadCommand<CmdCopyTexture>(pos);
+                    commandBuffer.CopyTexture(*cmd.dstTexture, *cmd.srcTexture);
+                }
+                break;
+
+                case Opcode::CopyTextureRegion:
+                {
+                    auto& cmd = ReadCommand<CmdCopyTextureRegion>(pos);
+                    commandBuffer.CopyTextureRegion(*cmd.dstTexture, cmd.dstLocation, *cmd.srcTexture, cmd.srcLocation, cmd.extent, cmd.numLayers);
+                }
+                break;
+
+                /* ----- Samplers ----- */
+
+                case Opcode::SetSampler:
+                {
+                    auto& cmd = ReadCommand<CmdResourceSlot<Sampler>>(pos);
+                    commandBuffer.SetSampler(*cmd.resource, cmd.slot, cmd.shaderStageFlags);
+                }
+                break;
+
+                case Opcode::SetSamplerArray:
+                {
+                    auto& cmd = ReadCommand<CmdResourceSlot<SamplerArray>>(pos);
+                    commandBuffer.SetSamplerArray(*cmd.resource, cmd.slot, cmd.shaderStageFlags);
+                }
+                break;
+
+                /* ----- Render Targets ----- */
+
+                case Opcode::SetRenderTarget:
+                {
+                    auto& cmd = ReadCommand<CmdValue<RenderTarget*>>(pos);
+                    commandBuffer.SetRenderTarget(*cmd.value);
+                }
+                break;
+
+                case Opcode::SetRenderTargetContext:
+                {
+                    auto& cmd = ReadCommand<CmdValue<RenderContext*>>(pos);
+                    commandBuffer.SetRenderTarget(*cmd.value);
+                }
+                break;
+
+                /* ----- Pipeline States ----- */
+
+                case Opcode::SetGraphicsPipeline:
+                {
+                    auto& cmd = ReadCommand<CmdValue<GraphicsPipeline*>>(pos);
+                    commandBuffer.SetGraphicsPipeline(*cmd.value);
+                }
+                break;
+
+                case Opcode::SetComputePipeline:
+                {
+                    auto& cmd = ReadCommand<CmdValue<ComputePipeline*>>(pos);
+                    commandBuffer.SetComputePipeline(*cmd.value);
+                }
+                break;
+
+                /* ----- Queries ----- */
+
+                case Opcode::BeginQuery:
+                {
+                    auto& cmd = ReadCommand<CmdValue<Query*>>(pos);
+                    commandBuffer.BeginQuery(*cmd.value);
+                }
+                break;
+
+                case Opcode::EndQuery:
+                {
+                    auto& cmd = ReadCommand<CmdValue<Query*>>(pos);
+                    commandBuffer.EndQuery(*cmd.value);
+                }
+                break;
+
+                case Opcode::BeginRenderCondition:
+                {
+                    auto& cmd = ReadCommand<CmdBeginRenderCondition>(pos);
+                    commandBuffer.BeginRenderCondition(*cmd.query, cmd.mode);
+                }
+                break;
+
+                case Opcode::EndRenderCondition:
+                {
+                    ReadCommand<CmdEmpty>(pos);
+                    commandBuffer.EndRenderCondition();
+                }
+                break;
+
+                /* ----- Drawing ----- */
+
+                case Opcode::Draw:
+                {
+                    auto& cmd = ReadCommand<CmdDraw>(pos);
+                    commandBuffer.Draw(cmd.numVertices, cmd.first);
+                }
+                break;
+
+                case Opcode::DrawIndexed:
+                {
+                    auto& cmd = ReadCommand<CmdDraw>(pos);
+                    commandBuffer.DrawIndexed(cmd.numVertices, cmd.first);
+                }
+                break;
+
+                case Opcode::DrawIndexedOffset:
+                {
+                    auto& cmd = ReadCommand<CmdDraw>(pos);
+                    commandBuffer.DrawIndexed(cmd.numVertices, cmd.first, cmd.vertexOffset);
+                }
+                break;
+
+                case Opcode::DrawInstanced:
+                {
+                    auto& cmd = ReadCommand<CmdDraw>(pos);
+                    commandBuffer.DrawInstanced(cmd.numVertices, cmd.first, cmd.numInstances);
+                }
+                break;
+
+                case Opcode::DrawInstancedOffset:
+                {
+                    auto& cmd = ReadCommand<CmdDraw>(pos);
+                    commandBuffer.DrawInstanced(cmd.numVertices, cmd.first, cmd.numInstances, cmd.instanceOffset);
+                }
+                break;
+
+                case Opcode::DrawIndexedInstanced:
+                {
+                    auto& cmd = ReadCommand<CmdDraw>(pos);
+                    commandBuffer.DrawIndexedInstanced(cmd.numVertices, cmd.numInstances, cmd.first);
+                }
+                break;
+
+                case Opcode::DrawIndexedInstancedOffset:
+                {
+                    auto& cmd = ReadCommand<CmdDraw>(pos);
+                    commandBuffer.DrawIndexedInstanced(cmd.numVertices, cmd.numInstances, cmd.first, cmd.vertexOffset);
+                }
+                break;
+
+                case Opcode::DrawIndexedInstancedOffsets:
+                {
+                    auto& cmd = ReadCommand<CmdDraw>(pos);
+                    commandBuffer.DrawIndexedInstanced(cmd.numVertices, cmd.numInstances, cmd.first, cmd.vertexOffset, cmd.instanceOffset);
+                }
+                break;
+
+                case Opcode::MultiDraw:
+                {
+                    auto& cmd = ReadCommand<CmdArray<DrawArguments>>(pos);
+                    commandBuffer.MultiDraw(ReadPayload<DrawArguments>(pos, cmd.count), cmd.count);
+                }
+                break;
+
+                case Opcode::MultiDrawIndexed:
+                {
+                    auto& cmd = ReadCommand<CmdArray<DrawIndexedArguments>>(pos);
+                    commandBuffer.MultiDrawIndexed(ReadPayload<DrawIndexedArguments>(pos, cmd.count), cmd.count);
+                }
+                break;
+
+                case Opcode::DrawIndirect:
+                {
+                    auto& cmd = ReadCommand<CmdDrawIndirect>(pos);
+                    commandBuffer.DrawIndirect(*cmd.buffer, cmd.offset);
+                }
+                break;
+
+                case Opcode::DrawIndexedIndirect:
+                {
+                    auto& cmd = ReadCommand<CmdDrawIndirect>(pos);
+                    commandBuffer.DrawIndexedIndirect(*cmd.buffer, cmd.offset);
+                }
+                break;
+
+                case Opcode::MultiDrawIndirect:
+                {
+                    auto& cmd = ReadCommand<CmdDrawIndirect>(pos);
+                    commandBuffer.MultiDrawIndirect(*cmd.buffer, cmd.offset, cmd.numCommands, cmd.stride);
+                }
+                break;
+
+                case Opcode::MultiDrawIndexedIndirect:
+                {
+                    auto& cmd = ReadCommand<CmdDrawIndirect>(pos);
+                    commandBuffer.MultiDrawIndexedIndirect(*cmd.buffer, cmd.offset, cmd.numCommands, cmd.stride);
+                }
+                break;
+
+                /* ----- Compute ----- */
+
+                case Opcode::Dispatch:
+                {
+                    auto& cmd = ReadCommand<CmdDispatch>(pos);
+                    commandBuffer.Dispatch(cmd.groupSizeX, cmd.groupSizeY, cmd.groupSizeZ);
+                }
+                break;
+
+                case Opcode::DispatchIndirect:
+                {
+                    auto& cmd = ReadCommand<CmdDrawIndirect>(pos);
+                    commandBuffer.DispatchIndirect(*cmd.buffer, cmd.offset);
+                }
+                break;
+
+                /* ----- Misc ----- */
+
+                case Opcode::SyncGPU:
+                {
+                    ReadCommand<CmdEmpty>(pos);
+                    commandBuffer.SyncGPU();
+                }
+                break;
+            }
+        }
+    }
+}
+
+void DeferredCommandBuffer::Reset()
+{
+    for (auto& chunk : chunks_)
+        chunk.size = 0;
+
+    currentChunk_   = 0;
+    numCommands_    = 0;
+}
+
+/* ----- Configuration ----- */
+
+void DeferredCommandBuffer::SetGraphicsAPIDependentState(const GraphicsAPIDependentStateDescriptor& state)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetGraphicsAPIDependentState), CmdValue<GraphicsAPIDependentStateDescriptor>{ state });
+}
+
+void DeferredCommandBuffer::SetViewport(const Viewport& viewport)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetViewport), CmdValue<Viewport>{ viewport });
+}
+
+void DeferredCommandBuffer::SetViewportArray(unsigned int numViewports, const Viewport* viewportArray)
+{
+    auto cmd = WriteCommand(static_cast<std::uint8_t>(Opcode::SetViewportArray), CmdArray<Viewport>{ numViewports }, sizeof(Viewport) * numViewports);
+    std::copy(viewportArray, viewportArray + numViewports, reinterpret_cast<Viewport*>(cmd + 1));
+}
+
+void DeferredCommandBuffer::SetScissor(const Scissor& scissor)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetScissor), CmdValue<Scissor>{ scissor });
+}
+
+void DeferredCommandBuffer::SetScissorArray(unsigned int numScissors, const Scissor* scissorArray)
+{
+    auto cmd = WriteCommand(static_cast<std::uint8_t>(Opcode::SetScissorArray), CmdArray<Scissor>{ numScissors }, sizeof(Scissor) * numScissors);
+    std::copy(scissorArray, scissorArray + numScissors, reinterpret_cast<Scissor*>(cmd + 1));
+}
+
+void DeferredCommandBuffer::SetClearColor(const ColorRGBAf& color)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetClearColor), CmdValue<ColorRGBAf>{ color });
+}
+
+void DeferredCommandBuffer::SetClearDepth(float depth)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetClearDepth), CmdValue<float>{ depth });
+}
+
+void DeferredCommandBuffer::SetClearStencil(int stencil)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetClearStencil), CmdValue<int>{ stencil });
+}
+
+void DeferredCommandBuffer::Clear(long flags)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::Clear), CmdValue<long>{ flags });
+}
+
+/* ----- Buffers ------ */
+
+void DeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetVertexBuffer), CmdValue<Buffer*>{ &buffer });
+}
+
+void DeferredCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetVertexBufferArray), CmdValue<BufferArray*>{ &bufferArray });
+}
+
+void DeferredCommandBuffer::SetIndexBuffer(Buffer& buffer)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetIndexBuffer), CmdValue<Buffer*>{ &buffer });
+}
+
+void DeferredCommandBuffer::SetConstantBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetConstantBuffer), CmdResourceSlot<Buffer>{ &buffer, slot, shaderStageFlags });
+}
+
+void DeferredCommandBuffer::SetConstantBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetConstantBufferArray), CmdResourceSlot<BufferArray>{ &bufferArray, startSlot, shaderStageFlags });
+}
+
+void DeferredCommandBuffer::SetConstantBufferRange(Buffer& buffer, unsigned int slot, std::size_t offset, std::size_t size, long shaderStageFlags)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetConstantBufferRange), CmdSetConstantBufferRange{ &buffer, slot, offset, size, shaderStageFlags });
+}
+
+void DeferredCommandBuffer::SetStorageBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetStorageBuffer), CmdResourceSlot<Buffer>{ &buffer, slot, shaderStageFlags });
+}
+
+void DeferredCommandBuffer::SetStorageBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetStorageBufferArray), CmdResourceSlot<BufferArray>{ &bufferArray, startSlot, shaderStageFlags });
+}
+
+void DeferredCommandBuffer::SetStreamOutputBuffer(Buffer& buffer)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetStreamOutputBuffer), CmdValue<Buffer*>{ &buffer });
+}
+
+void DeferredCommandBuffer::SetStreamOutputBufferArray(BufferArray& bufferArray)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetStreamOutputBufferArray), CmdValue<BufferArray*>{ &bufferArray });
+}
+
+void DeferredCommandBuffer::BeginStreamOutput(const PrimitiveType primitiveType)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::BeginStreamOutput), CmdValue<PrimitiveType>{ primitiveType });
+}
+
+void DeferredCommandBuffer::EndStreamOutput()
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::EndStreamOutput), CmdEmpty{});
+}
+
+void DeferredCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::size_t dstOffset, Buffer& srcBuffer, std::size_t srcOffset, std::size_t size)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::CopyBuffer), CmdCopyBuffer{ &dstBuffer, dstOffset, &srcBuffer, srcOffset, size });
+}
+
+/* ----- Textures ----- */
+
+void DeferredCommandBuffer::SetTexture(Texture& texture, unsigned int slot, long shaderStageFlags)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetTexture), CmdResourceSlot<Texture>{ &texture, slot, shaderStageFlags });
+}
+
+void DeferredCommandBuffer::SetTextureArray(TextureArray& textureArray, unsigned int startSlot, long shaderStageFlags)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetTextureArray), CmdResourceSlot<TextureArray>{ &textureArray, startSlot, shaderStageFlags });
+}
+
+void DeferredCommandBuffer::CopyTexture(Texture& dstTexture, Texture& srcTexture)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::CopyTexture), CmdCopyTexture{ &dstTexture, &srcTexture });
+}
+
+void DeferredCommandBuffer::CopyTextureRegion(
+    Texture& dstTexture, const TextureLocation& dstLocation,
+    Texture& srcTexture, const TextureLocation& srcLocation,
+    const Gs::Vector3ui& extent, unsigned int numLayers)
+{
+    WriteCommand(
+        static_cast<std::uint8_t>(Opcode::CopyTextureRegion),
+        CmdCopyTextureRegion{ &dstTexture, dstLocation, &srcTexture, srcLocation, extent, numLayers }
+    );
+}
+
+/* ----- Samplers ----- */
+
+void DeferredCommandBuffer::SetSampler(Sampler& sampler, unsigned int slot, long shaderStageFlags)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetSampler), CmdResourceSlot<Sampler>{ &sampler, slot, shaderStageFlags });
+}
+
+void DeferredCommandBuffer::SetSamplerArray(SamplerArray& samplerArray, unsigned int startSlot, long shaderStageFlags)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetSamplerArray), CmdResourceSlot<SamplerArray>{ &samplerArray, startSlot, shaderStageFlags });
+}
+
+/* ----- Render Targets ----- */
+
+void DeferredCommandBuffer::SetRenderTarget(RenderTarget& renderTarget)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetRenderTarget), CmdValue<RenderTarget*>{ &renderTarget });
+}
+
+void DeferredCommandBuffer::SetRenderTarget(RenderContext& renderContext)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetRenderTargetContext), CmdValue<RenderContext*>{ &renderContext });
+}
+
+/* ----- Pipeline States ----- */
+
+void DeferredCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetGraphicsPipeline), CmdValue<GraphicsPipeline*>{ &graphicsPipeline });
+}
+
+void DeferredCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SetComputePipeline), CmdValue<ComputePipeline*>{ &computePipeline });
+}
+
+/* ----- Queries ----- */
+
+void DeferredCommandBuffer::BeginQuery(Query& query)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::BeginQuery), CmdValue<Query*>{ &query });
+}
+
+void DeferredCommandBuffer::EndQuery(Query& query)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::EndQuery), CmdValue<Query*>{ &query });
+}
+
+bool DeferredCommandBuffer::QueryResult(Query& /*query*/, std::uint64_t& /*result*/)
+{
+    ThrowNotSupported("query results in deferred command buffers");
+}
+
+void DeferredCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::BeginRenderCondition), CmdBeginRenderCondition{ &query, mode });
+}
+
+void DeferredCommandBuffer::EndRenderCondition()
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::EndRenderCondition), CmdEmpty{});
+}
+
+/* ----- Drawing ----- */
+
+void DeferredCommandBuffer::Draw(unsigned int numVertices, unsigned int firstVertex)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::Draw), CmdDraw{ numVertices, firstVertex, 0, 1, 0 });
+}
+
+void DeferredCommandBuffer::DrawIndexed(unsigned int numVertices, unsigned int firstIndex)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::DrawIndexed), CmdDraw{ numVertices, firstIndex, 0, 1, 0 });
+}
+
+void DeferredCommandBuffer::DrawIndexed(unsigned int numVertices, unsigned int firstIndex, int vertexOffset)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::DrawIndexedOffset), CmdDraw{ numVertices, firstIndex, vertexOffset, 1, 0 });
+}
+
+void DeferredCommandBuffer::DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::DrawInstanced), CmdDraw{ numVertices, firstVertex, 0, numInstances, 0 });
+}
+
+void DeferredCommandBuffer::DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int instanceOffset)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::DrawInstancedOffset), CmdDraw{ numVertices, firstVertex, 0, numInstances, instanceOffset });
+}
+
+void DeferredCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::DrawIndexedInstanced), CmdDraw{ numVertices, firstIndex, 0, numInstances, 0 });
+}
+
+void DeferredCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::DrawIndexedInstancedOffset), CmdDraw{ numVertices, firstIndex, vertexOffset, numInstances, 0 });
+}
+
+void DeferredCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::DrawIndexedInstancedOffsets), CmdDraw{ numVertices, firstIndex, vertexOffset, numInstances, instanceOffset });
+}
+
+void DeferredCommandBuffer::MultiDraw(const DrawArguments* argsArray, unsigned int numDraws)
+{
+    auto cmd = WriteCommand(static_cast<std::uint8_t>(Opcode::MultiDraw), CmdArray<DrawArguments>{ numDraws }, sizeof(DrawArguments) * numDraws);
+    std::copy(argsArray, argsArray + numDraws, reinterpret_cast<DrawArguments*>(cmd + 1));
+}
+
+void DeferredCommandBuffer::MultiDrawIndexed(const DrawIndexedArguments* argsArray, unsigned int numDraws)
+{
+    auto cmd = WriteCommand(static_cast<std::uint8_t>(Opcode::MultiDrawIndexed), CmdArray<DrawIndexedArguments>{ numDraws }, sizeof(DrawIndexedArguments) * numDraws);
+    std::copy(argsArray, argsArray + numDraws, reinterpret_cast<DrawIndexedArguments*>(cmd + 1));
+}
+
+void DeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::size_t offset)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::DrawIndirect), CmdDrawIndirect{ &buffer, offset, 1, 0 });
+}
+
+void DeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::size_t offset)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::DrawIndexedIndirect), CmdDrawIndirect{ &buffer, offset, 1, 0 });
+}
+
+void DeferredCommandBuffer::MultiDrawIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::MultiDrawIndirect), CmdDrawIndirect{ &buffer, offset, numCommands, stride });
+}
+
+void DeferredCommandBuffer::MultiDrawIndexedIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::MultiDrawIndexedIndirect), CmdDrawIndirect{ &buffer, offset, numCommands, stride });
+}
+
+/* ----- Compute ----- */
+
+void DeferredCommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::Dispatch), CmdDispatch{ groupSizeX, groupSizeY, groupSizeZ });
+}
+
+void DeferredCommandBuffer::DispatchIndirect(Buffer& buffer, std::size_t offset)
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::DispatchIndirect), CmdDrawIndirect{ &buffer, offset, 1, 0 });
+}
+
+/* ----- Misc ----- */
+
+void DeferredCommandBuffer::SyncGPU()
+{
+    WriteCommand(static_cast<std::uint8_t>(Opcode::SyncGPU), CmdEmpty{});
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+char* DeferredCommandBuffer::AllocCommand(std::uint8_t opcode, std::size_t argsSize, std::size_t argsAlignment)
+{
+    /* Determine the worst-case size of the command, including padding for the alignment of the arguments */
+    const auto maxCommandSize = 1 + (argsAlignment - 1) + argsSize;
+
+    /* Move on to the next chunk if the command does not fit into the current one */
+    if (!chunks_.empty() && chunks_[currentChunk_].size + maxCommandSize > chunks_[currentChunk_].capacity)
+        ++currentChunk_;
+
+    /* Skip re-used chunks which are too small for this command */
+    while (currentChunk_ < chunks_.size() && chunks_[currentChunk_].capacity < maxCommandSize)
+        ++currentChunk_;
+
+    if (currentChunk_ == chunks_.size())
+    {
+        /* Allocate new chunk */
+        Chunk chunk;
+        {
+            chunk.capacity  = std::max(chunkSize_, maxCommandSize);
+            chunk.data      = std::unique_ptr<char[]>(new char[chunk.capacity]);
+        }
+        chunks_.emplace_back(std::move(chunk));
+    }
+
+    /* Write opcode and return aligned address for the arguments */
+    auto& chunk = chunks_[currentChunk_];
+
+    auto pos = chunk.data.get() + chunk.size;
+    *pos++ = static_cast<char>(opcode);
+
+    auto args = reinterpret_cast<char*>(AlignAddress(reinterpret_cast<std::uintptr_t>(pos), argsAlignment));
+    chunk.size = static_cast<std::size_t>(args + argsSize - chunk.data.get());
+
+    ++numCommands_;
+
+    return args;
+}
+
+template <typename T>
+T* DeferredCommandBuffer::WriteCommand(std::uint8_t opcode, const T& args, std::size_t payloadSize)
+{
+    /* Payload arrays are stored directly behind the arguments structure */
+    auto addr = AllocCommand(opcode, sizeof(T) + payloadSize, alignof(T));
+    return new (addr) T(args);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
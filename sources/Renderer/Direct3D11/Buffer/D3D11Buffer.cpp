@@ -70,6 +70,33 @@ void* D3D11Buffer::Map(ID3D11DeviceContext* context, const BufferCPUAccess acces
     return (SUCCEEDED(hr) ? mapppedSubresource.pData : nullptr);
 }
 
+void* D3D11Buffer::Map(ID3D11DeviceContext* context, const BufferCPUAccess access, long mapFlags)
+{
+    /* Determine whether the buffer can be mapped with discard or no-overwrite semantics */
+    D3D11_MAP mapType = D3D11_MAP_WRITE;
+    if ((mapFlags & BufferMapFlags::NoOverwrite) != 0)
+        mapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+    else if ((mapFlags & BufferMapFlags::WriteDiscard) != 0)
+        mapType = D3D11_MAP_WRITE_DISCARD;
+
+    if (mapType != D3D11_MAP_WRITE && !cpuAccessBuffer_)
+    {
+        D3D11_BUFFER_DESC desc;
+        buffer_->GetDesc(&desc);
+
+        if (desc.Usage == D3D11_USAGE_DYNAMIC)
+        {
+            /* Map dynamic buffer without synchronization */
+            D3D11_MAPPED_SUBRESOURCE mapppedSubresource;
+            auto hr = context->Map(Get(), 0, mapType, 0, &mapppedSubresource);
+            return (SUCCEEDED(hr) ? mapppedSubresource.pData : nullptr);
+        }
+    }
+
+    /* Map buffer with default synchronization */
+    return Map(context, access);
+}
+
 void D3D11Buffer::Unmap(ID3D11DeviceContext* context, const BufferCPUAccess access)
 {
     if (cpuAccessBuffer_)
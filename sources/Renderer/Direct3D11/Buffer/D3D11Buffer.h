@@ -30,6 +30,9 @@ class D3D11Buffer : public Buffer
         virtual void UpdateSubresource(ID3D11DeviceContext* context, const void* data);
 
         void* Map(ID3D11DeviceContext* context, const BufferCPUAccess access);
+
+        //! Maps the buffer with discard or no-overwrite semantics (see BufferMapFlags), if the buffer has dynamic usage.
+        void* Map(ID3D11DeviceContext* context, const BufferCPUAccess access, long mapFlags);
         void Unmap(ID3D11DeviceContext* context, const BufferCPUAccess access);
 
         //! Returns the ID3D11Buffer object.
@@ -0,0 +1,96 @@
+/*
+ * D3D11Readback.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "D3D11Readback.h"
+#include "../../DXCommon/DXCore.h"
+#include <thread>
+
+
+namespace LLGL
+{
+
+
+D3D11Readback::D3D11Readback(ID3D11Device* device, ID3D11DeviceContext* context, std::size_t size) :
+    Readback( size    ),
+    context_( context )
+{
+    /* Create staging buffer for reading only */
+    D3D11_BUFFER_DESC bufferDesc;
+    {
+        bufferDesc.ByteWidth            = static_cast<UINT>(size);
+        bufferDesc.Usage                = D3D11_USAGE_STAGING;
+        bufferDesc.BindFlags            = 0;
+        bufferDesc.CPUAccessFlags       = D3D11_CPU_ACCESS_READ;
+        bufferDesc.MiscFlags            = 0;
+        bufferDesc.StructureByteStride  = 0;
+    }
+    auto hr = device->CreateBuffer(&bufferDesc, nullptr, &stagingBuffer_);
+    DXThrowIfFailed(hr, "failed to create D3D11 staging buffer for readback");
+
+    CreateEventQuery(device);
+}
+
+D3D11Readback::D3D11Readback(
+    ID3D11Device* device, ID3D11DeviceContext* context, std::size_t size,
+    DXGI_FORMAT srcFormat, const Gs::Vector3ui& extent, ImageFormat imageFormat, DataType dataType) :
+        Readback    ( size        ),
+        context_    ( context     ),
+        srcFormat_  ( srcFormat   ),
+        extent_     ( extent      ),
+        imageFormat_( imageFormat ),
+        dataType_   ( dataType    )
+{
+    CreateEventQuery(device);
+}
+
+D3D11Readback::~D3D11Readback()
+{
+    /* Release staging texture explicitly (the union of hardware texture interfaces has no destructor for its members) */
+    stagingTexture_.resource.Reset();
+}
+
+bool D3D11Readback::IsReady()
+{
+    /* Poll event query without flushing the command queue */
+    return (context_->GetData(event_.Get(), nullptr, 0, D3D11_ASYNC_GETDATA_DONOTFLUSH) == S_OK);
+}
+
+void D3D11Readback::InsertEvent()
+{
+    context_->End(event_.Get());
+}
+
+void D3D11Readback::Wait()
+{
+    /* Flush command queue (once) and wait until the event has been signaled */
+    while (context_->GetData(event_.Get(), nullptr, 0, 0) != S_OK)
+        std::this_thread::yield();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void D3D11Readback::CreateEventQuery(ID3D11Device* device)
+{
+    /* Create event query to track the GPU copy */
+    D3D11_QUERY_DESC queryDesc;
+    {
+        queryDesc.Query     = D3D11_QUERY_EVENT;
+        queryDesc.MiscFlags = 0;
+    }
+    auto hr = device->CreateQuery(&queryDesc, &event_);
+    DXThrowIfFailed(hr, "failed to create D3D11 event query for readback");
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
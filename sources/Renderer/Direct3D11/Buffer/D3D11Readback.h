@@ -0,0 +1,123 @@
+/*
+ * D3D11Readback.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_D3D11_READBACK_H__
+#define __LLGL_D3D11_READBACK_H__
+
+
+#include <LLGL/Readback.h>
+#include <LLGL/Image.h>
+#include "../Texture/D3D11Texture.h"
+#include "../../ComPtr.h"
+#include <Gauss/Vector3.h>
+#include <d3d11.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Readback with a staging buffer as copy of a buffer range, or a staging texture as copy of a texture subresource.
+The GPU copy into the staging resource is tracked by an event query.
+The image data of a texture readback is converted into the requested format when the readback is mapped for the first time.
+*/
+class D3D11Readback : public Readback
+{
+
+    public:
+
+        // Constructs a buffer readback with a staging buffer of the specified size.
+        D3D11Readback(ID3D11Device* device, ID3D11DeviceContext* context, std::size_t size);
+
+        // Constructs a texture readback, whose staging texture is converted from 'srcFormat' into the specified image format.
+        D3D11Readback(
+            ID3D11Device* device, ID3D11DeviceContext* context, std::size_t size,
+            DXGI_FORMAT srcFormat, const Gs::Vector3ui& extent, ImageFormat imageFormat, DataType dataType
+        );
+        ~D3D11Readback();
+
+        bool IsReady() override;
+
+        //! Inserts the event query after the copy commands, which have been submitted into the staging texture.
+        void InsertEvent();
+
+        //! Waits until the event query has been signaled.
+        void Wait();
+
+        //! Returns the staging buffer, which receives the copy of the buffer range (only for buffer readbacks).
+        inline ID3D11Buffer* GetStagingBuffer() const
+        {
+            return stagingBuffer_.Get();
+        }
+
+        //! Returns the staging texture, which receives the copy of the texture subresource (only for texture readbacks).
+        inline D3D11HardwareTexture& GetStagingTexture()
+        {
+            return stagingTexture_;
+        }
+
+        //! Returns true if this readback receives a texture subresource.
+        inline bool IsTextureReadback() const
+        {
+            return (srcFormat_ != DXGI_FORMAT_UNKNOWN);
+        }
+
+        inline DXGI_FORMAT GetSrcFormat() const
+        {
+            return srcFormat_;
+        }
+
+        inline const Gs::Vector3ui& GetExtent() const
+        {
+            return extent_;
+        }
+
+        inline ImageFormat GetImageFormat() const
+        {
+            return imageFormat_;
+        }
+
+        inline DataType GetDataType() const
+        {
+            return dataType_;
+        }
+
+        //! Returns the CPU buffer of the converted image data (or null, if the readback has not been mapped yet).
+        inline ByteBuffer& GetData()
+        {
+            return data_;
+        }
+
+    private:
+
+        void CreateEventQuery(ID3D11Device* device);
+
+        ID3D11DeviceContext*    context_        = nullptr;
+
+        ComPtr<ID3D11Query>     event_;
+        ComPtr<ID3D11Buffer>    stagingBuffer_;
+        D3D11HardwareTexture    stagingTexture_;
+
+        DXGI_FORMAT             srcFormat_      = DXGI_FORMAT_UNKNOWN;
+        Gs::Vector3ui           extent_;
+        ImageFormat             imageFormat_    = ImageFormat::RGBA;
+        DataType                dataType_       = DataType::UInt8;
+
+        ByteBuffer              data_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,88 @@
+/*
+ * D3D11StreamingBuffer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "D3D11StreamingBuffer.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../../Core/Helper.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+D3D11StreamingBuffer::D3D11StreamingBuffer(ID3D11Device* device, const StreamingBufferDescriptor& desc) :
+    frameSize_  ( GetAlignedSize(desc.size, offsetAlignment) ),
+    numFrames_  ( desc.numFrames                             ),
+    buffer_     (
+        BufferType::Constant,
+        device,
+        CD3D11_BUFFER_DESC(
+            static_cast<UINT>(frameSize_ * numFrames_),
+            D3D11_BIND_CONSTANT_BUFFER,
+            D3D11_USAGE_DYNAMIC,
+            D3D11_CPU_ACCESS_WRITE
+        )
+    )
+{
+}
+
+Buffer& D3D11StreamingBuffer::GetBuffer()
+{
+    return buffer_;
+}
+
+std::size_t D3D11StreamingBuffer::Write(ID3D11DeviceContext* context, const void* data, std::size_t dataSize)
+{
+    /* Allocate aligned range within the current frame partition */
+    auto offset = GetAlignedSize(offset_, offsetAlignment);
+    if (offset + dataSize > frameSize_)
+    {
+        throw std::out_of_range(
+            "data size exceeds remaining space in frame partition of streaming buffer (" +
+            std::to_string(frameSize_ - std::min(offset, frameSize_)) + " bytes left)"
+        );
+    }
+
+    offset_ = offset + dataSize;
+    offset += frame_ * frameSize_;
+
+    /* Map buffer without synchronization (this range is not in use by the GPU) */
+    D3D11_MAPPED_SUBRESOURCE mappedSubresource;
+    auto hr = context->Map(
+        buffer_.Get(), 0, (discard_ ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE), 0, &mappedSubresource
+    );
+    DXThrowIfFailed(hr, "failed to map D3D11 streaming buffer");
+    {
+        ::memcpy(reinterpret_cast<char*>(mappedSubresource.pData) + offset, data, dataSize);
+    }
+    context->Unmap(buffer_.Get(), 0);
+
+    discard_ = false;
+
+    return offset;
+}
+
+void D3D11StreamingBuffer::Advance()
+{
+    offset_ = 0;
+    frame_  = (frame_ + 1) % numFrames_;
+
+    /* Rename the entire buffer when the ring wraps around */
+    if (frame_ == 0)
+        discard_ = true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,66 @@
+/*
+ * D3D11StreamingBuffer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_D3D11_STREAMING_BUFFER_H__
+#define __LLGL_D3D11_STREAMING_BUFFER_H__
+
+
+#include <LLGL/StreamingBuffer.h>
+#include "D3D11Buffer.h"
+
+
+namespace LLGL
+{
+
+
+/*
+Streaming buffer with a dynamic constant buffer as ring of frame partitions.
+All partitions are written with D3D11_MAP_WRITE_NO_OVERWRITE, except when the ring wraps around:
+then the entire buffer is discarded, so the driver can rename it while the GPU still reads from the previous frames.
+This requires the Direct3D 11.1 runtime (for constant buffer offsetting and no-overwrite mapping of constant buffers).
+*/
+class D3D11StreamingBuffer : public StreamingBuffer
+{
+
+    public:
+
+        D3D11StreamingBuffer(ID3D11Device* device, const StreamingBufferDescriptor& desc);
+
+        Buffer& GetBuffer() override;
+
+        //! Writes the data into the current frame partition and returns the buffer offset.
+        std::size_t Write(ID3D11DeviceContext* context, const void* data, std::size_t dataSize);
+
+        //! Continues with the next frame partition.
+        void Advance();
+
+        //! Alignment (in bytes) of each buffer offset, which is 16 shader constants.
+        static const std::size_t offsetAlignment = 256;
+
+    private:
+
+        std::size_t frameSize_  = 0;
+        std::size_t numFrames_  = 1;
+
+        std::size_t frame_      = 0;    // Index of the current frame partition
+        std::size_t offset_     = 0;    // Write offset within the current frame partition
+
+        bool        discard_    = true; // Discard entire buffer with the next write access
+
+        D3D11Buffer buffer_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
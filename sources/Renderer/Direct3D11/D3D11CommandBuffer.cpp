@@ -11,6 +11,7 @@
 #include "../CheckedCast.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include "../../Core/Helper.h"
+#include "../../Core/Exception.h"
 #include <algorithm>
 
 #include "RenderState/D3D11StateManager.h"
@@ -50,6 +51,8 @@ D3D11CommandBuffer::D3D11CommandBuffer(D3D11StateManager& stateMngr, const ComPt
     stateMngr_  ( stateMngr ),
     context_    ( context   )
 {
+    /* Query extended device context for constant buffer ranges (fails silently prior to the Direct3D 11.1 runtime) */
+    context_->QueryInterface(IID_PPV_ARGS(&context1_));
 }
 
 /* ----- Configuration ----- */
@@ -167,6 +170,19 @@ void D3D11CommandBuffer::SetConstantBufferArray(BufferArray& bufferArray, unsign
     );
 }
 
+void D3D11CommandBuffer::SetConstantBufferRange(Buffer& buffer, unsigned int slot, std::size_t offset, std::size_t size, long shaderStageFlags)
+{
+    if (!context1_)
+        ThrowNotSupported("constant buffer ranges");
+
+    /* Convert range into shader constants (16 bytes each), where the number of constants must be a multiple of 16 */
+    auto& bufferD3D     = LLGL_CAST(D3D11Buffer&, buffer);
+    auto firstConstant  = static_cast<UINT>(offset / 16);
+    auto numConstants   = static_cast<UINT>(GetAlignedSize(size, static_cast<std::size_t>(256)) / 16);
+
+    SetConstantBufferRangeOnStages(slot, bufferD3D.Get(), firstConstant, numConstants, shaderStageFlags);
+}
+
 void D3D11CommandBuffer::SetStorageBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags)
 {
     auto& storageBufferD3D = LLGL_CAST(D3D11StorageBuffer&, buffer);
@@ -244,6 +260,24 @@ void D3D11CommandBuffer::EndStreamOutput()
     // dummy
 }
 
+void D3D11CommandBuffer::CopyBuffer(Buffer& dstBuffer, std::size_t dstOffset, Buffer& srcBuffer, std::size_t srcOffset, std::size_t size)
+{
+    auto& dstBufferD3D = LLGL_CAST(D3D11Buffer&, dstBuffer);
+    auto& srcBufferD3D = LLGL_CAST(D3D11Buffer&, srcBuffer);
+
+    /* Copy buffer range (buffers are always a single subresource) */
+    D3D11_BOX srcBox;
+    {
+        srcBox.left     = static_cast<UINT>(srcOffset);
+        srcBox.top      = 0;
+        srcBox.front    = 0;
+        srcBox.right    = static_cast<UINT>(srcOffset + size);
+        srcBox.bottom   = 1;
+        srcBox.back     = 1;
+    }
+    context_->CopySubresourceRegion(dstBufferD3D.Get(), 0, static_cast<UINT>(dstOffset), 0, 0, srcBufferD3D.Get(), 0, &srcBox);
+}
+
 
 /* ----- Textures ----- */
 
@@ -267,6 +301,55 @@ void D3D11CommandBuffer::SetTextureArray(TextureArray& textureArray, unsigned in
     );
 }
 
+void D3D11CommandBuffer::CopyTexture(Texture& dstTexture, Texture& srcTexture)
+{
+    /* Copy entire resource with all MIP-map levels and array layers */
+    auto& dstTextureD3D = LLGL_CAST(D3D11Texture&, dstTexture);
+    auto& srcTextureD3D = LLGL_CAST(D3D11Texture&, srcTexture);
+    context_->CopyResource(dstTextureD3D.GetHardwareTexture().resource.Get(), srcTextureD3D.GetHardwareTexture().resource.Get());
+}
+
+void D3D11CommandBuffer::CopyTextureRegion(
+    Texture& dstTexture, const TextureLocation& dstLocation,
+    Texture& srcTexture, const TextureLocation& srcLocation,
+    const Gs::Vector3ui& extent, unsigned int numLayers)
+{
+    auto& dstTextureD3D = LLGL_CAST(D3D11Texture&, dstTexture);
+    auto& srcTextureD3D = LLGL_CAST(D3D11Texture&, srcTexture);
+
+    auto dstResource = dstTextureD3D.GetHardwareTexture().resource.Get();
+    auto srcResource = srcTextureD3D.GetHardwareTexture().resource.Get();
+
+    /* Setup source box (multi-sampled resources must be copied as a whole) */
+    D3D11_BOX srcBox;
+    {
+        srcBox.left     = srcLocation.offset.x;
+        srcBox.top      = srcLocation.offset.y;
+        srcBox.front    = srcLocation.offset.z;
+        srcBox.right    = srcLocation.offset.x + extent.x;
+        srcBox.bottom   = srcLocation.offset.y + std::max(1u, extent.y);
+        srcBox.back     = srcLocation.offset.z + std::max(1u, extent.z);
+    }
+    auto srcBoxRef = (IsMultiSampleTexture(srcTexture.GetType()) ? nullptr : &srcBox);
+
+    /* Copy region of each array layer (3D textures have only a single layer) */
+    if (srcTexture.GetType() == TextureType::Texture3D)
+        numLayers = 1;
+
+    for (unsigned int i = 0; i < numLayers; ++i)
+    {
+        auto dstSubresource = D3D11CalcSubresource(dstLocation.mipLevel, dstLocation.layer + i, dstTextureD3D.GetNumMipLevels());
+        auto srcSubresource = D3D11CalcSubresource(srcLocation.mipLevel, srcLocation.layer + i, srcTextureD3D.GetNumMipLevels());
+
+        context_->CopySubresourceRegion(
+            dstResource, dstSubresource,
+            dstLocation.offset.x, dstLocation.offset.y, dstLocation.offset.z,
+            srcResource, srcSubresource,
+            srcBoxRef
+        );
+    }
+}
+
 /* ----- Sampler States ----- */
 
 void D3D11CommandBuffer::SetSampler(Sampler& sampler, unsigned int slot, long shaderStageFlags)
@@ -568,6 +651,54 @@ void D3D11CommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned
     context_->DrawIndexedInstanced(numVertices, numInstances, firstIndex, vertexOffset, instanceOffset);
 }
 
+void D3D11CommandBuffer::MultiDraw(const DrawArguments* argsArray, unsigned int numDraws)
+{
+    for (unsigned int i = 0; i < numDraws; ++i)
+        context_->Draw(argsArray[i].numVertices, argsArray[i].firstVertex);
+}
+
+void D3D11CommandBuffer::MultiDrawIndexed(const DrawIndexedArguments* argsArray, unsigned int numDraws)
+{
+    for (unsigned int i = 0; i < numDraws; ++i)
+        context_->DrawIndexed(argsArray[i].numIndices, argsArray[i].firstIndex, argsArray[i].vertexOffset);
+}
+
+void D3D11CommandBuffer::DrawIndirect(Buffer& buffer, std::size_t offset)
+{
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    context_->DrawInstancedIndirect(bufferD3D.Get(), static_cast<UINT>(offset));
+}
+
+void D3D11CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::size_t offset)
+{
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    context_->DrawIndexedInstancedIndirect(bufferD3D.Get(), static_cast<UINT>(offset));
+}
+
+void D3D11CommandBuffer::MultiDrawIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride)
+{
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+
+    if (stride == 0)
+        stride = sizeof(DrawIndirectArguments);
+
+    /* D3D11 has no native multi-draw-indirect, so submit each draw command separately */
+    for (unsigned int i = 0; i < numCommands; ++i, offset += stride)
+        context_->DrawInstancedIndirect(bufferD3D.Get(), static_cast<UINT>(offset));
+}
+
+void D3D11CommandBuffer::MultiDrawIndexedIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride)
+{
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+
+    if (stride == 0)
+        stride = sizeof(DrawIndexedIndirectArguments);
+
+    /* D3D11 has no native multi-draw-indirect, so submit each draw command separately */
+    for (unsigned int i = 0; i < numCommands; ++i, offset += stride)
+        context_->DrawIndexedInstancedIndirect(bufferD3D.Get(), static_cast<UINT>(offset));
+}
+
 /* ----- Compute ----- */
 
 void D3D11CommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ)
@@ -575,6 +706,12 @@ void D3D11CommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSiz
     context_->Dispatch(groupSizeX, groupSizeY, groupSizeZ);
 }
 
+void D3D11CommandBuffer::DispatchIndirect(Buffer& buffer, std::size_t offset)
+{
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    context_->DispatchIndirect(bufferD3D.Get(), static_cast<UINT>(offset));
+}
+
 /* ----- Misc ----- */
 
 void D3D11CommandBuffer::SyncGPU()
@@ -606,6 +743,16 @@ void D3D11CommandBuffer::SetConstantBuffersOnStages(UINT startSlot, UINT count,
     if (CS_STAGE(shaderStageFlags)) { context_->CSSetConstantBuffers(startSlot, count, buffers); }
 }
 
+void D3D11CommandBuffer::SetConstantBufferRangeOnStages(UINT slot, ID3D11Buffer* buffer, UINT firstConstant, UINT numConstants, long shaderStageFlags)
+{
+    if (VS_STAGE(shaderStageFlags)) { context1_->VSSetConstantBuffers1(slot, 1, &buffer, &firstConstant, &numConstants); }
+    if (HS_STAGE(shaderStageFlags)) { context1_->HSSetConstantBuffers1(slot, 1, &buffer, &firstConstant, &numConstants); }
+    if (DS_STAGE(shaderStageFlags)) { context1_->DSSetConstantBuffers1(slot, 1, &buffer, &firstConstant, &numConstants); }
+    if (GS_STAGE(shaderStageFlags)) { context1_->GSSetConstantBuffers1(slot, 1, &buffer, &firstConstant, &numConstants); }
+    if (PS_STAGE(shaderStageFlags)) { context1_->PSSetConstantBuffers1(slot, 1, &buffer, &firstConstant, &numConstants); }
+    if (CS_STAGE(shaderStageFlags)) { context1_->CSSetConstantBuffers1(slot, 1, &buffer, &firstConstant, &numConstants); }
+}
+
 void D3D11CommandBuffer::SetShaderResourcesOnStages(UINT startSlot, UINT count, ID3D11ShaderResourceView* const* views, long shaderStageFlags)
 {
     if (VS_STAGE(shaderStageFlags)) { context_->VSSetShaderResources(startSlot, count, views); }
@@ -14,7 +14,7 @@
 #include "../ComPtr.h"
 #include "../DXCommon/DXCore.h"
 #include <vector>
-#include <d3d11.h>
+#include <d3d11_1.h>
 #include <dxgi.h>
 
 
@@ -59,6 +59,7 @@ class D3D11CommandBuffer : public CommandBuffer
         
         void SetConstantBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         void SetConstantBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetConstantBufferRange(Buffer& buffer, unsigned int slot, std::size_t offset, std::size_t size, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         
         void SetStorageBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         void SetStorageBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
@@ -69,11 +70,21 @@ class D3D11CommandBuffer : public CommandBuffer
         void BeginStreamOutput(const PrimitiveType primitiveType) override;
         void EndStreamOutput() override;
 
+        void CopyBuffer(Buffer& dstBuffer, std::size_t dstOffset, Buffer& srcBuffer, std::size_t srcOffset, std::size_t size) override;
+
         /* ----- Textures ----- */
 
         void SetTexture(Texture& texture, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         void SetTextureArray(TextureArray& textureArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
 
+        void CopyTexture(Texture& dstTexture, Texture& srcTexture) override;
+
+        void CopyTextureRegion(
+            Texture& dstTexture, const TextureLocation& dstLocation,
+            Texture& srcTexture, const TextureLocation& srcLocation,
+            const Gs::Vector3ui& extent, unsigned int numLayers = 1
+        ) override;
+
         /* ----- Sampler States ----- */
 
         void SetSampler(Sampler& sampler, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
@@ -113,9 +124,19 @@ class D3D11CommandBuffer : public CommandBuffer
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset) override;
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset) override;
 
+        void MultiDraw(const DrawArguments* argsArray, unsigned int numDraws) override;
+        void MultiDrawIndexed(const DrawIndexedArguments* argsArray, unsigned int numDraws) override;
+
+        void DrawIndirect(Buffer& buffer, std::size_t offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::size_t offset) override;
+
+        void MultiDrawIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride = 0) override;
+        void MultiDrawIndexedIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride = 0) override;
+
         /* ----- Compute ----- */
 
         void Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, std::size_t offset) override;
 
         /* ----- Misc ----- */
 
@@ -132,21 +153,23 @@ class D3D11CommandBuffer : public CommandBuffer
         void SubmitFramebufferView();
 
         void SetConstantBuffersOnStages(UINT startSlot, UINT count, ID3D11Buffer* const* buffers, long shaderStageFlags);
+        void SetConstantBufferRangeOnStages(UINT slot, ID3D11Buffer* buffer, UINT firstConstant, UINT numConstants, long shaderStageFlags);
         void SetShaderResourcesOnStages(UINT startSlot, UINT count, ID3D11ShaderResourceView* const* views, long shaderStageFlags);
         void SetSamplersOnStages(UINT startSlot, UINT count, ID3D11SamplerState* const* samplers, long shaderStageFlags);
         void SetUnorderedAccessViewsOnStages(UINT startSlot, UINT count, ID3D11UnorderedAccessView* const* views, const UINT* initialCounts, long shaderStageFlags);
 
         void ResolveBoundRenderTarget();
 
-        D3D11StateManager&          stateMngr_;
+        D3D11StateManager&              stateMngr_;
         
-        ComPtr<ID3D11DeviceContext> context_;
+        ComPtr<ID3D11DeviceContext>     context_;
+        ComPtr<ID3D11DeviceContext1>    context1_;                      // Only available with the Direct3D 11.1 runtime
 
-        D3D11FramebufferView        framebufferView_;
+        D3D11FramebufferView            framebufferView_;
 
-        D3DClearState               clearState_;
+        D3DClearState                   clearState_;
 
-        D3D11RenderTarget*          boundRenderTarget_  = nullptr;
+        D3D11RenderTarget*              boundRenderTarget_  = nullptr;
 
 };
 
@@ -17,6 +17,8 @@
 
 #include "Buffer/D3D11Buffer.h"
 #include "Buffer/D3D11BufferArray.h"
+#include "Buffer/D3D11Readback.h"
+#include "Buffer/D3D11StreamingBuffer.h"
 
 #include "RenderState/D3D11GraphicsPipeline.h"
 #include "RenderState/D3D11ComputePipeline.h"
@@ -77,6 +79,21 @@ class D3D11RenderSystem : public RenderSystem
         void* MapBuffer(Buffer& buffer, const BufferCPUAccess access) override;
         void UnmapBuffer(Buffer& buffer) override;
 
+        void* MapBufferRange(Buffer& buffer, std::size_t offset, std::size_t size, long mapFlags) override;
+        void FlushMappedRange(Buffer& buffer, std::size_t offset, std::size_t size) override;
+
+        Readback* ReadBufferAsync(const Buffer& buffer, std::size_t offset, std::size_t size) override;
+
+        /* ----- Streaming buffers ----- */
+
+        StreamingBuffer* CreateStreamingBuffer(const StreamingBufferDescriptor& desc) override;
+
+        void Release(StreamingBuffer& streamingBuffer) override;
+
+        std::size_t WriteStreamingBuffer(StreamingBuffer& streamingBuffer, const void* data, std::size_t dataSize) override;
+
+        void AdvanceStreamingBuffer(StreamingBuffer& streamingBuffer) override;
+
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const ImageDescriptor* imageDesc = nullptr) override;
@@ -91,6 +108,8 @@ class D3D11RenderSystem : public RenderSystem
 
         void ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) override;
 
+        Readback* ReadTextureAsync(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType) override;
+
         void GenerateMips(Texture& texture) override;
 
         /* ----- Sampler States ---- */
@@ -129,6 +148,13 @@ class D3D11RenderSystem : public RenderSystem
 
         void Release(Query& query) override;
 
+        /* ----- Readbacks ----- */
+
+        const void* MapReadback(Readback& readback) override;
+        void UnmapReadback(Readback& readback) override;
+
+        void Release(Readback& readback) override;
+
         /* ----- Extended internal functions ----- */
 
         inline D3D_FEATURE_LEVEL GetFeatureLevel() const
@@ -155,6 +181,11 @@ class D3D11RenderSystem : public RenderSystem
         void BuildGenericTexture2D(D3D11Texture& textureD3D, const TextureDescriptor& descD3D, const ImageDescriptor* imageDesc, UINT miscFlags);
         void BuildGenericTexture3D(D3D11Texture& textureD3D, const TextureDescriptor& descD3D, const ImageDescriptor* imageDesc, UINT miscFlags);
         void BuildGenericTexture2DMS(D3D11Texture& textureD3D, const TextureDescriptor& descD3D);
+
+        void ReadMappedTextureData(
+            DXGI_FORMAT srcFormat, const Gs::Vector3ui& size, const void* srcData,
+            ImageFormat imageFormat, DataType dataType, void* dstData
+        );
         
         void UpdateGenericTexture(
             Texture& texture, unsigned int mipLevel, unsigned int layer,
@@ -187,6 +218,8 @@ class D3D11RenderSystem : public RenderSystem
         HWObjectContainer<D3D11GraphicsPipeline>    graphicsPipelines_;
         HWObjectContainer<D3D11ComputePipeline>     computePipelines_;
         HWObjectContainer<D3D11Query>               queries_;
+        HWObjectContainer<D3D11Readback>            readbacks_;
+        HWObjectContainer<D3D11StreamingBuffer>     streamingBuffers_;
 
         /* ----- Other members ----- */
 
@@ -12,6 +12,7 @@
 #include "../Assertion.h"
 #include "../../Core/Helper.h"
 #include "../../Core/Vendor.h"
+#include "../../Core/Exception.h"
 #include <sstream>
 #include <iomanip>
 
@@ -23,6 +24,7 @@
 #include "Buffer/D3D11StorageBufferArray.h"
 #include "Buffer/D3D11StreamOutputBuffer.h"
 #include "Buffer/D3D11StreamOutputBufferArray.h"
+#include "Buffer/D3D11IndirectBuffer.h"
 
 
 namespace LLGL
@@ -85,6 +87,7 @@ static std::unique_ptr<D3D11Buffer> MakeD3D11Buffer(ID3D11Device* device, const
         case BufferType::Constant:      return MakeUnique< D3D11ConstantBuffer     >(device, desc, initialData);
         case BufferType::Storage:       return MakeUnique< D3D11StorageBuffer      >(device, desc, initialData);
         case BufferType::StreamOutput:  return MakeUnique< D3D11StreamOutputBuffer >(device, desc, initialData);
+        case BufferType::Indirect:      return MakeUnique< D3D11IndirectBuffer     >(device, desc, initialData);
     }
     return nullptr;
 }
@@ -144,6 +147,94 @@ void D3D11RenderSystem::UnmapBuffer(Buffer& buffer)
     bufferD3D.Unmap(context_.Get(), mappedBufferCPUAccess_);
 }
 
+static BufferCPUAccess GetBufferCPUAccess(long mapFlags)
+{
+    auto readAccess     = ((mapFlags & BufferMapFlags::Read) != 0);
+    auto writeAccess    = ((mapFlags & (BufferMapFlags::Write | BufferMapFlags::WriteDiscard | BufferMapFlags::NoOverwrite)) != 0);
+
+    if (readAccess)
+        return (writeAccess ? BufferCPUAccess::ReadWrite : BufferCPUAccess::ReadOnly);
+    else
+        return BufferCPUAccess::WriteOnly;
+}
+
+void* D3D11RenderSystem::MapBufferRange(Buffer& buffer, std::size_t offset, std::size_t size, long mapFlags)
+{
+    /* Direct3D 11 can only map entire buffers, so the offset is applied to the mapped memory */
+    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    mappedBufferCPUAccess_ = GetBufferCPUAccess(mapFlags);
+
+    auto data = reinterpret_cast<char*>(bufferD3D.Map(context_.Get(), mappedBufferCPUAccess_, mapFlags));
+    return (data != nullptr ? data + offset : nullptr);
+}
+
+void D3D11RenderSystem::FlushMappedRange(Buffer& buffer, std::size_t offset, std::size_t size)
+{
+    // dummy (all modifications are made visible when the buffer is unmapped)
+}
+
+Readback* D3D11RenderSystem::ReadBufferAsync(const Buffer& buffer, std::size_t offset, std::size_t size)
+{
+    auto& bufferD3D = LLGL_CAST(const D3D11Buffer&, buffer);
+
+    auto readback = MakeUnique<D3D11Readback>(device_.Get(), context_.Get(), size);
+
+    /* Copy buffer range into the staging buffer of the readback (executed asynchronously by the GPU) */
+    D3D11_BOX srcBox;
+    {
+        srcBox.left     = static_cast<UINT>(offset);
+        srcBox.top      = 0;
+        srcBox.front    = 0;
+        srcBox.right    = static_cast<UINT>(offset + size);
+        srcBox.bottom   = 1;
+        srcBox.back     = 1;
+    }
+    context_->CopySubresourceRegion(readback->GetStagingBuffer(), 0, 0, 0, 0, bufferD3D.Get(), 0, &srcBox);
+
+    /* Signal the readback once the GPU has finished the copy */
+    readback->InsertEvent();
+
+    return TakeOwnership(readbacks_, std::move(readback));
+}
+
+/* ----- Streaming buffers ----- */
+
+static bool HasConstantBufferOffsetting(ID3D11Device* device)
+{
+    D3D11_FEATURE_DATA_D3D11_OPTIONS options;
+    if (FAILED(device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options))))
+        return false;
+    return (options.ConstantBufferOffsetting != FALSE && options.MapNoOverwriteOnDynamicConstantBuffer != FALSE);
+}
+
+StreamingBuffer* D3D11RenderSystem::CreateStreamingBuffer(const StreamingBufferDescriptor& desc)
+{
+    AssertCreateStreamingBuffer(desc);
+
+    /* Constant buffer ranges and no-overwrite mapping of constant buffers require the Direct3D 11.1 runtime */
+    if (!HasConstantBufferOffsetting(device_.Get()))
+        ThrowNotSupported("constant buffer offsetting");
+
+    return TakeOwnership(streamingBuffers_, MakeUnique<D3D11StreamingBuffer>(device_.Get(), desc));
+}
+
+void D3D11RenderSystem::Release(StreamingBuffer& streamingBuffer)
+{
+    RemoveFromUniqueSet(streamingBuffers_, &streamingBuffer);
+}
+
+std::size_t D3D11RenderSystem::WriteStreamingBuffer(StreamingBuffer& streamingBuffer, const void* data, std::size_t dataSize)
+{
+    auto& streamingBufferD3D = LLGL_CAST(D3D11StreamingBuffer&, streamingBuffer);
+    return streamingBufferD3D.Write(context_.Get(), data, dataSize);
+}
+
+void D3D11RenderSystem::AdvanceStreamingBuffer(StreamingBuffer& streamingBuffer)
+{
+    auto& streamingBufferD3D = LLGL_CAST(D3D11StreamingBuffer&, streamingBuffer);
+    streamingBufferD3D.Advance();
+}
+
 /* ----- Textures ----- */
 
 // --> see "D3D11RenderSystem_Textures.cpp" file
@@ -239,6 +330,64 @@ void D3D11RenderSystem::Release(Query& query)
     RemoveFromUniqueSet(queries_, &query);
 }
 
+/* ----- Readbacks ----- */
+
+const void* D3D11RenderSystem::MapReadback(Readback& readback)
+{
+    auto& readbackD3D = LLGL_CAST(D3D11Readback&, readback);
+
+    readbackD3D.Wait();
+
+    if (!readbackD3D.IsTextureReadback())
+    {
+        /* Map staging buffer for reading */
+        D3D11_MAPPED_SUBRESOURCE mappedSubresource;
+        auto hr = context_->Map(readbackD3D.GetStagingBuffer(), 0, D3D11_MAP_READ, 0, &mappedSubresource);
+        DXThrowIfFailed(hr, "failed to map D3D11 readback staging buffer");
+        return mappedSubresource.pData;
+    }
+
+    /* Convert image data of the staging texture only once, when the readback is mapped for the first time */
+    auto& data = readbackD3D.GetData();
+    if (!data)
+    {
+        /* Map staging texture for reading */
+        auto stagingResource = readbackD3D.GetStagingTexture().resource.Get();
+
+        D3D11_MAPPED_SUBRESOURCE mappedSubresource;
+        auto hr = context_->Map(stagingResource, 0, D3D11_MAP_READ, 0, &mappedSubresource);
+        DXThrowIfFailed(hr, "failed to map D3D11 readback staging texture");
+
+        /* Copy mapped data into the CPU buffer of the readback */
+        data = ByteBuffer(new char[readbackD3D.GetSize()]);
+
+        ReadMappedTextureData(
+            readbackD3D.GetSrcFormat(), readbackD3D.GetExtent(), mappedSubresource.pData,
+            readbackD3D.GetImageFormat(), readbackD3D.GetDataType(), data.get()
+        );
+
+        context_->Unmap(stagingResource, 0);
+
+        /* Staging texture is no longer needed */
+        readbackD3D.GetStagingTexture().resource.Reset();
+    }
+
+    return data.get();
+}
+
+void D3D11RenderSystem::UnmapReadback(Readback& readback)
+{
+    /* Only the staging buffer remains mapped (the image data of texture readbacks remains in a CPU buffer) */
+    auto& readbackD3D = LLGL_CAST(D3D11Readback&, readback);
+    if (!readbackD3D.IsTextureReadback())
+        context_->Unmap(readbackD3D.GetStagingBuffer(), 0);
+}
+
+void D3D11RenderSystem::Release(Readback& readback)
+{
+    RemoveFromUniqueSet(readbacks_, &readback);
+}
+
 
 /*
  * ======= Private: =======
@@ -11,6 +11,7 @@
 #include "../CheckedCast.h"
 #include "../Assertion.h"
 #include "../../Core/Helper.h"
+#include <LLGL/ImageCompression.h>
 
 
 namespace LLGL
@@ -248,20 +249,84 @@ void D3D11RenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageF
     auto hr = context_->Map(hwTextureCopy.resource.Get(), 0, D3D11_MAP_READ, 0, &mappedSubresource);
     DXThrowIfFailed(hr, "failed to map D3D11 texture copy resource");
 
-    /* Query MIP-level size to determine image buffer size */
-    auto size = texture.QueryMipLevelSize(mipLevel);
+    /* Copy mapped data into the output buffer (decompress or convert if necessary) */
+    ReadMappedTextureData(
+        textureD3D.GetFormat(), texture.QueryMipLevelSize(mipLevel),
+        mappedSubresource.pData, imageFormat, dataType, buffer
+    );
+
+    /* Unmap resource */
+    context_->Unmap(hwTextureCopy.resource.Get(), 0);
+}
+
+Readback* D3D11RenderSystem::ReadTextureAsync(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType)
+{
+    if (IsCompressedFormat(imageFormat))
+        throw std::invalid_argument("can not read texture into compressed image format");
+
+    auto& textureD3D = LLGL_CAST(const D3D11Texture&, texture);
+
+    /* Determine output image size */
+    auto size       = texture.QueryMipLevelSize(mipLevel);
+    auto imageSize  = static_cast<std::size_t>(size.x) * size.y * size.z * ImageFormatSize(imageFormat) * DataTypeSize(dataType);
+
+    /* Copy subresource into staging texture (the copy is only queued and executed asynchronously) */
+    auto readback = MakeUnique<D3D11Readback>(
+        device_.Get(), context_.Get(), imageSize,
+        textureD3D.GetFormat(), size, imageFormat, dataType
+    );
+
+    textureD3D.CreateSubresourceCopyWithCPUAccess(device_.Get(), context_.Get(), readback->GetStagingTexture(), D3D11_CPU_ACCESS_READ, mipLevel);
+
+    /* Signal the readback once the GPU has finished the copy */
+    readback->InsertEvent();
 
-    /* Check if image buffer must be converted */
-    auto srcTexFormat   = DXGetTextureFormatDesc(textureD3D.GetFormat());
+    return TakeOwnership(readbacks_, std::move(readback));
+}
+
+void D3D11RenderSystem::GenerateMips(Texture& texture)
+{
+    /* Generate MIP-maps for SRV of specified texture */
+    auto& textureD3D = LLGL_CAST(D3D11Texture&, texture);
+    context_->GenerateMips(textureD3D.GetSRV());
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void D3D11RenderSystem::ReadMappedTextureData(
+    DXGI_FORMAT srcFormat, const Gs::Vector3ui& size, const void* srcData,
+    ImageFormat imageFormat, DataType dataType, void* dstData)
+{
+    /* Check if image buffer must be decompressed or converted */
+    auto srcTexFormat   = DXGetTextureFormatDesc(srcFormat);
     auto srcPitch       = DataTypeSize(srcTexFormat.dataType) * ImageFormatSize(srcTexFormat.format);
     auto srcImageSize   = (size.x*size.y*size.z * srcPitch);
+    auto compressedFmt  = D3D11Types::Unmap(srcFormat);
 
-    if (srcTexFormat.format != imageFormat || srcTexFormat.dataType != dataType)
+    if (IsCompressedFormat(compressedFmt))
+    {
+        /* Decompress mapped data into requested format */
+        auto tempData = DecompressImageBuffer(
+            compressedFmt, srcData, CompressedImageSize(compressedFmt, size.x, size.y) * size.z,
+            imageFormat, dataType,
+            size.x, size.y, size.z,
+            GetConfiguration().threadCount
+        );
+
+        /* Copy temporary data into output buffer */
+        auto dstPitch       = DataTypeSize(dataType) * ImageFormatSize(imageFormat);
+        auto dstImageSize   = (size.x*size.y*size.z * dstPitch);
+        ::memcpy(dstData, tempData.get(), dstImageSize);
+    }
+    else if (srcTexFormat.format != imageFormat || srcTexFormat.dataType != dataType)
     {
         /* Convert mapped data into requested format */
         auto tempData = ConvertImageBuffer(
             srcTexFormat.format, srcTexFormat.dataType,
-            mappedSubresource.pData, srcImageSize,
+            srcData, srcImageSize,
             imageFormat, dataType,
             GetConfiguration().threadCount
         );
@@ -269,30 +334,15 @@ void D3D11RenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageF
         /* Copy temporary data into output buffer */
         auto dstPitch       = DataTypeSize(dataType) * ImageFormatSize(imageFormat);
         auto dstImageSize   = (size.x*size.y*size.z * dstPitch);
-        ::memcpy(buffer, tempData.get(), dstImageSize);
+        ::memcpy(dstData, tempData.get(), dstImageSize);
     }
     else
     {
         /* Copy mapped data directly into the output buffer */
-        ::memcpy(buffer, mappedSubresource.pData, srcImageSize);
+        ::memcpy(dstData, srcData, srcImageSize);
     }
-
-    /* Unmap resource */
-    context_->Unmap(hwTextureCopy.resource.Get(), 0);
 }
 
-void D3D11RenderSystem::GenerateMips(Texture& texture)
-{
-    /* Generate MIP-maps for SRV of specified texture */
-    auto& textureD3D = LLGL_CAST(D3D11Texture&, texture);
-    context_->GenerateMips(textureD3D.GetSRV());
-}
-
-
-/*
- * ======= Private: =======
- */
-
 void D3D11RenderSystem::BuildGenericTexture1D(
     D3D11Texture& textureD3D, const TextureDescriptor& descD3D, const ImageDescriptor* imageDesc, UINT miscFlags)
 {
@@ -300,7 +350,7 @@ void D3D11RenderSystem::BuildGenericTexture1D(
     D3D11_TEXTURE1D_DESC texDesc;
     {
         texDesc.Width           = descD3D.texture1D.width;
-        texDesc.MipLevels       = 0;
+        texDesc.MipLevels       = NumMipLevels(descD3D);
         texDesc.ArraySize       = descD3D.texture1D.layers;
         texDesc.Format          = D3D11Types::Map(descD3D.format);
         texDesc.Usage           = D3D11_USAGE_DEFAULT;
@@ -316,7 +366,7 @@ void D3D11RenderSystem::BuildGenericTexture1D(
     {
         /* Update only the first MIP-map level for each array slice */
         auto subImageDesc = *imageDesc;
-        auto subImageStride = descD3D.texture1D.width * ImageFormatSize(subImageDesc.format) * DataTypeSize(subImageDesc.dataType);
+        auto subImageStride = subImageDesc.GetRowStride(descD3D.texture1D.width);
 
         for (unsigned int arraySlice = 0; arraySlice < descD3D.texture1D.layers; ++arraySlice)
         {
@@ -343,7 +393,7 @@ void D3D11RenderSystem::BuildGenericTexture2D(
     {
         texDesc.Width               = descD3D.texture2D.width;
         texDesc.Height              = descD3D.texture2D.height;
-        texDesc.MipLevels           = 0;
+        texDesc.MipLevels           = NumMipLevels(descD3D);
         texDesc.ArraySize           = descD3D.texture2D.layers;
         texDesc.Format              = D3D11Types::Map(descD3D.format);
         texDesc.SampleDesc.Count    = 1;
@@ -359,7 +409,7 @@ void D3D11RenderSystem::BuildGenericTexture2D(
     {
         /* Update only the first MIP-map level for each array slice */
         auto subImageDesc = *imageDesc;
-        auto subImageStride = descD3D.texture2D.width * descD3D.texture2D.height * subImageDesc.GetElementSize();
+        auto subImageStride = subImageDesc.GetImageStride(descD3D.texture2D.width, descD3D.texture2D.height);
 
         for (unsigned int arraySlice = 0; arraySlice < descD3D.texture2D.layers; ++arraySlice)
         {
@@ -387,7 +437,7 @@ void D3D11RenderSystem::BuildGenericTexture3D(
         texDesc.Width           = descD3D.texture3D.width;
         texDesc.Height          = descD3D.texture3D.height;
         texDesc.Depth           = descD3D.texture3D.depth;
-        texDesc.MipLevels       = 0;
+        texDesc.MipLevels       = NumMipLevels(descD3D);
         texDesc.Format          = D3D11Types::Map(descD3D.format);
         texDesc.Usage           = D3D11_USAGE_DEFAULT;
         texDesc.BindFlags       = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
@@ -98,21 +98,21 @@ void D3D11Texture::CreateTexture1D(
     ID3D11Device* device, const D3D11_TEXTURE1D_DESC& desc, const D3D11_SUBRESOURCE_DATA* initialData, const D3D11_SHADER_RESOURCE_VIEW_DESC* srvDesc)
 {
     hardwareTexture_.tex1D = DXCreateTexture1D(device, desc, initialData);
-    CreateSRVAndStoreSettings(device, desc.Format, { desc.Width, 1, 1 }, srvDesc);
+    CreateSRVAndStoreSettings(device, desc.Format, { desc.Width, 1, 1 }, desc.MipLevels, srvDesc);
 }
 
 void D3D11Texture::CreateTexture2D(
     ID3D11Device* device, const D3D11_TEXTURE2D_DESC& desc, const D3D11_SUBRESOURCE_DATA* initialData, const D3D11_SHADER_RESOURCE_VIEW_DESC* srvDesc)
 {
     hardwareTexture_.tex2D = DXCreateTexture2D(device, desc, initialData);
-    CreateSRVAndStoreSettings(device, desc.Format, { desc.Width, desc.Height, 1 }, srvDesc);
+    CreateSRVAndStoreSettings(device, desc.Format, { desc.Width, desc.Height, 1 }, desc.MipLevels, srvDesc);
 }
 
 void D3D11Texture::CreateTexture3D(
     ID3D11Device* device, const D3D11_TEXTURE3D_DESC& desc, const D3D11_SUBRESOURCE_DATA* initialData, const D3D11_SHADER_RESOURCE_VIEW_DESC* srvDesc)
 {
     hardwareTexture_.tex3D = DXCreateTexture3D(device, desc, initialData);
-    CreateSRVAndStoreSettings(device, desc.Format, { desc.Width, desc.Height, desc.Depth }, srvDesc);
+    CreateSRVAndStoreSettings(device, desc.Format, { desc.Width, desc.Height, desc.Depth }, desc.MipLevels, srvDesc);
 }
 
 void D3D11Texture::UpdateSubresource(
@@ -121,47 +121,50 @@ void D3D11Texture::UpdateSubresource(
 {
     /* Get destination subresource index */
     auto dstSubresource = D3D11CalcSubresource(mipSlice, arraySlice, numMipLevels_);
-    auto srcPitch       = DataTypeSize(imageDesc.dataType) * ImageFormatSize(imageDesc.format);
+
+    /* Get source data stride (rows and slices may be padded in the source image) */
+    auto width          = (dstBox.right - dstBox.left);
+    auto height         = (dstBox.bottom - dstBox.top);
+    auto depth          = (dstBox.back - dstBox.front);
+    auto srcRowPitch    = imageDesc.GetRowStride(width);
+    auto srcDepthPitch  = imageDesc.GetImageStride(width, height);
 
     /* Check if source image must be converted */
     auto dstTexFormat = DXGetTextureFormatDesc(format_);
 
     if (dstTexFormat.format != imageDesc.format || dstTexFormat.dataType != imageDesc.dataType)
     {
-        /* Get source data stride */
-        auto srcRowPitch    = (dstBox.right - dstBox.left)*srcPitch;
-        auto srcDepthPitch  = (dstBox.bottom - dstBox.top)*srcRowPitch;
-        auto imageSize      = (dstBox.back - dstBox.front)*srcDepthPitch;
-
-        /* Convert image data from RGB to RGBA */
-        auto tempData = ConvertImageBuffer(
-            imageDesc.format, imageDesc.dataType,
-            imageDesc.buffer, imageSize,
-            dstTexFormat.format, dstTexFormat.dataType,
-            threadCount
-        );
-
         /* Get new source data stride */
-        srcPitch        = DataTypeSize(dstTexFormat.dataType) * ImageFormatSize(dstTexFormat.format);
-        srcRowPitch     = (dstBox.right - dstBox.left)*srcPitch;
-        srcDepthPitch   = (dstBox.bottom - dstBox.top)*srcRowPitch;
+        auto dstPitch       = DataTypeSize(dstTexFormat.dataType) * ImageFormatSize(dstTexFormat.format);
+        auto dstRowPitch    = width*dstPitch;
+        auto dstDepthPitch  = height*dstRowPitch;
+
+        /* Convert image data (e.g. from RGB to RGBA) slice by slice into a tightly packed buffer */
+        ByteBuffer tempData(new char[dstDepthPitch*depth]);
+
+        for (UINT z = 0; z < depth; ++z)
+        {
+            ConvertImageBuffer(
+                imageDesc.format, imageDesc.dataType,
+                reinterpret_cast<const char*>(imageDesc.buffer) + z*srcDepthPitch, srcRowPitch,
+                dstTexFormat.format, dstTexFormat.dataType,
+                tempData.get() + z*dstDepthPitch, dstDepthPitch, dstRowPitch,
+                width, height, threadCount
+            );
+        }
 
         /* Update subresource with specified image data */
         context->UpdateSubresource(
             hardwareTexture_.resource.Get(), dstSubresource,
-            &dstBox, tempData.get(), srcRowPitch, srcDepthPitch
+            &dstBox, tempData.get(), static_cast<UINT>(dstRowPitch), static_cast<UINT>(dstDepthPitch)
         );
     }
     else
     {
-        /* Get source data stride */
-        auto srcRowPitch    = (dstBox.right - dstBox.left)*srcPitch;
-        auto srcDepthPitch  = (dstBox.bottom - dstBox.top)*srcRowPitch;
-
         /* Update subresource with specified image data */
         context->UpdateSubresource(
             hardwareTexture_.resource.Get(), dstSubresource,
-            &dstBox, imageDesc.buffer, srcRowPitch, srcDepthPitch
+            &dstBox, imageDesc.buffer, static_cast<UINT>(srcRowPitch), static_cast<UINT>(srcDepthPitch)
         );
     }
 }
@@ -253,14 +256,14 @@ void D3D11Texture::CreateSRV(ID3D11Device* device, const D3D11_SHADER_RESOURCE_V
 }
 
 void D3D11Texture::CreateSRVAndStoreSettings(
-    ID3D11Device* device, DXGI_FORMAT format, const Gs::Vector3ui& size, const D3D11_SHADER_RESOURCE_VIEW_DESC* srvDesc)
+    ID3D11Device* device, DXGI_FORMAT format, const Gs::Vector3ui& size, UINT mipLevels, const D3D11_SHADER_RESOURCE_VIEW_DESC* srvDesc)
 {
     /* Create SRV for D3D texture */
     CreateSRV(device, srvDesc);
 
-    /* Store format and number of MIP-maps */
+    /* Store format and number of MIP-maps (0 specifies the full MIP-map chain) */
     format_         = format;
-    numMipLevels_   = NumMipLevels(size.x, size.y, size.z);
+    numMipLevels_   = (mipLevels > 0 ? mipLevels : NumMipLevels(size.x, size.y, size.z));
 }
 
 
@@ -138,6 +138,11 @@ void D3D12CommandBuffer::SetConstantBufferArray(BufferArray& bufferArray, unsign
     //todo...
 }
 
+void D3D12CommandBuffer::SetConstantBufferRange(Buffer& buffer, unsigned int slot, std::size_t offset, std::size_t size, long shaderStageFlags)
+{
+    //todo...
+}
+
 void D3D12CommandBuffer::SetStorageBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags)
 {
     //todo...
@@ -168,6 +173,11 @@ void D3D12CommandBuffer::EndStreamOutput()
     // dummy
 }
 
+void D3D12CommandBuffer::CopyBuffer(Buffer& dstBuffer, std::size_t dstOffset, Buffer& srcBuffer, std::size_t srcOffset, std::size_t size)
+{
+    //todo
+}
+
 /* ----- Textures ----- */
 
 void D3D12CommandBuffer::SetTexture(Texture& texture, unsigned int slot, long shaderStageFlags)
@@ -180,6 +190,19 @@ void D3D12CommandBuffer::SetTextureArray(TextureArray& textureArray, unsigned in
     //todo
 }
 
+void D3D12CommandBuffer::CopyTexture(Texture& dstTexture, Texture& srcTexture)
+{
+    //todo
+}
+
+void D3D12CommandBuffer::CopyTextureRegion(
+    Texture& dstTexture, const TextureLocation& dstLocation,
+    Texture& srcTexture, const TextureLocation& srcLocation,
+    const Gs::Vector3ui& extent, unsigned int numLayers)
+{
+    //todo
+}
+
 /* ----- Sampler States ----- */
 
 void D3D12CommandBuffer::SetSampler(Sampler& sampler, unsigned int slot, long shaderStageFlags)
@@ -292,6 +315,38 @@ void D3D12CommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned
     commandList_->DrawIndexedInstanced(numVertices, numInstances, firstIndex, vertexOffset, instanceOffset);
 }
 
+void D3D12CommandBuffer::MultiDraw(const DrawArguments* argsArray, unsigned int numDraws)
+{
+    for (unsigned int i = 0; i < numDraws; ++i)
+        commandList_->DrawInstanced(argsArray[i].numVertices, 1, argsArray[i].firstVertex, 0);
+}
+
+void D3D12CommandBuffer::MultiDrawIndexed(const DrawIndexedArguments* argsArray, unsigned int numDraws)
+{
+    for (unsigned int i = 0; i < numDraws; ++i)
+        commandList_->DrawIndexedInstanced(argsArray[i].numIndices, 1, argsArray[i].firstIndex, argsArray[i].vertexOffset, 0);
+}
+
+void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::size_t offset)
+{
+    //todo...
+}
+
+void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::size_t offset)
+{
+    //todo...
+}
+
+void D3D12CommandBuffer::MultiDrawIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride)
+{
+    //todo...
+}
+
+void D3D12CommandBuffer::MultiDrawIndexedIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride)
+{
+    //todo...
+}
+
 /* ----- Compute ----- */
 
 void D3D12CommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ)
@@ -299,6 +354,11 @@ void D3D12CommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSiz
     commandList_->Dispatch(groupSizeX, groupSizeY, groupSizeZ);
 }
 
+void D3D12CommandBuffer::DispatchIndirect(Buffer& buffer, std::size_t offset)
+{
+    //todo...
+}
+
 /* ----- Misc ----- */
 
 void D3D12CommandBuffer::SyncGPU()
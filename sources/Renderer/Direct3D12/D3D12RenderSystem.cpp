@@ -164,6 +164,43 @@ void D3D12RenderSystem::UnmapBuffer(Buffer& buffer)
     //todo...
 }
 
+void* D3D12RenderSystem::MapBufferRange(Buffer& buffer, std::size_t offset, std::size_t size, long mapFlags)
+{
+    return nullptr;//todo...
+}
+
+void D3D12RenderSystem::FlushMappedRange(Buffer& buffer, std::size_t offset, std::size_t size)
+{
+    //todo...
+}
+
+Readback* D3D12RenderSystem::ReadBufferAsync(const Buffer& buffer, std::size_t offset, std::size_t size)
+{
+    return nullptr;//todo...
+}
+
+/* ----- Streaming buffers ----- */
+
+StreamingBuffer* D3D12RenderSystem::CreateStreamingBuffer(const StreamingBufferDescriptor& desc)
+{
+    return nullptr;//todo...
+}
+
+void D3D12RenderSystem::Release(StreamingBuffer& streamingBuffer)
+{
+    //todo...
+}
+
+std::size_t D3D12RenderSystem::WriteStreamingBuffer(StreamingBuffer& streamingBuffer, const void* data, std::size_t dataSize)
+{
+    return 0;//todo...
+}
+
+void D3D12RenderSystem::AdvanceStreamingBuffer(StreamingBuffer& streamingBuffer)
+{
+    //todo...
+}
+
 /* ----- Textures ----- */
 
 Texture* D3D12RenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageDescriptor* imageDesc)
@@ -208,6 +245,11 @@ void D3D12RenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageF
     //todo
 }
 
+Readback* D3D12RenderSystem::ReadTextureAsync(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType)
+{
+    return nullptr;//todo
+}
+
 void D3D12RenderSystem::GenerateMips(Texture& texture)
 {
     //todo
@@ -303,6 +345,23 @@ void D3D12RenderSystem::Release(Query& query)
     //todo...
 }
 
+/* ----- Readbacks ----- */
+
+const void* D3D12RenderSystem::MapReadback(Readback& readback)
+{
+    return nullptr;//todo...
+}
+
+void D3D12RenderSystem::UnmapReadback(Readback& readback)
+{
+    //todo...
+}
+
+void D3D12RenderSystem::Release(Readback& readback)
+{
+    //todo...
+}
+
 
 /* ----- Extended internal functions ----- */
 
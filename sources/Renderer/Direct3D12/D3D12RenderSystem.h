@@ -67,6 +67,21 @@ class D3D12RenderSystem : public RenderSystem
         void* MapBuffer(Buffer& buffer, const BufferCPUAccess access) override;
         void UnmapBuffer(Buffer& buffer) override;
 
+        void* MapBufferRange(Buffer& buffer, std::size_t offset, std::size_t size, long mapFlags) override;
+        void FlushMappedRange(Buffer& buffer, std::size_t offset, std::size_t size) override;
+
+        Readback* ReadBufferAsync(const Buffer& buffer, std::size_t offset, std::size_t size) override;
+
+        /* ----- Streaming buffers ----- */
+
+        StreamingBuffer* CreateStreamingBuffer(const StreamingBufferDescriptor& desc) override;
+
+        void Release(StreamingBuffer& streamingBuffer) override;
+
+        std::size_t WriteStreamingBuffer(StreamingBuffer& streamingBuffer, const void* data, std::size_t dataSize) override;
+
+        void AdvanceStreamingBuffer(StreamingBuffer& streamingBuffer) override;
+
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const ImageDescriptor* imageDesc = nullptr) override;
@@ -81,6 +96,8 @@ class D3D12RenderSystem : public RenderSystem
 
         void ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) override;
 
+        Readback* ReadTextureAsync(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType) override;
+
         void GenerateMips(Texture& texture) override;
 
         /* ----- Sampler States ---- */
@@ -119,6 +136,13 @@ class D3D12RenderSystem : public RenderSystem
 
         void Release(Query& query) override;
 
+        /* ----- Readbacks ----- */
+
+        const void* MapReadback(Readback& readback) override;
+        void UnmapReadback(Readback& readback) override;
+
+        void Release(Readback& readback) override;
+
         /* ----- Extended internal functions ----- */
 
         ComPtr<IDXGISwapChain1> CreateDXSwapChain(const DXGI_SWAP_CHAIN_DESC1& desc, HWND wnd);
@@ -21,6 +21,7 @@ LLGL_EXPORT unsigned int DataTypeSize(const DataType dataType)
             return 1;
         case DataType::Int16:
         case DataType::UInt16:
+        case DataType::Float16:
             return 2;
         case DataType::Int32:
         case DataType::UInt32:
@@ -48,9 +49,9 @@ LLGL_EXPORT void VectorTypeFormat(const VectorType vectorType, DataType& dataTyp
     auto componentsIdx = vectorTypeIdx % 4;
     vectorTypeIdx /= 4;
 
-    if (vectorTypeIdx < 4)
+    if (vectorTypeIdx < 5)
     {
-        static const DataType vecDataTypes[] = { DataType::Float, DataType::Double, DataType::Int32, DataType::UInt32 };
+        static const DataType vecDataTypes[] = { DataType::Float, DataType::Double, DataType::Int32, DataType::UInt32, DataType::Float16 };
         dataType    = vecDataTypes[vectorTypeIdx];
         components  = (componentsIdx + 1);
     }
@@ -8,6 +8,7 @@
 #include "GLBuffer.h"
 #include "../GLTypes.h"
 #include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionLoader.h"
 
 
 namespace LLGL
@@ -28,6 +29,7 @@ GLBuffer::~GLBuffer()
 void GLBuffer::BufferData(const void* data, GLsizeiptr size, GLenum usage)
 {
     glBufferData(GetTarget(), size, data, usage);
+    size_ = size;
 }
 
 void GLBuffer::BufferSubData(const void* data, GLsizeiptr size, GLintptr offset)
@@ -45,6 +47,62 @@ GLboolean GLBuffer::UnmapBuffer()
     return glUnmapBuffer(GetTarget());
 }
 
+static bool HasReadAccess(long mapFlags)
+{
+    return ((mapFlags & BufferMapFlags::Read) != 0);
+}
+
+static bool HasWriteAccess(long mapFlags)
+{
+    return ((mapFlags & (BufferMapFlags::Write | BufferMapFlags::WriteDiscard | BufferMapFlags::NoOverwrite)) != 0);
+}
+
+static GLbitfield GetGLMapBufferRangeAccess(long mapFlags, bool entireBuffer)
+{
+    GLbitfield access = 0;
+
+    if (HasReadAccess(mapFlags))
+        access |= GL_MAP_READ_BIT;
+    if (HasWriteAccess(mapFlags))
+        access |= GL_MAP_WRITE_BIT;
+
+    /* Invalidate the entire buffer (i.e. orphan the storage) if the range covers the entire buffer */
+    if ((mapFlags & BufferMapFlags::WriteDiscard) != 0)
+        access |= (entireBuffer ? GL_MAP_INVALIDATE_BUFFER_BIT : GL_MAP_INVALIDATE_RANGE_BIT);
+    if ((mapFlags & BufferMapFlags::NoOverwrite) != 0)
+        access |= GL_MAP_UNSYNCHRONIZED_BIT;
+    if ((mapFlags & BufferMapFlags::ExplicitFlush) != 0)
+        access |= GL_MAP_FLUSH_EXPLICIT_BIT;
+
+    return access;
+}
+
+void* GLBuffer::MapBufferRange(GLintptr offset, GLsizeiptr length, long mapFlags)
+{
+    if (HasExtension(GLExt::ARB_map_buffer_range))
+    {
+        auto entireBuffer = (offset == 0 && length == size_);
+        return glMapBufferRange(GetTarget(), offset, length, GetGLMapBufferRangeAccess(mapFlags, entireBuffer));
+    }
+    else
+    {
+        /* Map entire buffer (mapping flags can not be respected without "GL_ARB_map_buffer_range") */
+        GLenum access = GL_WRITE_ONLY;
+        if (HasReadAccess(mapFlags))
+            access = (HasWriteAccess(mapFlags) ? GL_READ_WRITE : GL_READ_ONLY);
+
+        auto data = reinterpret_cast<char*>(glMapBuffer(GetTarget(), access));
+        return (data != nullptr ? data + offset : nullptr);
+    }
+}
+
+void GLBuffer::FlushMappedBufferRange(GLintptr offset, GLsizeiptr length)
+{
+    /* Without "GL_ARB_map_buffer_range", all modifications are flushed when the buffer is unmapped */
+    if (HasExtension(GLExt::ARB_map_buffer_range))
+        glFlushMappedBufferRange(GetTarget(), offset, length);
+}
+
 
 /*
  * ======= Private: =======
@@ -31,6 +31,10 @@ class GLBuffer : public Buffer
         void* MapBuffer(GLenum access);
         GLboolean UnmapBuffer();
 
+        //! Maps the specified range with the specified buffer mapping flags (see BufferMapFlags).
+        void* MapBufferRange(GLintptr offset, GLsizeiptr length, long mapFlags);
+        void FlushMappedBufferRange(GLintptr offset, GLsizeiptr length);
+
         //! Returns the hardware buffer ID.
         inline GLuint GetID() const
         {
@@ -42,7 +46,8 @@ class GLBuffer : public Buffer
         //! Returns the buffer target.
         GLenum GetTarget() const;
 
-        GLuint id_ = 0;
+        GLuint      id_     = 0;
+        GLsizeiptr  size_   = 0;
 
 };
 
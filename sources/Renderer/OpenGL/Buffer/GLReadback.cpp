@@ -0,0 +1,111 @@
+/*
+ * GLReadback.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLReadback.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionLoader.h"
+#include "../RenderState/GLStateManager.h"
+
+
+namespace LLGL
+{
+
+
+// Timeout (in nanoseconds) for a single wait on a fence sync object.
+static const GLuint64 fenceWaitTimeout = 1000000000ull;
+
+GLReadback::GLReadback(std::size_t size) :
+    Readback( size )
+{
+    glGenBuffers(1, &id_);
+
+    /* Allocate staging buffer for reading only */
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, id_);
+    glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_READ);
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+}
+
+GLReadback::~GLReadback()
+{
+    DeleteFence();
+    glDeleteBuffers(1, &id_);
+}
+
+bool GLReadback::IsReady()
+{
+    if (fence_)
+    {
+        /* Poll fence without waiting (the flush makes sure the fence is signaled eventually) */
+        auto result = glClientWaitSync(fence_, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+            DeleteFence();
+        else
+            return false;
+    }
+    return true;
+}
+
+void GLReadback::InsertFence()
+{
+    DeleteFence();
+    if (HasExtension(GLExt::ARB_sync))
+        fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void GLReadback::Wait()
+{
+    if (fence_)
+    {
+        while (true)
+        {
+            auto result = glClientWaitSync(fence_, GL_SYNC_FLUSH_COMMANDS_BIT, fenceWaitTimeout);
+            if (result != GL_TIMEOUT_EXPIRED)
+                break;
+        }
+        DeleteFence();
+    }
+}
+
+const void* GLReadback::Map()
+{
+    /* Wait for the GPU copy to complete, then map the staging buffer */
+    Wait();
+
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, id_);
+    auto data = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+
+    return data;
+}
+
+void GLReadback::Unmap()
+{
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, id_);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLReadback::DeleteFence()
+{
+    if (fence_)
+    {
+        glDeleteSync(fence_);
+        fence_ = nullptr;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,66 @@
+/*
+ * GLReadback.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_GL_READBACK_H__
+#define __LLGL_GL_READBACK_H__
+
+
+#include <LLGL/Readback.h>
+#include "../OpenGL.h"
+
+
+namespace LLGL
+{
+
+
+/*
+Readback with a pixel pack buffer as staging copy.
+The GPU copy into this buffer is guarded by a fence sync object (if "GL_ARB_sync" is supported).
+*/
+class GLReadback : public Readback
+{
+
+    public:
+
+        GLReadback(std::size_t size);
+        ~GLReadback();
+
+        bool IsReady() override;
+
+        //! Inserts the fence sync object after the copy commands, which have been submitted into this readback buffer.
+        void InsertFence();
+
+        //! Waits until the fence sync object has been signaled.
+        void Wait();
+
+        const void* Map();
+        void Unmap();
+
+        //! Returns the hardware buffer ID.
+        inline GLuint GetID() const
+        {
+            return id_;
+        }
+
+    private:
+
+        void DeleteFence();
+
+        GLuint id_      = 0;
+        GLsync fence_   = nullptr;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,171 @@
+/*
+ * GLStreamingBuffer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLStreamingBuffer.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionLoader.h"
+#include "../RenderState/GLStateManager.h"
+#include "../../../Core/Helper.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+// Timeout (in nanoseconds) for a single wait on a fence sync object.
+static const GLuint64 fenceWaitTimeout = 1000000000ull;
+
+GLStreamingBuffer::GLStreamingBuffer(const StreamingBufferDescriptor& desc) :
+    buffer_ { BufferType::Constant }
+{
+    /* Each frame partition must start at a valid uniform buffer offset */
+    GLint alignment = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    if (alignment > 0)
+        alignment_ = static_cast<std::size_t>(alignment);
+
+    frameSize_ = GetAlignedSize(desc.size, alignment_);
+
+    #ifndef __APPLE__
+    if (HasExtension(GLExt::ARB_buffer_storage) && HasExtension(GLExt::ARB_sync))
+    {
+        /* Allocate ring with one partition per frame in flight */
+        numFrames_ = desc.numFrames;
+        AllocStorage();
+    }
+    else
+    #endif
+    {
+        /* Allocate single partition, which is orphaned every frame */
+        OrphanStorage();
+    }
+}
+
+GLStreamingBuffer::~GLStreamingBuffer()
+{
+    for (auto& fence : fences_)
+    {
+        if (fence)
+            glDeleteSync(fence);
+    }
+
+    if (mappedData_)
+    {
+        GLStateManager::active->BindBuffer(buffer_);
+        buffer_.UnmapBuffer();
+    }
+}
+
+Buffer& GLStreamingBuffer::GetBuffer()
+{
+    return buffer_;
+}
+
+std::size_t GLStreamingBuffer::Write(const void* data, std::size_t dataSize)
+{
+    /* Allocate aligned range within the current frame partition */
+    auto offset = GetAlignedSize(offset_, alignment_);
+    if (offset + dataSize > frameSize_)
+    {
+        throw std::out_of_range(
+            "data size exceeds remaining space in frame partition of streaming buffer (" +
+            std::to_string(frameSize_ - std::min(offset, frameSize_)) + " bytes left)"
+        );
+    }
+
+    offset_ = offset + dataSize;
+    offset += frame_ * frameSize_;
+
+    if (mappedData_)
+    {
+        /* Write directly into the persistent and coherent mapping */
+        ::memcpy(mappedData_ + offset, data, dataSize);
+    }
+    else
+    {
+        /* Write into the orphaned storage (this range has not been used by the GPU since the storage was orphaned) */
+        GLStateManager::active->BindBuffer(buffer_);
+        buffer_.BufferSubData(data, static_cast<GLsizeiptr>(dataSize), static_cast<GLintptr>(offset));
+    }
+
+    return offset;
+}
+
+void GLStreamingBuffer::Advance()
+{
+    offset_ = 0;
+
+    if (mappedData_)
+    {
+        /* Fence all commands which have been submitted for the current frame partition */
+        fences_[frame_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        /* Wait until the GPU no longer reads from the next frame partition */
+        frame_ = (frame_ + 1) % numFrames_;
+        WaitForFence(fences_[frame_]);
+    }
+    else
+        OrphanStorage();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLStreamingBuffer::AllocStorage()
+{
+    #ifndef __APPLE__
+
+    const GLbitfield flags  = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+    const auto size         = static_cast<GLsizeiptr>(frameSize_ * numFrames_);
+
+    /* Allocate immutable storage and keep it mapped for the entire lifetime of the buffer */
+    GLStateManager::active->BindBuffer(buffer_);
+    glBufferStorage(GL_UNIFORM_BUFFER, size, nullptr, flags);
+
+    mappedData_ = reinterpret_cast<char*>(glMapBufferRange(GL_UNIFORM_BUFFER, 0, size, flags));
+    if (!mappedData_)
+        throw std::runtime_error("failed to map persistent storage of GL streaming buffer");
+
+    fences_.resize(numFrames_, nullptr);
+
+    #endif
+}
+
+void GLStreamingBuffer::OrphanStorage()
+{
+    /* Re-specify the storage, so the driver can allocate a new block while the GPU still reads from the previous one */
+    GLStateManager::active->BindBuffer(buffer_);
+    buffer_.BufferData(nullptr, static_cast<GLsizeiptr>(frameSize_), GL_STREAM_DRAW);
+}
+
+void GLStreamingBuffer::WaitForFence(GLsync& fence)
+{
+    if (fence)
+    {
+        while (true)
+        {
+            auto result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, fenceWaitTimeout);
+            if (result != GL_TIMEOUT_EXPIRED)
+                break;
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,71 @@
+/*
+ * GLStreamingBuffer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_GL_STREAMING_BUFFER_H__
+#define __LLGL_GL_STREAMING_BUFFER_H__
+
+
+#include <LLGL/StreamingBuffer.h>
+#include "GLBuffer.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Streaming buffer with a uniform buffer as ring of frame partitions.
+If "GL_ARB_buffer_storage" is supported, the entire ring is persistently mapped and each partition is guarded by a fence sync object.
+Otherwise, the buffer only has a single partition, which is orphaned at the beginning of each frame.
+*/
+class GLStreamingBuffer : public StreamingBuffer
+{
+
+    public:
+
+        GLStreamingBuffer(const StreamingBufferDescriptor& desc);
+        ~GLStreamingBuffer();
+
+        Buffer& GetBuffer() override;
+
+        //! Writes the data into the current frame partition and returns the buffer offset.
+        std::size_t Write(const void* data, std::size_t dataSize);
+
+        //! Fences the current frame partition and waits until the next frame partition is no longer in use by the GPU.
+        void Advance();
+
+    private:
+
+        void AllocStorage();
+        void OrphanStorage();
+
+        void WaitForFence(GLsync& fence);
+
+        GLBuffer            buffer_;
+
+        std::size_t         frameSize_      = 0;
+        std::size_t         alignment_      = 1;
+        std::size_t         numFrames_      = 1;
+
+        std::size_t         frame_          = 0;    // Index of the current frame partition
+        std::size_t         offset_         = 0;    // Write offset within the current frame partition
+
+        char*               mappedData_     = nullptr;
+        std::vector<GLsync> fences_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,191 @@
+/*
+ * GLVertexArrayCache.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLVertexArrayCache.h"
+#include "GLVertexBuffer.h"
+#include "../RenderState/GLStateManager.h"
+#include "../../CheckedCast.h"
+#include "../../../Core/Helper.h"
+#include <algorithm>
+#include <functional>
+
+
+namespace LLGL
+{
+
+
+/* ----- Key ----- */
+
+bool GLVertexArrayCache::Key::operator == (const Key& rhs) const
+{
+    return (vertexFormats == rhs.vertexFormats && bufferIDs == rhs.bufferIDs);
+}
+
+template <typename T>
+static void HashCombine(std::size_t& seed, const T& value)
+{
+    seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+std::size_t GLVertexArrayCache::KeyHasher::operator () (const Key& key) const
+{
+    std::size_t seed = 0;
+
+    for (auto vertexFormat : key.vertexFormats)
+        HashCombine(seed, vertexFormat);
+    for (auto bufferID : key.bufferIDs)
+        HashCombine(seed, bufferID);
+
+    return seed;
+}
+
+
+/* ----- GLVertexArrayCache class ----- */
+
+GLuint GLVertexArrayCache::Acquire(unsigned int numBuffers, Buffer* const * bufferArray, bool& cacheHit)
+{
+    /* Build key from interned vertex formats and buffer IDs */
+    Key key;
+    key.vertexFormats.reserve(numBuffers);
+    key.bufferIDs.reserve(numBuffers);
+
+    for (unsigned int i = 0; i < numBuffers; ++i)
+    {
+        auto vertexBufferGL = LLGL_CAST(const GLVertexBuffer*, bufferArray[i]);
+        key.vertexFormats.push_back(&(vertexBufferGL->GetVertexFormat()));
+        key.bufferIDs.push_back(vertexBufferGL->GetID());
+    }
+
+    /* Find cached VAO */
+    auto it = vertexArrays_.find(key);
+    if (it != vertexArrays_.end())
+    {
+        cacheHit = true;
+        entries_[it->second]->refCount++;
+        return it->second;
+    }
+
+    cacheHit = false;
+
+    /* Build new VAO with the attributes of all vertex buffers */
+    auto entry = MakeUnique<Entry>();
+
+    GLStateManager::active->BindVertexArray(entry->vao.GetID());
+    {
+        GLuint index = 0;
+
+        for (std::size_t i = 0; i < key.bufferIDs.size(); ++i)
+        {
+            const auto& vertexFormat = *key.vertexFormats[i];
+
+            /* Bind VBO */
+            GLStateManager::active->BindBuffer(GLBufferTarget::ARRAY_BUFFER, key.bufferIDs[i]);
+
+            /* Build each vertex attribute */
+            for (const auto& attrib : vertexFormat.attributes)
+                entry->vao.BuildVertexAttribute(attrib, vertexFormat.stride, index++);
+        }
+    }
+    GLStateManager::active->BindVertexArray(0);
+
+    /* Store new entry with a single reference */
+    auto vaoID = entry->vao.GetID();
+
+    for (auto bufferID : key.bufferIDs)
+        bufferReferences_[bufferID].push_back(vaoID);
+
+    entry->refCount = 1;
+    entry->key      = key;
+
+    vertexArrays_[std::move(key)] = vaoID;
+    entries_[vaoID] = std::move(entry);
+
+    return vaoID;
+}
+
+void GLVertexArrayCache::Release(GLuint vaoID)
+{
+    auto it = entries_.find(vaoID);
+    if (it != entries_.end())
+    {
+        auto& entry = *(it->second);
+        if (entry.refCount > 0)
+            --entry.refCount;
+
+        /* Delete invalidated VAO with its last reference */
+        if (entry.refCount == 0 && !entry.cached)
+            DeleteEntry(vaoID);
+    }
+}
+
+void GLVertexArrayCache::InvalidateBuffer(GLuint bufferID)
+{
+    auto it = bufferReferences_.find(bufferID);
+    if (it != bufferReferences_.end())
+    {
+        auto vaoIDs = std::move(it->second);
+        bufferReferences_.erase(it);
+
+        for (auto vaoID : vaoIDs)
+        {
+            auto entryIt = entries_.find(vaoID);
+            if (entryIt == entries_.end())
+                continue;
+
+            /* Remove VAO from the cache, since the buffer ID might be re-used by a new buffer */
+            auto& entry = *(entryIt->second);
+            if (entry.cached)
+            {
+                vertexArrays_.erase(entry.key);
+                entry.cached = false;
+            }
+
+            if (entry.refCount == 0)
+                DeleteEntry(vaoID);
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLVertexArrayCache::DeleteEntry(GLuint vaoID)
+{
+    auto it = entries_.find(vaoID);
+    if (it == entries_.end())
+        return;
+
+    auto& entry = *(it->second);
+
+    /* Remove VAO from the references of all its buffers */
+    for (auto bufferID : entry.key.bufferIDs)
+    {
+        auto refIt = bufferReferences_.find(bufferID);
+        if (refIt != bufferReferences_.end())
+        {
+            auto& vaoIDs = refIt->second;
+            vaoIDs.erase(std::remove(vaoIDs.begin(), vaoIDs.end(), vaoID), vaoIDs.end());
+            if (vaoIDs.empty())
+                bufferReferences_.erase(refIt);
+        }
+    }
+
+    if (entry.cached)
+        vertexArrays_.erase(entry.key);
+
+    /* Delete VAO */
+    entries_.erase(it);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,86 @@
+/*
+ * GLVertexArrayCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_GL_VERTEX_ARRAY_CACHE_H__
+#define __LLGL_GL_VERTEX_ARRAY_CACHE_H__
+
+
+#include "GLVertexArrayObject.h"
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+
+namespace LLGL
+{
+
+
+class Buffer;
+
+/*
+Cache of the VAOs for vertex buffer arrays.
+Each VAO is keyed by the interned vertex formats and the IDs of its vertex buffers, and it is reference counted by the buffer arrays.
+A VAO without references is kept in the cache, until one of its vertex buffers is released.
+*/
+class GLVertexArrayCache
+{
+
+    public:
+
+        /**
+        \brief Returns the VAO for the specified vertex buffers and increments its reference counter.
+        \param[out] cacheHit Specifies whether the VAO has been found in the cache. Otherwise, a new VAO has been built.
+        */
+        GLuint Acquire(unsigned int numBuffers, Buffer* const * bufferArray, bool& cacheHit);
+
+        //! Decrements the reference counter of the specified VAO.
+        void Release(GLuint vaoID);
+
+        //! Removes all VAOs that refer to the specified vertex buffer from the cache. VAOs that are still referenced are deleted with their last release.
+        void InvalidateBuffer(GLuint bufferID);
+
+    private:
+
+        struct Key
+        {
+            std::vector<const VertexFormat*>    vertexFormats;
+            std::vector<GLuint>                 bufferIDs;
+
+            bool operator == (const Key& rhs) const;
+        };
+
+        struct KeyHasher
+        {
+            std::size_t operator () (const Key& key) const;
+        };
+
+        struct Entry
+        {
+            GLVertexArrayObject vao;
+            Key                 key;
+            unsigned int        refCount    = 0;
+            bool                cached      = true; // False if the entry has been invalidated, i.e. it can no longer be found
+        };
+
+        // Deletes the specified entry and removes the VAO from all buffer references.
+        void DeleteEntry(GLuint vaoID);
+
+        std::unordered_map<GLuint, std::unique_ptr<Entry>>  entries_;           // Entries by VAO ID
+        std::unordered_map<Key, GLuint, KeyHasher>          vertexArrays_;      // VAO IDs by key (only cached entries)
+        std::unordered_map<GLuint, std::vector<GLuint>>     bufferReferences_;  // VAO IDs by buffer ID
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -27,6 +27,18 @@ GLVertexArrayObject::~GLVertexArrayObject()
     glDeleteVertexArrays(1, &id_);
 }
 
+// Returns true if the specified attribute must be specified as integral vertex attribute (i.e. with "glVertexAttribI*").
+static bool IsIntegralVertexAttribute(const VertexAttribute& attribute, DataType dataType)
+{
+    if (!attribute.conversion && dataType != DataType::Float && dataType != DataType::Double && dataType != DataType::Float16)
+    {
+        if (!HasExtension(GLExt::EXT_gpu_shader4))
+            ThrowNotSupported("integral vertex attributes");
+        return true;
+    }
+    return false;
+}
+
 void GLVertexArrayObject::BuildVertexAttribute(const VertexAttribute& attribute, unsigned int stride, unsigned int index)
 {
     /* Enable array index in currently bound VAO */
@@ -42,11 +54,8 @@ void GLVertexArrayObject::BuildVertexAttribute(const VertexAttribute& attribute,
     VectorTypeFormat(attribute.vectorType, dataType, components);
 
     /* Use currently bound VBO for VertexAttribPointer functions */
-    if (!attribute.conversion && dataType != DataType::Float && dataType != DataType::Double)
+    if (IsIntegralVertexAttribute(attribute, dataType))
     {
-        if (!HasExtension(GLExt::EXT_gpu_shader4))
-            ThrowNotSupported("integral vertex attributes");
-
         glVertexAttribIPointer(
             index,
             components,
@@ -68,6 +77,45 @@ void GLVertexArrayObject::BuildVertexAttribute(const VertexAttribute& attribute,
     }
 }
 
+void GLVertexArrayObject::BuildVertexAttributeFormat(const VertexAttribute& attribute, unsigned int bindingIndex, unsigned int index)
+{
+    #ifndef __APPLE__
+
+    /* Enable array index in currently bound VAO */
+    glEnableVertexAttribArray(index);
+
+    /* Get data type and components of vector type */
+    DataType        dataType    = DataType::Float;
+    unsigned int    components  = 0;
+    VectorTypeFormat(attribute.vectorType, dataType, components);
+
+    /* Specify attribute format relative to the vertex buffer binding point */
+    if (IsIntegralVertexAttribute(attribute, dataType))
+    {
+        glVertexAttribIFormat(
+            index,
+            components,
+            GLTypes::Map(dataType),
+            attribute.offset
+        );
+    }
+    else
+    {
+        glVertexAttribFormat(
+            index,
+            components,
+            GLTypes::Map(dataType),
+            GL_FALSE,
+            attribute.offset
+        );
+    }
+
+    /* Associate attribute with vertex buffer binding point */
+    glVertexAttribBinding(index, bindingIndex);
+
+    #endif
+}
+
 
 } // /namespace LLGL
 
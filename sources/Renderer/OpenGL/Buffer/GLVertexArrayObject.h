@@ -27,6 +27,12 @@ class GLVertexArrayObject
 
         void BuildVertexAttribute(const VertexAttribute& attribute, unsigned int stride, unsigned int index);
 
+        /**
+        \brief Builds the vertex attribute format with a separate vertex buffer binding point (requires "GL_ARB_vertex_attrib_binding").
+        \remarks The instance divisor is a state of the binding point and must be set with "glVertexBindingDivisor".
+        */
+        void BuildVertexAttributeFormat(const VertexAttribute& attribute, unsigned int bindingIndex, unsigned int index);
+
         //! Returns the ID of the hardware vertex-array-object (VAO)
         inline GLuint GetID() const
         {
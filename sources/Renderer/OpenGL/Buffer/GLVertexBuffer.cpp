@@ -7,19 +7,25 @@
 
 #include "GLVertexBuffer.h"
 #include "../RenderState/GLStateManager.h"
+#include "../../../Core/Helper.h"
 
 
 namespace LLGL
 {
 
 
-GLVertexBuffer::GLVertexBuffer() :
-    GLBuffer( BufferType::Vertex )
+GLVertexBuffer::GLVertexBuffer(const VertexFormat& vertexFormat) :
+    GLBuffer        ( BufferType::Vertex ),
+    vertexFormat_   ( vertexFormat       )
 {
 }
 
-void GLVertexBuffer::BuildVertexArray(const VertexFormat& vertexFormat)
+void GLVertexBuffer::BuildVertexArray()
 {
+    /* Create own VAO */
+    vao_    = MakeUnique<GLVertexArrayObject>();
+    vaoID_  = vao_->GetID();
+
     /* Bind VAO */
     GLStateManager::active->BindVertexArray(GetVaoID());
     {
@@ -27,13 +33,16 @@ void GLVertexBuffer::BuildVertexArray(const VertexFormat& vertexFormat)
         GLStateManager::active->BindBuffer(GLBufferTarget::ARRAY_BUFFER, GetID());
 
         /* Build each vertex attribute */
-        for (unsigned int i = 0, n = static_cast<unsigned int>(vertexFormat.attributes.size()); i < n; ++i)
-            vao_.BuildVertexAttribute(vertexFormat.attributes[i], vertexFormat.stride, i);
+        for (unsigned int i = 0, n = static_cast<unsigned int>(vertexFormat_.attributes.size()); i < n; ++i)
+            vao_->BuildVertexAttribute(vertexFormat_.attributes[i], vertexFormat_.stride, i);
     }
     GLStateManager::active->BindVertexArray(0);
+}
 
-    /* Store vertex format (required if this buffer is used in a buffer array) */
-    vertexFormat_ = vertexFormat;
+void GLVertexBuffer::UseSharedVertexArray(GLuint vaoID)
+{
+    vao_.reset();
+    vaoID_ = vaoID;
 }
 
 
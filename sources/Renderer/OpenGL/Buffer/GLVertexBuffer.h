@@ -11,6 +11,7 @@
 
 #include "GLBuffer.h"
 #include "GLVertexArrayObject.h"
+#include <memory>
 
 
 namespace LLGL
@@ -22,17 +23,28 @@ class GLVertexBuffer : public GLBuffer
 
     public:
 
-        GLVertexBuffer();
+        //! Constructs the vertex buffer with an interned vertex format (see GLVertexFormatRegistry::InternVertexFormat).
+        GLVertexBuffer(const VertexFormat& vertexFormat);
 
-        void BuildVertexArray(const VertexFormat& vertexFormat);
+        //! Builds a separate VAO for this vertex buffer.
+        void BuildVertexArray();
+
+        //! Uses the specified shared VAO, whose binding point 0 must be bound to this buffer before drawing (see GLVertexFormatRegistry).
+        void UseSharedVertexArray(GLuint vaoID);
 
         //! Returns the ID of the vertex-array-object (VAO)
         inline GLuint GetVaoID() const
         {
-            return vao_.GetID();
+            return vaoID_;
+        }
+
+        //! Returns true if this buffer uses a shared VAO.
+        inline bool HasSharedVertexArray() const
+        {
+            return (vao_ == nullptr);
         }
 
-        //! Returns the vertex format.
+        //! Returns the interned vertex format.
         inline const VertexFormat& GetVertexFormat() const
         {
             return vertexFormat_;
@@ -40,8 +52,9 @@ class GLVertexBuffer : public GLBuffer
 
     private:
 
-        GLVertexArrayObject vao_;
-        VertexFormat        vertexFormat_;
+        std::unique_ptr<GLVertexArrayObject>    vao_;
+        GLuint                                  vaoID_          = 0;
+        const VertexFormat&                     vertexFormat_;
 
 };
 
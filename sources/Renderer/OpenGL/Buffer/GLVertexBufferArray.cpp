@@ -7,7 +7,6 @@
 
 #include "GLVertexBufferArray.h"
 #include "GLVertexBuffer.h"
-#include "../RenderState/GLStateManager.h"
 #include "../../CheckedCast.h"
 
 
@@ -20,28 +19,29 @@ GLVertexBufferArray::GLVertexBufferArray() :
 {
 }
 
-void GLVertexBufferArray::BuildVertexArray(unsigned int numBuffers, Buffer* const * bufferArray)
+void GLVertexBufferArray::UseCachedVertexArray(GLuint vaoID)
 {
-    /* Bind VAO */
-    GLStateManager::active->BindVertexArray(GetVaoID());
+    vaoID_              = vaoID;
+    sharedVertexArray_  = false;
+}
+
+void GLVertexBufferArray::UseSharedVertexArray(GLuint vaoID, unsigned int numBuffers, Buffer* const * bufferArray)
+{
+    vaoID_              = vaoID;
+    sharedVertexArray_  = true;
+
+    /* Store buffer IDs and strides for the binding points of the shared VAO */
+    BuildArray(numBuffers, bufferArray);
+
+    offsets_.assign(numBuffers, 0);
+    strides_.clear();
+    strides_.reserve(numBuffers);
+
+    for (unsigned int i = 0; i < numBuffers; ++i)
     {
-        for (unsigned int i = 0; numBuffers > 0; --numBuffers)
-        {
-            auto vertexBufferGL = LLGL_CAST(GLVertexBuffer*, (*bufferArray));
-            {
-                const auto& vertexFormat = vertexBufferGL->GetVertexFormat();
-
-                /* Bind VBO */
-                GLStateManager::active->BindBuffer(GLBufferTarget::ARRAY_BUFFER, vertexBufferGL->GetID());
-
-                /* Build each vertex attribute */
-                for (unsigned int j = 0, n = static_cast<unsigned int>(vertexFormat.attributes.size()); j < n; ++j, ++i)
-                    vao_.BuildVertexAttribute(vertexFormat.attributes[j], vertexFormat.stride, i);
-            }
-            ++bufferArray;
-        }
+        auto vertexBufferGL = LLGL_CAST(GLVertexBuffer*, bufferArray[i]);
+        strides_.push_back(static_cast<GLsizei>(vertexBufferGL->GetVertexFormat().stride));
     }
-    GLStateManager::active->BindVertexArray(0);
 }
 
 
@@ -24,17 +24,43 @@ class GLVertexBufferArray : public GLBufferArray
 
         GLVertexBufferArray();
 
-        void BuildVertexArray(unsigned int numBuffers, Buffer* const * bufferArray);
+        //! Uses the specified VAO, which is owned by the vertex array cache (see GLVertexArrayCache).
+        void UseCachedVertexArray(GLuint vaoID);
+
+        //! Uses the specified shared VAO, whose binding points must be bound to the buffers before drawing (see GLVertexFormatRegistry).
+        void UseSharedVertexArray(GLuint vaoID, unsigned int numBuffers, Buffer* const * bufferArray);
 
         //! Returns the ID of the vertex-array-object (VAO)
         inline GLuint GetVaoID() const
         {
-            return vao_.GetID();
+            return vaoID_;
+        }
+
+        //! Returns true if this buffer array uses a shared VAO.
+        inline bool HasSharedVertexArray() const
+        {
+            return sharedVertexArray_;
+        }
+
+        //! Returns the array of buffer offsets for "glBindVertexBuffers" (all zero).
+        inline const std::vector<GLintptr>& GetOffsetArray() const
+        {
+            return offsets_;
+        }
+
+        //! Returns the array of vertex strides for "glBindVertexBuffers".
+        inline const std::vector<GLsizei>& GetStrideArray() const
+        {
+            return strides_;
         }
 
     private:
 
-        GLVertexArrayObject vao_;
+        GLuint                  vaoID_              = 0;
+        bool                    sharedVertexArray_  = false;
+
+        std::vector<GLintptr>   offsets_;
+        std::vector<GLsizei>    strides_;
 
 };
 
@@ -0,0 +1,113 @@
+/*
+ * GLVertexFormatRegistry.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLVertexFormatRegistry.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionLoader.h"
+#include "../RenderState/GLStateManager.h"
+#include "../../../Core/Helper.h"
+
+
+namespace LLGL
+{
+
+
+// Minimal value of GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET that is guaranteed by the specification.
+static const unsigned int maxVertexAttribRelativeOffset = 2047;
+
+// Returns true if the specified vertex format can be bound to a single binding point.
+static bool IsVertexFormatSeparable(const VertexFormat& vertexFormat)
+{
+    if (vertexFormat.attributes.empty())
+        return false;
+
+    /* The instance divisor is a state of the binding point, so all attributes of a vertex buffer must share the same divisor */
+    auto instanceDivisor = vertexFormat.attributes.front().instanceDivisor;
+
+    for (const auto& attrib : vertexFormat.attributes)
+    {
+        if (attrib.instanceDivisor != instanceDivisor || attrib.offset > maxVertexAttribRelativeOffset)
+            return false;
+    }
+
+    return true;
+}
+
+const VertexFormat* GLVertexFormatRegistry::InternVertexFormat(const VertexFormat& vertexFormat)
+{
+    /* Find equal vertex format */
+    for (const auto& entry : vertexFormats_)
+    {
+        if (entry->stride == vertexFormat.stride && entry->attributes == vertexFormat.attributes)
+            return entry.get();
+    }
+
+    /* Store copy of new vertex format */
+    vertexFormats_.emplace_back(MakeUnique<VertexFormat>(vertexFormat));
+    return vertexFormats_.back().get();
+}
+
+GLuint GLVertexFormatRegistry::GetVertexArray(const std::vector<const VertexFormat*>& vertexFormats)
+{
+    #ifndef __APPLE__
+
+    if (!HasExtension(GLExt::ARB_vertex_attrib_binding) || vertexFormats.empty())
+        return 0;
+
+    /* Find VAO with the same vertex formats */
+    for (const auto& entry : vertexArrays_)
+    {
+        if (entry->vertexFormats == vertexFormats)
+            return entry->vao.GetID();
+    }
+
+    for (auto vertexFormat : vertexFormats)
+    {
+        if (!IsVertexFormatSeparable(*vertexFormat))
+            return 0;
+    }
+
+    /* Create new VAO for the vertex formats */
+    auto entry = MakeUnique<SharedVertexArray>();
+
+    GLStateManager::active->BindVertexArray(entry->vao.GetID());
+    {
+        GLuint index = 0;
+
+        for (GLuint bindingIndex = 0; bindingIndex < vertexFormats.size(); ++bindingIndex)
+        {
+            const auto& vertexFormat = *vertexFormats[bindingIndex];
+
+            /* Build attribute formats for the binding point of this vertex format */
+            for (const auto& attrib : vertexFormat.attributes)
+                entry->vao.BuildVertexAttributeFormat(attrib, bindingIndex, index++);
+
+            glVertexBindingDivisor(bindingIndex, vertexFormat.attributes.front().instanceDivisor);
+        }
+    }
+    GLStateManager::active->BindVertexArray(0);
+
+    entry->vertexFormats = vertexFormats;
+
+    auto vaoID = entry->vao.GetID();
+    vertexArrays_.emplace_back(std::move(entry));
+
+    return vaoID;
+
+    #else
+
+    return 0;
+
+    #endif
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,67 @@
+/*
+ * GLVertexFormatRegistry.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef __LLGL_GL_VERTEX_FORMAT_REGISTRY_H__
+#define __LLGL_GL_VERTEX_FORMAT_REGISTRY_H__
+
+
+#include "GLVertexArrayObject.h"
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Registry of distinct (interned) vertex formats.
+With "GL_ARB_vertex_attrib_binding", the registry also provides one shared VAO per combination of vertex formats.
+The vertex attribute formats are then separated from the vertex buffers, i.e. the vertex buffer of the n-th format
+is bound to the n-th binding point of the shared VAO with "glBindVertexBuffer(s)" whenever the buffer is set.
+*/
+class GLVertexFormatRegistry
+{
+
+    public:
+
+        /**
+        \brief Returns the unique instance of the specified vertex format.
+        \remarks Interned vertex formats are equal if and only if their addresses are equal.
+        They remain valid for the lifetime of the registry.
+        */
+        const VertexFormat* InternVertexFormat(const VertexFormat& vertexFormat);
+
+        /**
+        \brief Returns the shared VAO for the specified interned vertex formats, or 0 if the vertex formats can not be separated from their buffers.
+        \remarks The VAO is created the first time the combination of vertex formats is requested.
+        The vertex attribute locations are enumerated over all formats, in the same way as with a VAO of a vertex buffer array.
+        */
+        GLuint GetVertexArray(const std::vector<const VertexFormat*>& vertexFormats);
+
+    private:
+
+        struct SharedVertexArray
+        {
+            std::vector<const VertexFormat*>    vertexFormats;
+            GLVertexArrayObject                 vao;
+        };
+
+        std::vector<std::unique_ptr<VertexFormat>>      vertexFormats_;
+        std::vector<std::unique_ptr<SharedVertexArray>> vertexArrays_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -10,6 +10,7 @@
 #include "GLExtensionsNull.h"
 #include <LLGL/Log.h>
 #include <functional>
+#include <cstdio>
 
 
 namespace LLGL
@@ -61,6 +62,18 @@ static void ExtractExtensionsFromString(std::set<std::string>& extensions, const
 
 #ifndef __APPLE__
 
+// Returns true if the version of the current GL context is greater than or equal to the specified version.
+static bool HasGLVersion(int major, int minor)
+{
+    int versionMajor = 0, versionMinor = 0;
+
+    auto versionString = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+    if (!versionString || std::sscanf(versionString, "%d.%d", &versionMajor, &versionMinor) != 2)
+        return false;
+
+    return (versionMajor > major || (versionMajor == major && versionMinor >= minor));
+}
+
 #define LOAD_GLPROC_SIMPLE(NAME) \
     LoadGLProc(NAME, #NAME)
 
@@ -115,13 +128,14 @@ bool LoadCreateContextProcs()
 
 static bool Load_GL_ARB_vertex_buffer_object(bool usePlaceHolder)
 {
-    LOAD_GLPROC( glGenBuffers    );
-    LOAD_GLPROC( glDeleteBuffers );
-    LOAD_GLPROC( glBindBuffer    );
-    LOAD_GLPROC( glBufferData    );
-    LOAD_GLPROC( glBufferSubData );
-    LOAD_GLPROC( glMapBuffer     );
-    LOAD_GLPROC( glUnmapBuffer   );
+    LOAD_GLPROC( glGenBuffers       );
+    LOAD_GLPROC( glDeleteBuffers    );
+    LOAD_GLPROC( glBindBuffer       );
+    LOAD_GLPROC( glBufferData       );
+    LOAD_GLPROC( glBufferSubData    );
+    LOAD_GLPROC( glGetBufferSubData );
+    LOAD_GLPROC( glMapBuffer        );
+    LOAD_GLPROC( glUnmapBuffer      );
 
     #if 1//TODO: which extension???
     LOAD_GLPROC( glEnableVertexAttribArray  );
@@ -132,6 +146,19 @@ static bool Load_GL_ARB_vertex_buffer_object(bool usePlaceHolder)
     return true;
 }
 
+static bool Load_GL_ARB_map_buffer_range(bool usePlaceHolder)
+{
+    LOAD_GLPROC( glMapBufferRange         );
+    LOAD_GLPROC( glFlushMappedBufferRange );
+    return true;
+}
+
+static bool Load_GL_ARB_buffer_storage(bool usePlaceHolder)
+{
+    LOAD_GLPROC( glBufferStorage );
+    return true;
+}
+
 static bool Load_GL_ARB_vertex_array_object(bool usePlaceHolder)
 {
     LOAD_GLPROC( glGenVertexArrays    );
@@ -140,6 +167,17 @@ static bool Load_GL_ARB_vertex_array_object(bool usePlaceHolder)
     return true;
 }
 
+static bool Load_GL_ARB_vertex_attrib_binding(bool usePlaceHolder)
+{
+    LOAD_GLPROC( glBindVertexBuffer     );
+    LOAD_GLPROC( glVertexAttribFormat   );
+    LOAD_GLPROC( glVertexAttribIFormat  );
+    LOAD_GLPROC( glVertexAttribLFormat  );
+    LOAD_GLPROC( glVertexAttribBinding  );
+    LOAD_GLPROC( glVertexBindingDivisor );
+    return true;
+}
+
 static bool Load_GL_ARB_framebuffer_object(bool usePlaceHolder)
 {
     LOAD_GLPROC( glGenRenderbuffers                    );
@@ -170,6 +208,7 @@ static bool Load_GL_ARB_uniform_buffer_object(bool usePlaceHolder)
     LOAD_GLPROC( glGetActiveUniformBlockName );
     LOAD_GLPROC( glUniformBlockBinding       );
     LOAD_GLPROC( glBindBufferBase            );
+    LOAD_GLPROC( glBindBufferRange           );
     return true;
 }
 
@@ -206,6 +245,27 @@ static bool Load_GL_ARB_draw_elements_base_vertex(bool usePlaceHolder)
 {
     LOAD_GLPROC( glDrawElementsBaseVertex          );
     LOAD_GLPROC( glDrawElementsInstancedBaseVertex );
+    LOAD_GLPROC( glMultiDrawElementsBaseVertex     );
+    return true;
+}
+
+static bool Load_GL_EXT_multi_draw_arrays(bool usePlaceHolder)
+{
+    LOAD_GLPROC( glMultiDrawArrays );
+    return true;
+}
+
+static bool Load_GL_ARB_draw_indirect(bool usePlaceHolder)
+{
+    LOAD_GLPROC( glDrawArraysIndirect   );
+    LOAD_GLPROC( glDrawElementsIndirect );
+    return true;
+}
+
+static bool Load_GL_ARB_multi_draw_indirect(bool usePlaceHolder)
+{
+    LOAD_GLPROC( glMultiDrawArraysIndirect   );
+    LOAD_GLPROC( glMultiDrawElementsIndirect );
     return true;
 }
 
@@ -337,6 +397,21 @@ static bool Load_GL_ARB_texture_multisample(bool usePlaceHolder)
     return true;
 }
 
+static bool Load_GL_ARB_texture_storage(bool usePlaceHolder)
+{
+    LOAD_GLPROC( glTexStorage1D );
+    LOAD_GLPROC( glTexStorage2D );
+    LOAD_GLPROC( glTexStorage3D );
+    return true;
+}
+
+static bool Load_GL_ARB_texture_storage_multisample(bool usePlaceHolder)
+{
+    LOAD_GLPROC( glTexStorage2DMultisample );
+    LOAD_GLPROC( glTexStorage3DMultisample );
+    return true;
+}
+
 static bool Load_GL_ARB_sampler_objects(bool usePlaceHolder)
 {
     LOAD_GLPROC( glGenSamplers        );
@@ -377,6 +452,36 @@ static bool Load_GL_ARB_timer_query(bool usePlaceHolder)
     return true;
 }
 
+static bool Load_GL_ARB_sync(bool usePlaceHolder)
+{
+    LOAD_GLPROC( glFenceSync      );
+    LOAD_GLPROC( glIsSync         );
+    LOAD_GLPROC( glDeleteSync     );
+    LOAD_GLPROC( glClientWaitSync );
+    LOAD_GLPROC( glWaitSync       );
+    LOAD_GLPROC( glGetSynciv      );
+    return true;
+}
+
+static bool Load_GL_ARB_copy_buffer(bool usePlaceHolder)
+{
+    LOAD_GLPROC( glCopyBufferSubData );
+    return true;
+}
+
+static bool Load_GL_ARB_copy_image(bool usePlaceHolder)
+{
+    LOAD_GLPROC( glCopyImageSubData );
+    return true;
+}
+
+static bool Load_GL_ARB_shader_image_load_store(bool usePlaceHolder)
+{
+    LOAD_GLPROC( glBindImageTexture );
+    LOAD_GLPROC( glMemoryBarrier    );
+    return true;
+}
+
 static bool Load_GL_ARB_viewport_array(bool usePlaceHolder)
 {
     LOAD_GLPROC( glViewportArrayv   );
@@ -570,6 +675,7 @@ void LoadAllExtensions(GLExtensionList& extensions)
     
     /* Enable hardware buffer extensions */
     ENABLE_GLEXT( ARB_vertex_buffer_object         );
+    ENABLE_GLEXT( ARB_map_buffer_range             );
     ENABLE_GLEXT( ARB_vertex_array_object          );
     ENABLE_GLEXT( ARB_framebuffer_object           );
     ENABLE_GLEXT( ARB_uniform_buffer_object        );
@@ -580,6 +686,8 @@ void LoadAllExtensions(GLExtensionList& extensions)
     ENABLE_GLEXT( ARB_draw_instanced               );
     ENABLE_GLEXT( ARB_base_instance                );
     ENABLE_GLEXT( ARB_draw_elements_base_vertex    );
+    ENABLE_GLEXT( EXT_multi_draw_arrays            );
+    ENABLE_GLEXT( ARB_draw_indirect                );
     
     /* Enable shader extensions */
     ENABLE_GLEXT( ARB_shader_objects               );
@@ -596,6 +704,8 @@ void LoadAllExtensions(GLExtensionList& extensions)
     ENABLE_GLEXT( ARB_clear_texture                );
     ENABLE_GLEXT( ARB_texture_compression          );
     ENABLE_GLEXT( ARB_texture_multisample          );
+    ENABLE_GLEXT( ARB_texture_storage              );
+    ENABLE_GLEXT( ARB_texture_storage_multisample  );
     ENABLE_GLEXT( ARB_sampler_objects              );
     
     /* Enable blending extensions */
@@ -610,6 +720,8 @@ void LoadAllExtensions(GLExtensionList& extensions)
     ENABLE_GLEXT( ARB_occlusion_query              );
     ENABLE_GLEXT( NV_conditional_render            );
     ENABLE_GLEXT( ARB_timer_query                  );
+    ENABLE_GLEXT( ARB_sync                         );
+    ENABLE_GLEXT( ARB_copy_buffer                  );
     ENABLE_GLEXT( ARB_multi_bind                   );
     ENABLE_GLEXT( EXT_stencil_two_side             );
     ENABLE_GLEXT( KHR_debug                        );
@@ -625,6 +737,7 @@ void LoadAllExtensions(GLExtensionList& extensions)
     ENABLE_GLEXT( ARB_geometry_shader4             );
     ENABLE_GLEXT( NV_conservative_raster           );
     ENABLE_GLEXT( INTEL_conservative_rasterization );
+    ENABLE_GLEXT( EXT_texture_compression_s3tc     );
     
     #undef ENABLE_GLEXT
     
@@ -660,15 +773,28 @@ void LoadAllExtensions(GLExtensionList& extensions)
             EnableExtensionSupport(viewerExt);
     };
 
+    auto LoadCoreFeature = [&](int major, int minor, const std::function<bool(bool)>& extLoadingProc, GLExt viewerExt) -> void
+    {
+        /* Try to load procedures which are core since the specified GL version, but which core profiles do not list as extension */
+        if (!HasExtension(viewerExt) && HasGLVersion(major, minor) && extLoadingProc(false))
+            EnableExtensionSupport(viewerExt);
+    };
+
     #define LOAD_GLEXT(NAME) \
         LoadExtension("GL_" + std::string(#NAME), Load_GL_##NAME, GLExt::NAME)
 
     #define ENABLE_GLEXT(NAME) \
         EnableExtension("GL_" + std::string(#NAME), GLExt::NAME)
 
+    #define LOAD_GLCORE(MAJOR, MINOR, NAME) \
+        LoadCoreFeature(MAJOR, MINOR, Load_GL_##NAME, GLExt::NAME)
+
     /* Load hardware buffer extensions */
     LOAD_GLEXT( ARB_vertex_buffer_object         );
+    LOAD_GLEXT( ARB_map_buffer_range             );
+    LOAD_GLEXT( ARB_buffer_storage               );
     LOAD_GLEXT( ARB_vertex_array_object          );
+    LOAD_GLEXT( ARB_vertex_attrib_binding        );
     LOAD_GLEXT( ARB_framebuffer_object           );
     LOAD_GLEXT( ARB_uniform_buffer_object        );
     LOAD_GLEXT( ARB_shader_storage_buffer_object );
@@ -678,6 +804,9 @@ void LoadAllExtensions(GLExtensionList& extensions)
     LOAD_GLEXT( ARB_draw_instanced               );
     LOAD_GLEXT( ARB_base_instance                );
     LOAD_GLEXT( ARB_draw_elements_base_vertex    );
+    LOAD_GLEXT( EXT_multi_draw_arrays            );
+    LOAD_GLEXT( ARB_draw_indirect                );
+    LOAD_GLEXT( ARB_multi_draw_indirect          );
 
     /* Load shader extensions */
     LOAD_GLEXT( ARB_shader_objects               );
@@ -694,6 +823,8 @@ void LoadAllExtensions(GLExtensionList& extensions)
     LOAD_GLEXT( ARB_clear_texture                );
     LOAD_GLEXT( ARB_texture_compression          );
     LOAD_GLEXT( ARB_texture_multisample          );
+    LOAD_GLEXT( ARB_texture_storage              );
+    LOAD_GLEXT( ARB_texture_storage_multisample  );
     LOAD_GLEXT( ARB_sampler_objects              );
 
     /* Load blending extensions */
@@ -708,6 +839,10 @@ void LoadAllExtensions(GLExtensionList& extensions)
     LOAD_GLEXT( ARB_occlusion_query              );
     LOAD_GLEXT( NV_conditional_render            );
     LOAD_GLEXT( ARB_timer_query                  );
+    LOAD_GLEXT( ARB_sync                         );
+    LOAD_GLEXT( ARB_copy_buffer                  );
+    LOAD_GLEXT( ARB_copy_image                   );
+    LOAD_GLEXT( ARB_shader_image_load_store      );
     LOAD_GLEXT( ARB_multi_bind                   );
     LOAD_GLEXT( EXT_stencil_two_side             );
     LOAD_GLEXT( KHR_debug                        );
@@ -723,9 +858,14 @@ void LoadAllExtensions(GLExtensionList& extensions)
     ENABLE_GLEXT( ARB_geometry_shader4             );
     ENABLE_GLEXT( NV_conservative_raster           );
     ENABLE_GLEXT( INTEL_conservative_rasterization );
+    ENABLE_GLEXT( EXT_texture_compression_s3tc     );
+
+    /* Load core features (the list of reported extensions remains unchanged) */
+    LOAD_GLCORE( 1, 4, EXT_multi_draw_arrays        );
 
     #undef LOAD_GLEXT
     #undef ENABLE_GLEXT
+    #undef LOAD_GLCORE
     
     #endif
     
@@ -102,6 +102,17 @@ PFNGLTEXIMAGE3DMULTISAMPLEPROC                          glTexImage3DMultisample
 PFNGLGETMULTISAMPLEFVPROC                               glGetMultisamplefv                              = nullptr;
 PFNGLSAMPLEMASKIPROC                                    glSampleMaski                                   = nullptr;
 
+/* GL_ARB_texture_storage */
+
+PFNGLTEXSTORAGE1DPROC                                   glTexStorage1D                                  = nullptr;
+PFNGLTEXSTORAGE2DPROC                                   glTexStorage2D                                  = nullptr;
+PFNGLTEXSTORAGE3DPROC                                   glTexStorage3D                                  = nullptr;
+
+/* GL_ARB_texture_storage_multisample */
+
+PFNGLTEXSTORAGE2DMULTISAMPLEPROC                        glTexStorage2DMultisample                       = nullptr;
+PFNGLTEXSTORAGE3DMULTISAMPLEPROC                        glTexStorage3DMultisample                       = nullptr;
+
 /* GL_ARB_sampler_objects */
 
 PFNGLGENSAMPLERSPROC                                    glGenSamplers                                   = nullptr;
@@ -130,6 +141,16 @@ PFNGLBUFFERDATAPROC                                     glBufferData
 PFNGLBUFFERSUBDATAPROC                                  glBufferSubData                                 = nullptr;
 PFNGLMAPBUFFERPROC                                      glMapBuffer                                     = nullptr;
 PFNGLUNMAPBUFFERPROC                                    glUnmapBuffer                                   = nullptr;
+PFNGLGETBUFFERSUBDATAPROC                               glGetBufferSubData                              = nullptr;
+
+/* GL_ARB_map_buffer_range */
+
+PFNGLMAPBUFFERRANGEPROC                                 glMapBufferRange                                = nullptr;
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC                         glFlushMappedBufferRange                        = nullptr;
+
+/* GL_ARB_buffer_storage */
+
+PFNGLBUFFERSTORAGEPROC                                  glBufferStorage                                 = nullptr;
 
 /* GL_ARB_vertex_buffer_object ??? */
 
@@ -158,6 +179,15 @@ PFNGLGENVERTEXARRAYSPROC                                glGenVertexArrays
 PFNGLDELETEVERTEXARRAYSPROC                             glDeleteVertexArrays                            = nullptr;
 PFNGLBINDVERTEXARRAYPROC                                glBindVertexArray                               = nullptr;
 
+/* GL_ARB_vertex_attrib_binding */
+
+PFNGLBINDVERTEXBUFFERPROC                               glBindVertexBuffer                              = nullptr;
+PFNGLVERTEXATTRIBFORMATPROC                             glVertexAttribFormat                            = nullptr;
+PFNGLVERTEXATTRIBIFORMATPROC                            glVertexAttribIFormat                           = nullptr;
+PFNGLVERTEXATTRIBLFORMATPROC                            glVertexAttribLFormat                           = nullptr;
+PFNGLVERTEXATTRIBBINDINGPROC                            glVertexAttribBinding                           = nullptr;
+PFNGLVERTEXBINDINGDIVISORPROC                           glVertexBindingDivisor                          = nullptr;
+
 /* GL_ARB_framebuffer_object */
 
 PFNGLGENRENDERBUFFERSPROC                               glGenRenderbuffers                              = nullptr;
@@ -188,6 +218,11 @@ PFNGLDRAWELEMENTSINSTANCEDPROC                          glDrawElementsInstanced
 
 PFNGLDRAWELEMENTSBASEVERTEXPROC                         glDrawElementsBaseVertex                        = nullptr;
 PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC                glDrawElementsInstancedBaseVertex               = nullptr;
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC                    glMultiDrawElementsBaseVertex                   = nullptr;
+
+/* GL_EXT_multi_draw_arrays */
+
+PFNGLMULTIDRAWARRAYSPROC                                glMultiDrawArrays                               = nullptr;
 
 /* GL_ARB_base_instance */
 
@@ -195,6 +230,16 @@ PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC                glDrawArraysInstancedBas
 PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC              glDrawElementsInstancedBaseInstance             = nullptr;
 PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC    glDrawElementsInstancedBaseVertexBaseInstance   = nullptr;
 
+/* GL_ARB_draw_indirect */
+
+PFNGLDRAWARRAYSINDIRECTPROC                             glDrawArraysIndirect                            = nullptr;
+PFNGLDRAWELEMENTSINDIRECTPROC                           glDrawElementsIndirect                          = nullptr;
+
+/* GL_ARB_multi_draw_indirect */
+
+PFNGLMULTIDRAWARRAYSINDIRECTPROC                        glMultiDrawArraysIndirect                       = nullptr;
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC                      glMultiDrawElementsIndirect                     = nullptr;
+
 /* GL_ARB_shader_objects */
 
 PFNGLCREATESHADERPROC                                   glCreateShader                                  = nullptr;
@@ -286,6 +331,28 @@ PFNGLQUERYCOUNTERPROC                                   glQueryCounter
 PFNGLGETQUERYOBJECTI64VPROC                             glGetQueryObjecti64v                            = nullptr;
 PFNGLGETQUERYOBJECTUI64VPROC                            glGetQueryObjectui64v                           = nullptr;
 
+/* GL_ARB_sync */
+
+PFNGLFENCESYNCPROC                                      glFenceSync                                     = nullptr;
+PFNGLISSYNCPROC                                         glIsSync                                        = nullptr;
+PFNGLDELETESYNCPROC                                     glDeleteSync                                    = nullptr;
+PFNGLCLIENTWAITSYNCPROC                                 glClientWaitSync                                = nullptr;
+PFNGLWAITSYNCPROC                                       glWaitSync                                      = nullptr;
+PFNGLGETSYNCIVPROC                                      glGetSynciv                                     = nullptr;
+
+/* GL_ARB_copy_buffer */
+
+PFNGLCOPYBUFFERSUBDATAPROC                              glCopyBufferSubData                             = nullptr;
+
+/* GL_ARB_copy_image */
+
+PFNGLCOPYIMAGESUBDATAPROC                               glCopyImageSubData                              = nullptr;
+
+/* GL_ARB_shader_image_load_store */
+
+PFNGLBINDIMAGETEXTUREPROC                               glBindImageTexture                              = nullptr;
+PFNGLMEMORYBARRIERPROC                                  glMemoryBarrier                                 = nullptr;
+
 /* GL_ARB_viewport_array */
 
 PFNGLVIEWPORTARRAYVPROC                                 glViewportArrayv                                = nullptr;
@@ -108,6 +108,17 @@ extern PFNGLTEXIMAGE3DMULTISAMPLEPROC                       glTexImage3DMultisam
 extern PFNGLGETMULTISAMPLEFVPROC                            glGetMultisamplefv;
 extern PFNGLSAMPLEMASKIPROC                                 glSampleMaski;
 
+/* GL_ARB_texture_storage */
+
+extern PFNGLTEXSTORAGE1DPROC                                glTexStorage1D;
+extern PFNGLTEXSTORAGE2DPROC                                glTexStorage2D;
+extern PFNGLTEXSTORAGE3DPROC                                glTexStorage3D;
+
+/* GL_ARB_texture_storage_multisample */
+
+extern PFNGLTEXSTORAGE2DMULTISAMPLEPROC                     glTexStorage2DMultisample;
+extern PFNGLTEXSTORAGE3DMULTISAMPLEPROC                     glTexStorage3DMultisample;
+
 /* GL_ARB_sampler_objects */
 
 extern PFNGLGENSAMPLERSPROC                                 glGenSamplers;
@@ -136,6 +147,16 @@ extern PFNGLBUFFERDATAPROC                                  glBufferData;
 extern PFNGLBUFFERSUBDATAPROC                               glBufferSubData;
 extern PFNGLMAPBUFFERPROC                                   glMapBuffer;
 extern PFNGLUNMAPBUFFERPROC                                 glUnmapBuffer;
+extern PFNGLGETBUFFERSUBDATAPROC                            glGetBufferSubData;
+
+/* GL_ARB_map_buffer_range */
+
+extern PFNGLMAPBUFFERRANGEPROC                             glMapBufferRange;
+extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC                     glFlushMappedBufferRange;
+
+/* GL_ARB_buffer_storage */
+
+extern PFNGLBUFFERSTORAGEPROC                              glBufferStorage;
 
 /* GL_ARB_vertex_buffer_object ??? */
 
@@ -164,6 +185,15 @@ extern PFNGLGENVERTEXARRAYSPROC                             glGenVertexArrays;
 extern PFNGLDELETEVERTEXARRAYSPROC                          glDeleteVertexArrays;
 extern PFNGLBINDVERTEXARRAYPROC                             glBindVertexArray;
 
+/* GL_ARB_vertex_attrib_binding */
+
+extern PFNGLBINDVERTEXBUFFERPROC                           glBindVertexBuffer;
+extern PFNGLVERTEXATTRIBFORMATPROC                         glVertexAttribFormat;
+extern PFNGLVERTEXATTRIBIFORMATPROC                        glVertexAttribIFormat;
+extern PFNGLVERTEXATTRIBLFORMATPROC                        glVertexAttribLFormat;
+extern PFNGLVERTEXATTRIBBINDINGPROC                        glVertexAttribBinding;
+extern PFNGLVERTEXBINDINGDIVISORPROC                       glVertexBindingDivisor;
+
 /* GL_ARB_framebuffer_object */
 
 extern PFNGLGENRENDERBUFFERSPROC                            glGenRenderbuffers;
@@ -194,6 +224,11 @@ extern PFNGLDRAWELEMENTSINSTANCEDPROC                       glDrawElementsInstan
 
 extern PFNGLDRAWELEMENTSBASEVERTEXPROC                      glDrawElementsBaseVertex;
 extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC             glDrawElementsInstancedBaseVertex;
+extern PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC                 glMultiDrawElementsBaseVertex;
+
+/* GL_EXT_multi_draw_arrays */
+
+extern PFNGLMULTIDRAWARRAYSPROC                             glMultiDrawArrays;
 
 /* GL_ARB_base_instance */
 
@@ -201,6 +236,16 @@ extern PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC             glDrawArraysInstance
 extern PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC           glDrawElementsInstancedBaseInstance;
 extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glDrawElementsInstancedBaseVertexBaseInstance;
 
+/* GL_ARB_draw_indirect */
+
+extern PFNGLDRAWARRAYSINDIRECTPROC                          glDrawArraysIndirect;
+extern PFNGLDRAWELEMENTSINDIRECTPROC                        glDrawElementsIndirect;
+
+/* GL_ARB_multi_draw_indirect */
+
+extern PFNGLMULTIDRAWARRAYSINDIRECTPROC                     glMultiDrawArraysIndirect;
+extern PFNGLMULTIDRAWELEMENTSINDIRECTPROC                   glMultiDrawElementsIndirect;
+
 /* GL_ARB_shader_objects */
 
 extern PFNGLCREATESHADERPROC                                glCreateShader;
@@ -292,6 +337,28 @@ extern PFNGLQUERYCOUNTERPROC                                glQueryCounter;
 extern PFNGLGETQUERYOBJECTI64VPROC                          glGetQueryObjecti64v;
 extern PFNGLGETQUERYOBJECTUI64VPROC                         glGetQueryObjectui64v;
 
+/* GL_ARB_sync */
+
+extern PFNGLFENCESYNCPROC                                   glFenceSync;
+extern PFNGLISSYNCPROC                                      glIsSync;
+extern PFNGLDELETESYNCPROC                                  glDeleteSync;
+extern PFNGLCLIENTWAITSYNCPROC                              glClientWaitSync;
+extern PFNGLWAITSYNCPROC                                    glWaitSync;
+extern PFNGLGETSYNCIVPROC                                   glGetSynciv;
+
+/* GL_ARB_copy_buffer */
+
+extern PFNGLCOPYBUFFERSUBDATAPROC                           glCopyBufferSubData;
+
+/* GL_ARB_copy_image */
+
+extern PFNGLCOPYIMAGESUBDATAPROC                            glCopyImageSubData;
+
+/* GL_ARB_shader_image_load_store */
+
+extern PFNGLBINDIMAGETEXTUREPROC                            glBindImageTexture;
+extern PFNGLMEMORYBARRIERPROC                               glMemoryBarrier;
+
 /* GL_ARB_viewport_array */
 
 extern PFNGLVIEWPORTARRAYVPROC                              glViewportArrayv;
@@ -27,16 +27,24 @@ enum class GLExt
     ARB_clear_texture,
     ARB_texture_compression,
     ARB_texture_multisample,
+    ARB_texture_storage,
+    ARB_texture_storage_multisample,
     ARB_sampler_objects,
     ARB_multi_bind,
     ARB_vertex_buffer_object,
+    ARB_map_buffer_range,
+    ARB_buffer_storage,
     ARB_instanced_arrays,
     ARB_draw_buffers,
     ARB_vertex_array_object,
+    ARB_vertex_attrib_binding,
     ARB_framebuffer_object,
     ARB_draw_instanced,
     ARB_draw_elements_base_vertex,
+    EXT_multi_draw_arrays,
     ARB_base_instance,
+    ARB_draw_indirect,
+    ARB_multi_draw_indirect,
     ARB_shader_objects,
     ARB_tessellation_shader,
     ARB_compute_shader,
@@ -47,6 +55,10 @@ enum class GLExt
     ARB_occlusion_query,
     NV_conditional_render,
     ARB_timer_query,
+    ARB_sync,
+    ARB_copy_buffer,
+    ARB_copy_image,
+    ARB_shader_image_load_store,
     ARB_viewport_array,
     EXT_stencil_two_side,//ATI_separate_stencil,
     KHR_debug,
@@ -62,6 +74,7 @@ enum class GLExt
     ARB_geometry_shader4,
     NV_conservative_raster,
     INTEL_conservative_rasterization,
+    EXT_texture_compression_s3tc,
 
     /* Enumeration entry counter */
     Count,
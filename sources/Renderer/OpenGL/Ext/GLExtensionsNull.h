@@ -135,6 +135,17 @@ DECL_GLPROC(void, glTexImage3DMultisample, (GLenum, GLsizei, GLenum, GLsizei, GL
 DECL_GLPROC(void, glGetMultisamplefv, (GLenum, GLuint, GLfloat*));
 DECL_GLPROC(void, glSampleMaski, (GLuint, GLbitfield));
 
+/* GL_ARB_texture_storage */
+
+DECL_GLPROC(void, glTexStorage1D, (GLenum, GLsizei, GLenum, GLsizei));
+DECL_GLPROC(void, glTexStorage2D, (GLenum, GLsizei, GLenum, GLsizei, GLsizei));
+DECL_GLPROC(void, glTexStorage3D, (GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei));
+
+/* GL_ARB_texture_storage_multisample */
+
+DECL_GLPROC(void, glTexStorage2DMultisample, (GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLboolean));
+DECL_GLPROC(void, glTexStorage3DMultisample, (GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei, GLboolean));
+
 /* GL_ARB_sampler_objects */
 
 DECL_GLPROC(void, glGenSamplers, (GLsizei, GLuint*));
@@ -163,6 +174,16 @@ DECL_GLPROC(void, glBufferData, (GLenum, GLsizeiptr, const void*, GLenum));
 DECL_GLPROC(void, glBufferSubData, (GLenum, GLintptr, GLsizeiptr, const void*));
 DECL_GLPROC(void*, glMapBuffer, (GLenum, GLenum));
 DECL_GLPROC(GLboolean, glUnmapBuffer, (GLenum));
+DECL_GLPROC(void, glGetBufferSubData, (GLenum, GLintptr, GLsizeiptr, void*));
+
+/* GL_ARB_map_buffer_range */
+
+DECL_GLPROC(void*, glMapBufferRange, (GLenum, GLintptr, GLsizeiptr, GLbitfield));
+DECL_GLPROC(void, glFlushMappedBufferRange, (GLenum, GLintptr, GLsizeiptr));
+
+/* GL_ARB_buffer_storage */
+
+DECL_GLPROC(void, glBufferStorage, (GLenum, GLsizeiptr, const void*, GLbitfield));
 
 /* GL_ARB_vertex_buffer_object ??? */
 
@@ -191,6 +212,15 @@ DECL_GLPROC(void, glGenVertexArrays, (GLsizei, GLuint*));
 DECL_GLPROC(void, glDeleteVertexArrays, (GLsizei, const GLuint*));
 DECL_GLPROC(void, glBindVertexArray, (GLuint));
 
+/* GL_ARB_vertex_attrib_binding */
+
+DECL_GLPROC(void, glBindVertexBuffer, (GLuint, GLuint, GLintptr, GLsizei));
+DECL_GLPROC(void, glVertexAttribFormat, (GLuint, GLint, GLenum, GLboolean, GLuint));
+DECL_GLPROC(void, glVertexAttribIFormat, (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(void, glVertexAttribLFormat, (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(void, glVertexAttribBinding, (GLuint, GLuint));
+DECL_GLPROC(void, glVertexBindingDivisor, (GLuint, GLuint));
+
 /* GL_ARB_framebuffer_object */
 
 DECL_GLPROC(void, glGenRenderbuffers, (GLsizei n, GLuint *));
@@ -221,6 +251,11 @@ DECL_GLPROC(void, glDrawElementsInstanced, (GLenum, GLsizei, GLenum, const void*
 
 DECL_GLPROC(void, glDrawElementsBaseVertex, (GLenum, GLsizei, GLenum, const void*, GLint));
 DECL_GLPROC(void, glDrawElementsInstancedBaseVertex, (GLenum, GLsizei, GLenum, const void*, GLsizei, GLint));
+DECL_GLPROC(void, glMultiDrawElementsBaseVertex, (GLenum, const GLsizei*, GLenum, const void* const*, GLsizei, const GLint*));
+
+/* GL_EXT_multi_draw_arrays */
+
+DECL_GLPROC(void, glMultiDrawArrays, (GLenum, const GLint*, const GLsizei*, GLsizei));
 
 /* GL_ARB_base_instance */
 
@@ -228,6 +263,16 @@ DECL_GLPROC(void, glDrawArraysInstancedBaseInstance, (GLenum, GLint, GLsizei, GL
 DECL_GLPROC(void, glDrawElementsInstancedBaseInstance, (GLenum, GLsizei, GLenum, const void*, GLsizei, GLuint));
 DECL_GLPROC(void, glDrawElementsInstancedBaseVertexBaseInstance, (GLenum, GLsizei, GLenum, const void*, GLsizei, GLint, GLuint));
 
+/* GL_ARB_draw_indirect */
+
+DECL_GLPROC(void, glDrawArraysIndirect, (GLenum, const void*));
+DECL_GLPROC(void, glDrawElementsIndirect, (GLenum, GLenum, const void*));
+
+/* GL_ARB_multi_draw_indirect */
+
+DECL_GLPROC(void, glMultiDrawArraysIndirect, (GLenum, const void*, GLsizei, GLsizei));
+DECL_GLPROC(void, glMultiDrawElementsIndirect, (GLenum, GLenum, const void*, GLsizei, GLsizei));
+
 /* GL_ARB_shader_objects */
 
 DECL_GLPROC(GLuint, glCreateShader, (GLenum));
@@ -319,6 +364,28 @@ DECL_GLPROC(void, glQueryCounter, (GLuint, GLenum));
 DECL_GLPROC(void, glGetQueryObjecti64v, (GLuint, GLenum, GLint64*));
 DECL_GLPROC(void, glGetQueryObjectui64v, (GLuint, GLenum, GLuint64*));
 
+/* GL_ARB_sync */
+
+DECL_GLPROC(GLsync, glFenceSync, (GLenum, GLbitfield));
+DECL_GLPROC(GLboolean, glIsSync, (GLsync));
+DECL_GLPROC(void, glDeleteSync, (GLsync));
+DECL_GLPROC(GLenum, glClientWaitSync, (GLsync, GLbitfield, GLuint64));
+DECL_GLPROC(void, glWaitSync, (GLsync, GLbitfield, GLuint64));
+DECL_GLPROC(void, glGetSynciv, (GLsync, GLenum, GLsizei, GLsizei*, GLint*));
+
+/* GL_ARB_copy_buffer */
+
+DECL_GLPROC(void, glCopyBufferSubData, (GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr));
+
+/* GL_ARB_copy_image */
+
+DECL_GLPROC(void, glCopyImageSubData, (GLuint, GLenum, GLint, GLint, GLint, GLint, GLuint, GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei));
+
+/* GL_ARB_shader_image_load_store */
+
+DECL_GLPROC(void, glBindImageTexture, (GLuint, GLuint, GLint, GLboolean, GLint, GLenum, GLenum));
+DECL_GLPROC(void, glMemoryBarrier, (GLbitfield));
+
 /* GL_ARB_viewport_array */
 
 DECL_GLPROC(void, glViewportArrayv, (GLuint, GLsizei, const GLfloat*));
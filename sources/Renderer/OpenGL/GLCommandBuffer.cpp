@@ -13,6 +13,7 @@
 #include "../Assertion.h"
 #include "../CheckedCast.h"
 #include "../../Core/Exception.h"
+#include "../../Core/Helper.h"
 
 #include "Shader/GLShaderProgram.h"
 
@@ -150,6 +151,14 @@ void GLCommandBuffer::SetVertexBuffer(Buffer& buffer)
     /* Bind vertex buffer */
     auto& vertexBufferGL = LLGL_CAST(GLVertexBuffer&, buffer);
     stateMngr_->BindVertexArray(vertexBufferGL.GetVaoID());
+
+    /* Bind buffer to the binding point of the shared VAO */
+    if (vertexBufferGL.HasSharedVertexArray())
+    {
+        stateMngr_->BindVertexBuffer(
+            0, vertexBufferGL.GetID(), 0, static_cast<GLsizei>(vertexBufferGL.GetVertexFormat().stride)
+        );
+    }
 }
 
 void GLCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
@@ -157,6 +166,19 @@ void GLCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
     /* Bind vertex buffer */
     auto& vertexBufferArrayGL = LLGL_CAST(GLVertexBufferArray&, bufferArray);
     stateMngr_->BindVertexArray(vertexBufferArrayGL.GetVaoID());
+
+    /* Bind buffers to the binding points of the shared VAO */
+    if (vertexBufferArrayGL.HasSharedVertexArray())
+    {
+        const auto& idArray = vertexBufferArrayGL.GetIDArray();
+        stateMngr_->BindVertexBuffers(
+            0,
+            static_cast<GLsizei>(idArray.size()),
+            idArray.data(),
+            vertexBufferArrayGL.GetOffsetArray().data(),
+            vertexBufferArrayGL.GetStrideArray().data()
+        );
+    }
 }
 
 void GLCommandBuffer::SetIndexBuffer(Buffer& buffer)
@@ -181,6 +203,15 @@ void GLCommandBuffer::SetConstantBufferArray(BufferArray& bufferArray, unsigned
     SetGenericBufferArray(GLBufferTarget::UNIFORM_BUFFER, bufferArray, startSlot);
 }
 
+void GLCommandBuffer::SetConstantBufferRange(Buffer& buffer, unsigned int slot, std::size_t offset, std::size_t size, long /*shaderStageFlags*/)
+{
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    stateMngr_->BindBufferRange(
+        GLBufferTarget::UNIFORM_BUFFER, slot, bufferGL.GetID(),
+        static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size)
+    );
+}
+
 void GLCommandBuffer::SetStorageBuffer(Buffer& buffer, unsigned int slot, long /*shaderStageFlags*/)
 {
     SetGenericBuffer(GLBufferTarget::SHADER_STORAGE_BUFFER, buffer, slot);
@@ -229,6 +260,27 @@ void GLCommandBuffer::EndStreamOutput()
     #endif
 }
 
+void GLCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::size_t dstOffset, Buffer& srcBuffer, std::size_t srcOffset, std::size_t size)
+{
+    if (!HasExtension(GLExt::ARB_copy_buffer))
+        ThrowNotSupported("buffer copies");
+
+    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+    auto& srcBufferGL = LLGL_CAST(GLBuffer&, srcBuffer);
+
+    /* Copy buffer range with the dedicated copy targets (to not disturb other buffer bindings) */
+    stateMngr_->BindBuffer(GLBufferTarget::COPY_READ_BUFFER, srcBufferGL.GetID());
+    stateMngr_->BindBuffer(GLBufferTarget::COPY_WRITE_BUFFER, dstBufferGL.GetID());
+
+    glCopyBufferSubData(
+        GL_COPY_READ_BUFFER,
+        GL_COPY_WRITE_BUFFER,
+        static_cast<GLintptr>(srcOffset),
+        static_cast<GLintptr>(dstOffset),
+        static_cast<GLsizeiptr>(size)
+    );
+}
+
 /* ----- Textures ----- */
 
 void GLCommandBuffer::SetTexture(Texture& texture, unsigned int slot, long /*shaderStageFlags*/)
@@ -251,6 +303,123 @@ void GLCommandBuffer::SetTextureArray(TextureArray& textureArray, unsigned int s
     );
 }
 
+// Returns the offset of the specified texture location in the coordinate system of "glCopyImageSubData" (array layers are mapped to Y or Z).
+static Gs::Vector3i MapTextureOffset(const TextureType type, const TextureLocation& location)
+{
+    auto x = static_cast<GLint>(location.offset.x);
+    auto y = static_cast<GLint>(location.offset.y);
+    auto z = static_cast<GLint>(location.offset.z);
+    auto layer = static_cast<GLint>(location.layer);
+
+    switch (type)
+    {
+        case TextureType::Texture1D:        return Gs::Vector3i(x, 0, 0);
+        case TextureType::Texture1DArray:   return Gs::Vector3i(x, layer, 0);
+        case TextureType::Texture2D:        /* pass */
+        case TextureType::Texture2DMS:      return Gs::Vector3i(x, y, 0);
+        case TextureType::Texture3D:        return Gs::Vector3i(x, y, z);
+        default:                            return Gs::Vector3i(x, y, layer);
+    }
+}
+
+// Returns the extent of a texture region in the coordinate system of "glCopyImageSubData" (array layers are mapped to Y or Z).
+static Gs::Vector3i MapTextureExtent(const TextureType type, const Gs::Vector3ui& extent, unsigned int numLayers)
+{
+    auto w = static_cast<GLint>(extent.x);
+    auto h = static_cast<GLint>(extent.y);
+    auto d = static_cast<GLint>(extent.z);
+    auto layers = static_cast<GLint>(numLayers);
+
+    switch (type)
+    {
+        case TextureType::Texture1D:        return Gs::Vector3i(w, 1, 1);
+        case TextureType::Texture1DArray:   return Gs::Vector3i(w, layers, 1);
+        case TextureType::Texture2D:        /* pass */
+        case TextureType::Texture2DMS:      return Gs::Vector3i(w, h, 1);
+        case TextureType::Texture3D:        return Gs::Vector3i(w, h, d);
+        default:                            return Gs::Vector3i(w, h, layers);
+    }
+}
+
+// Attaches the specified layer (or 3D slice) of a texture MIP-map level to the color attachment of the bound draw framebuffer.
+static void AttachTextureLayer(GLTexture& texture, GLint mipLevel, GLint layer)
+{
+    switch (texture.GetType())
+    {
+        case TextureType::Texture1D:
+            GLFrameBuffer::AttachTexture1D(GL_COLOR_ATTACHMENT0, texture, GL_TEXTURE_1D, mipLevel);
+            break;
+        case TextureType::Texture2D:
+            GLFrameBuffer::AttachTexture2D(GL_COLOR_ATTACHMENT0, texture, GL_TEXTURE_2D, mipLevel);
+            break;
+        case TextureType::Texture2DMS:
+            GLFrameBuffer::AttachTexture2D(GL_COLOR_ATTACHMENT0, texture, GL_TEXTURE_2D_MULTISAMPLE, mipLevel);
+            break;
+        case TextureType::Texture3D:
+            GLFrameBuffer::AttachTexture3D(GL_COLOR_ATTACHMENT0, texture, GL_TEXTURE_3D, mipLevel, layer);
+            break;
+        case TextureType::TextureCube:
+            GLFrameBuffer::AttachTexture2D(GL_COLOR_ATTACHMENT0, texture, GL_TEXTURE_CUBE_MAP_POSITIVE_X + layer, mipLevel);
+            break;
+        default:
+            GLFrameBuffer::AttachTextureLayer(GL_COLOR_ATTACHMENT0, texture, mipLevel, layer);
+            break;
+    }
+}
+
+void GLCommandBuffer::CopyTexture(Texture& dstTexture, Texture& srcTexture)
+{
+    auto& srcTextureGL = LLGL_CAST(GLTexture&, srcTexture);
+
+    /* Copy all array layers of each MIP-map level, until the last level has been reached */
+    for (unsigned int mipLevel = 0;; ++mipLevel)
+    {
+        Gs::Vector3ui extent;
+        unsigned int numLayers = 1;
+
+        if (!QueryMipLevelExtent(srcTextureGL, mipLevel, extent, numLayers))
+            break;
+
+        TextureLocation location(mipLevel, 0, Gs::Vector3ui(0, 0, 0));
+        CopyTextureRegion(dstTexture, location, srcTexture, location, extent, numLayers);
+
+        if (IsMultiSampleTexture(srcTexture.GetType()) || (extent.x <= 1 && extent.y <= 1 && extent.z <= 1))
+            break;
+    }
+}
+
+void GLCommandBuffer::CopyTextureRegion(
+    Texture& dstTexture, const TextureLocation& dstLocation,
+    Texture& srcTexture, const TextureLocation& srcLocation,
+    const Gs::Vector3ui& extent, unsigned int numLayers)
+{
+    auto& dstTextureGL = LLGL_CAST(GLTexture&, dstTexture);
+    auto& srcTextureGL = LLGL_CAST(GLTexture&, srcTexture);
+
+    #ifndef __APPLE__
+    if (HasExtension(GLExt::ARB_copy_image))
+    {
+        /* Copy texture region directly (array layers and cube faces are handled as Y or Z coordinates) */
+        auto srcOffset = MapTextureOffset(srcTexture.GetType(), srcLocation);
+        auto dstOffset = MapTextureOffset(dstTexture.GetType(), dstLocation);
+        auto srcExtent = MapTextureExtent(srcTexture.GetType(), extent, numLayers);
+
+        glCopyImageSubData(
+            srcTextureGL.GetID(), GLTypes::Map(srcTexture.GetType()), static_cast<GLint>(srcLocation.mipLevel),
+            srcOffset.x, srcOffset.y, srcOffset.z,
+            dstTextureGL.GetID(), GLTypes::Map(dstTexture.GetType()), static_cast<GLint>(dstLocation.mipLevel),
+            dstOffset.x, dstOffset.y, dstOffset.z,
+            srcExtent.x, srcExtent.y, srcExtent.z
+        );
+
+        return;
+    }
+    #endif
+
+    /* Fallback: blit each layer with a pair of framebuffers */
+    BlitTextureRegion(dstTextureGL, dstLocation, srcTextureGL, srcLocation, extent, numLayers);
+}
+
 /* ----- Sampler States ----- */
 
 void GLCommandBuffer::SetSampler(Sampler& sampler, unsigned int slot, long /*shaderStageFlags*/)
@@ -480,6 +649,133 @@ void GLCommandBuffer::DrawIndexedInstanced(unsigned int numVertices, unsigned in
     #endif
 }
 
+void GLCommandBuffer::MultiDraw(const DrawArguments* argsArray, unsigned int numDraws)
+{
+    if (HasExtension(GLExt::EXT_multi_draw_arrays))
+    {
+        /* Convert arguments into the separate arrays for "glMultiDrawArrays" */
+        multiDrawFirsts_.resize(numDraws);
+        multiDrawCounts_.resize(numDraws);
+
+        for (unsigned int i = 0; i < numDraws; ++i)
+        {
+            multiDrawFirsts_[i] = static_cast<GLint>(argsArray[i].firstVertex);
+            multiDrawCounts_[i] = static_cast<GLsizei>(argsArray[i].numVertices);
+        }
+
+        glMultiDrawArrays(
+            renderState_.drawMode,
+            multiDrawFirsts_.data(),
+            multiDrawCounts_.data(),
+            static_cast<GLsizei>(numDraws)
+        );
+    }
+    else
+    {
+        /* Submit each draw command separately (fallback if "glMultiDrawArrays" is not available) */
+        for (unsigned int i = 0; i < numDraws; ++i)
+            Draw(argsArray[i].numVertices, argsArray[i].firstVertex);
+    }
+}
+
+void GLCommandBuffer::MultiDrawIndexed(const DrawIndexedArguments* argsArray, unsigned int numDraws)
+{
+    /* Convert arguments into the separate arrays for "glMultiDrawElementsBaseVertex" */
+    multiDrawCounts_.resize(numDraws);
+    multiDrawIndices_.resize(numDraws);
+    multiDrawFirsts_.resize(numDraws);
+
+    for (unsigned int i = 0; i < numDraws; ++i)
+    {
+        multiDrawCounts_[i]     = static_cast<GLsizei>(argsArray[i].numIndices);
+        multiDrawIndices_[i]    = reinterpret_cast<const GLvoid*>(argsArray[i].firstIndex * renderState_.indexBufferStride);
+        multiDrawFirsts_[i]     = static_cast<GLint>(argsArray[i].vertexOffset);
+    }
+
+    glMultiDrawElementsBaseVertex(
+        renderState_.drawMode,
+        multiDrawCounts_.data(),
+        renderState_.indexBufferDataType,
+        multiDrawIndices_.data(),
+        static_cast<GLsizei>(numDraws),
+        multiDrawFirsts_.data()
+    );
+}
+
+void GLCommandBuffer::DrawIndirect(Buffer& buffer, std::size_t offset)
+{
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    stateMngr_->BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, bufferGL.GetID());
+    glDrawArraysIndirect(
+        renderState_.drawMode,
+        reinterpret_cast<const GLvoid*>(offset)
+    );
+}
+
+void GLCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::size_t offset)
+{
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    stateMngr_->BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, bufferGL.GetID());
+    glDrawElementsIndirect(
+        renderState_.drawMode,
+        renderState_.indexBufferDataType,
+        reinterpret_cast<const GLvoid*>(offset)
+    );
+}
+
+void GLCommandBuffer::MultiDrawIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride)
+{
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    stateMngr_->BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, bufferGL.GetID());
+
+    if (stride == 0)
+        stride = sizeof(DrawIndirectArguments);
+
+    #ifndef __APPLE__
+    if (HasExtension(GLExt::ARB_multi_draw_indirect))
+    {
+        glMultiDrawArraysIndirect(
+            renderState_.drawMode,
+            reinterpret_cast<const GLvoid*>(offset),
+            static_cast<GLsizei>(numCommands),
+            static_cast<GLsizei>(stride)
+        );
+        return;
+    }
+    #endif
+
+    /* Submit each draw command separately (fallback if "GL_ARB_multi_draw_indirect" is not supported) */
+    for (unsigned int i = 0; i < numCommands; ++i, offset += stride)
+        glDrawArraysIndirect(renderState_.drawMode, reinterpret_cast<const GLvoid*>(offset));
+}
+
+void GLCommandBuffer::MultiDrawIndexedIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride)
+{
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    stateMngr_->BindBuffer(GLBufferTarget::DRAW_INDIRECT_BUFFER, bufferGL.GetID());
+
+    if (stride == 0)
+        stride = sizeof(DrawIndexedIndirectArguments);
+
+    #ifndef __APPLE__
+    if (HasExtension(GLExt::ARB_multi_draw_indirect))
+    {
+        glMultiDrawElementsIndirect(
+            renderState_.drawMode,
+            renderState_.indexBufferDataType,
+            reinterpret_cast<const GLvoid*>(offset),
+            static_cast<GLsizei>(numCommands),
+            static_cast<GLsizei>(stride)
+        );
+        return;
+    }
+    #endif
+
+    /* Submit each draw command separately (fallback if "GL_ARB_multi_draw_indirect" is not supported) */
+    for (unsigned int i = 0; i < numCommands; ++i, offset += stride)
+        glDrawElementsIndirect(renderState_.drawMode, renderState_.indexBufferDataType, reinterpret_cast<const GLvoid*>(offset));
+}
+
 /* ----- Compute ----- */
 
 void GLCommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ)
@@ -489,6 +785,15 @@ void GLCommandBuffer::Dispatch(unsigned int groupSizeX, unsigned int groupSizeY,
     #endif
 }
 
+void GLCommandBuffer::DispatchIndirect(Buffer& buffer, std::size_t offset)
+{
+    #ifndef __APPLE__
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    stateMngr_->BindBuffer(GLBufferTarget::DISPATCH_INDIRECT_BUFFER, bufferGL.GetID());
+    glDispatchComputeIndirect(static_cast<GLintptr>(offset));
+    #endif
+}
+
 /* ----- Misc ----- */
 
 void GLCommandBuffer::SyncGPU()
@@ -520,6 +825,108 @@ void GLCommandBuffer::SetGenericBufferArray(const GLBufferTarget bufferTarget, B
     );
 }
 
+bool GLCommandBuffer::QueryMipLevelExtent(GLTexture& texture, unsigned int mipLevel, Gs::Vector3ui& extent, unsigned int& numLayers)
+{
+    GLint texSize[3] = { 0 };
+
+    stateMngr_->PushBoundTexture(GLStateManager::GetTextureTarget(texture.GetType()));
+    {
+        stateMngr_->BindTexture(texture);
+
+        /* Query size of the first cube face (cube textures can not be queried as a whole) */
+        auto target = GLTypes::Map(texture.GetType());
+        if (texture.GetType() == TextureType::TextureCube)
+            target = GL_TEXTURE_CUBE_MAP_POSITIVE_X;
+
+        glGetTexLevelParameteriv(target, static_cast<GLint>(mipLevel), GL_TEXTURE_WIDTH,  &texSize[0]);
+        glGetTexLevelParameteriv(target, static_cast<GLint>(mipLevel), GL_TEXTURE_HEIGHT, &texSize[1]);
+        glGetTexLevelParameteriv(target, static_cast<GLint>(mipLevel), GL_TEXTURE_DEPTH,  &texSize[2]);
+    }
+    stateMngr_->PopBoundTexture();
+
+    if (texSize[0] <= 0)
+        return false;
+
+    /* Separate array layers from the texture extent */
+    extent = Gs::Vector3ui(
+        static_cast<unsigned int>(texSize[0]),
+        static_cast<unsigned int>(texSize[1]),
+        static_cast<unsigned int>(texSize[2])
+    );
+
+    switch (texture.GetType())
+    {
+        case TextureType::Texture1DArray:
+            numLayers   = extent.y;
+            extent.y    = 1;
+            break;
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCubeArray:
+        case TextureType::Texture2DMSArray:
+            numLayers   = extent.z;
+            extent.z    = 1;
+            break;
+        case TextureType::TextureCube:
+            numLayers   = 6;
+            break;
+        default:
+            numLayers   = 1;
+            break;
+    }
+
+    return true;
+}
+
+void GLCommandBuffer::BlitTextureRegion(
+    GLTexture& dstTexture, const TextureLocation& dstLocation,
+    GLTexture& srcTexture, const TextureLocation& srcLocation,
+    const Gs::Vector3ui& extent, unsigned int numLayers)
+{
+    /* Create framebuffers for the blit operation once */
+    if (!copyFrameBuffers_[0])
+    {
+        copyFrameBuffers_[0] = MakeUnique<GLFrameBuffer>();
+        copyFrameBuffers_[1] = MakeUnique<GLFrameBuffer>();
+    }
+
+    /* 3D textures are blitted slice by slice */
+    auto srcIs3D    = (srcTexture.GetType() == TextureType::Texture3D);
+    auto dstIs3D    = (dstTexture.GetType() == TextureType::Texture3D);
+    auto numSlices  = (srcIs3D ? extent.z : numLayers);
+
+    auto srcFirst   = static_cast<GLint>(srcIs3D ? srcLocation.offset.z : srcLocation.layer);
+    auto dstFirst   = static_cast<GLint>(dstIs3D ? dstLocation.offset.z : dstLocation.layer);
+
+    Gs::Vector2i srcPos0(static_cast<int>(srcLocation.offset.x), static_cast<int>(srcLocation.offset.y));
+    Gs::Vector2i dstPos0(static_cast<int>(dstLocation.offset.x), static_cast<int>(dstLocation.offset.y));
+    Gs::Vector2i size(static_cast<int>(extent.x), static_cast<int>(extent.y));
+
+    stateMngr_->PushBoundFrameBuffer(GLFrameBufferTarget::READ_FRAMEBUFFER);
+    stateMngr_->PushBoundFrameBuffer(GLFrameBufferTarget::DRAW_FRAMEBUFFER);
+    {
+        for (unsigned int i = 0; i < numSlices; ++i)
+        {
+            /* Attach source and destination layer (attachments always refer to the draw framebuffer) */
+            copyFrameBuffers_[0]->Bind(GLFrameBufferTarget::DRAW_FRAMEBUFFER);
+            AttachTextureLayer(srcTexture, static_cast<GLint>(srcLocation.mipLevel), srcFirst + static_cast<GLint>(i));
+
+            copyFrameBuffers_[1]->Bind(GLFrameBufferTarget::DRAW_FRAMEBUFFER);
+            AttachTextureLayer(dstTexture, static_cast<GLint>(dstLocation.mipLevel), dstFirst + static_cast<GLint>(i));
+
+            /* Blit color buffer from source into destination */
+            copyFrameBuffers_[0]->Bind(GLFrameBufferTarget::READ_FRAMEBUFFER);
+
+            GLFrameBuffer::Blit(
+                srcPos0, srcPos0 + size,
+                dstPos0, dstPos0 + size,
+                GL_COLOR_BUFFER_BIT, GL_NEAREST
+            );
+        }
+    }
+    stateMngr_->PopBoundFrameBuffer();
+    stateMngr_->PopBoundFrameBuffer();
+}
+
 
 } // /namespace LLGL
 
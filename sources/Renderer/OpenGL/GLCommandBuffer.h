@@ -11,7 +11,10 @@
 
 #include <LLGL/CommandBuffer.h>
 #include "RenderState/GLState.h"
+#include "Texture/GLFrameBuffer.h"
 #include "OpenGL.h"
+#include <memory>
+#include <vector>
 
 
 namespace LLGL
@@ -20,6 +23,7 @@ namespace LLGL
 
 class GLRenderTarget;
 class GLStateManager;
+class GLTexture;
 
 class GLCommandBuffer : public CommandBuffer
 {
@@ -55,6 +59,7 @@ class GLCommandBuffer : public CommandBuffer
         
         void SetConstantBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         void SetConstantBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
+        void SetConstantBufferRange(Buffer& buffer, unsigned int slot, std::size_t offset, std::size_t size, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         
         void SetStorageBuffer(Buffer& buffer, unsigned int slot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         void SetStorageBufferArray(BufferArray& bufferArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
@@ -65,11 +70,21 @@ class GLCommandBuffer : public CommandBuffer
         void BeginStreamOutput(const PrimitiveType primitiveType) override;
         void EndStreamOutput() override;
 
+        void CopyBuffer(Buffer& dstBuffer, std::size_t dstOffset, Buffer& srcBuffer, std::size_t srcOffset, std::size_t size) override;
+
         /* ----- Textures ----- */
 
         void SetTexture(Texture& texture, unsigned int layer, long shaderStageFlags = ShaderStageFlags::AllStages) override;
         void SetTextureArray(TextureArray& textureArray, unsigned int startSlot, long shaderStageFlags = ShaderStageFlags::AllStages) override;
 
+        void CopyTexture(Texture& dstTexture, Texture& srcTexture) override;
+
+        void CopyTextureRegion(
+            Texture& dstTexture, const TextureLocation& dstLocation,
+            Texture& srcTexture, const TextureLocation& srcLocation,
+            const Gs::Vector3ui& extent, unsigned int numLayers = 1
+        ) override;
+
         /* ----- Sampler States ----- */
 
         void SetSampler(Sampler& sampler, unsigned int layer, long shaderStageFlags = ShaderStageFlags::AllStages) override;
@@ -109,9 +124,19 @@ class GLCommandBuffer : public CommandBuffer
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset) override;
         void DrawIndexedInstanced(unsigned int numVertices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int instanceOffset) override;
 
+        void MultiDraw(const DrawArguments* argsArray, unsigned int numDraws) override;
+        void MultiDrawIndexed(const DrawIndexedArguments* argsArray, unsigned int numDraws) override;
+
+        void DrawIndirect(Buffer& buffer, std::size_t offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::size_t offset) override;
+
+        void MultiDrawIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride = 0) override;
+        void MultiDrawIndexedIndirect(Buffer& buffer, std::size_t offset, unsigned int numCommands, unsigned int stride = 0) override;
+
         /* ----- Compute ----- */
 
         void Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ) override;
+        void DispatchIndirect(Buffer& buffer, std::size_t offset) override;
 
         /* ----- Misc ----- */
 
@@ -132,11 +157,28 @@ class GLCommandBuffer : public CommandBuffer
         // Blits the currently bound render target
         void BlitBoundRenderTarget();
 
+        // Queries the extent and number of array layers of the specified MIP-map level. Returns false if the level does not exist.
+        bool QueryMipLevelExtent(GLTexture& texture, unsigned int mipLevel, Gs::Vector3ui& extent, unsigned int& numLayers);
+
+        // Copies a texture region by blitting each layer (fallback if "GL_ARB_copy_image" is not supported).
+        void BlitTextureRegion(
+            GLTexture& dstTexture, const TextureLocation& dstLocation,
+            GLTexture& srcTexture, const TextureLocation& srcLocation,
+            const Gs::Vector3ui& extent, unsigned int numLayers
+        );
+
         std::shared_ptr<GLStateManager> stateMngr_;
         RenderState                     renderState_;
 
         GLRenderTarget*                 boundRenderTarget_  = nullptr;
 
+        std::unique_ptr<GLFrameBuffer>  copyFrameBuffers_[2];   // Read and draw framebuffer for the texture copy fallback
+
+        /* Argument arrays for "glMultiDraw*", which are re-used to avoid memory allocations for each multi-draw call */
+        std::vector<GLint>              multiDrawFirsts_;       // First vertices or base vertices
+        std::vector<GLsizei>            multiDrawCounts_;
+        std::vector<const GLvoid*>      multiDrawIndices_;
+
 };
 
 
@@ -18,6 +18,10 @@
 
 #include "Buffer/GLBuffer.h"
 #include "Buffer/GLBufferArray.h"
+#include "Buffer/GLReadback.h"
+#include "Buffer/GLStreamingBuffer.h"
+#include "Buffer/GLVertexFormatRegistry.h"
+#include "Buffer/GLVertexArrayCache.h"
 
 #include "Shader/GLShader.h"
 #include "Shader/GLShaderProgram.h"
@@ -81,6 +85,21 @@ class GLRenderSystem : public RenderSystem
         void* MapBuffer(Buffer& buffer, const BufferCPUAccess access) override;
         void UnmapBuffer(Buffer& buffer) override;
 
+        void* MapBufferRange(Buffer& buffer, std::size_t offset, std::size_t size, long mapFlags) override;
+        void FlushMappedRange(Buffer& buffer, std::size_t offset, std::size_t size) override;
+
+        Readback* ReadBufferAsync(const Buffer& buffer, std::size_t offset, std::size_t size) override;
+
+        /* ----- Streaming buffers ----- */
+
+        StreamingBuffer* CreateStreamingBuffer(const StreamingBufferDescriptor& desc) override;
+
+        void Release(StreamingBuffer& streamingBuffer) override;
+
+        std::size_t WriteStreamingBuffer(StreamingBuffer& streamingBuffer, const void* data, std::size_t dataSize) override;
+
+        void AdvanceStreamingBuffer(StreamingBuffer& streamingBuffer) override;
+
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const ImageDescriptor* imageDesc = nullptr) override;
@@ -95,6 +114,8 @@ class GLRenderSystem : public RenderSystem
         
         void ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer) override;
 
+        Readback* ReadTextureAsync(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType) override;
+
         void GenerateMips(Texture& texture) override;
 
         /* ----- Sampler States ---- */
@@ -133,6 +154,13 @@ class GLRenderSystem : public RenderSystem
 
         void Release(Query& query) override;
 
+        /* ----- Readbacks ----- */
+
+        const void* MapReadback(Readback& readback) override;
+        void UnmapReadback(Readback& readback) override;
+
+        void Release(Readback& readback) override;
+
     protected:
 
         RenderContext* AddRenderContext(
@@ -160,14 +188,17 @@ class GLRenderSystem : public RenderSystem
         void BuildTextureCubeArray(const TextureDescriptor& desc, const ImageDescriptor* imageDesc);
         void BuildTexture2DMS(const TextureDescriptor& desc);
         void BuildTexture2DMSArray(const TextureDescriptor& desc);
+        void BuildTextureStorage(const TextureDescriptor& desc, const ImageDescriptor* imageDesc);
 
-        void WriteTexture1D(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc);
-        void WriteTexture2D(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc);
-        void WriteTexture3D(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc);
-        void WriteTextureCube(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc);
-        void WriteTexture1DArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc);
-        void WriteTexture2DArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc);
-        void WriteTextureCubeArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc);
+        void WriteTexture1D(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat);
+        void WriteTexture2D(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat);
+        void WriteTexture3D(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat);
+        void WriteTextureCube(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat);
+        void WriteTexture1DArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat);
+        void WriteTexture2DArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat);
+        void WriteTextureCubeArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat);
+
+        void InitTextureWithDefaultColor(const GLTexture& textureGL, const TextureDescriptor& desc);
 
         GLRenderContext* GetSharedRenderContext() const;
 
@@ -187,6 +218,13 @@ class GLRenderSystem : public RenderSystem
         HWObjectContainer<GLGraphicsPipeline>   graphicsPipelines_;
         HWObjectContainer<GLComputePipeline>    computePipelines_;
         HWObjectContainer<GLQuery>              queries_;
+        HWObjectContainer<GLReadback>           readbacks_;
+        HWObjectContainer<GLStreamingBuffer>    streamingBuffers_;
+
+        /* ----- VAO management (declared after the containers, so the VAOs are deleted before the render contexts) ----- */
+
+        GLVertexFormatRegistry                  vertexFormatRegistry_;
+        GLVertexArrayCache                      vertexArrayCache_;
 
 };
 
@@ -9,9 +9,12 @@
 #include "../CheckedCast.h"
 #include "../../Core/Helper.h"
 #include "GLTypes.h"
+#include "Ext/GLExtensions.h"
+#include "Ext/GLExtensionLoader.h"
 #include "Buffer/GLVertexBuffer.h"
 #include "Buffer/GLIndexBuffer.h"
 #include "Buffer/GLVertexBufferArray.h"
+#include <vector>
 
 
 namespace LLGL
@@ -32,12 +35,18 @@ Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
     {
         case BufferType::Vertex:
         {
-            /* Create vertex buffer and build vertex array */
-            auto bufferGL = MakeUnique<GLVertexBuffer>();
+            /* Create vertex buffer and either use the shared VAO of its vertex format or build a separate VAO */
+            auto vertexFormat = vertexFormatRegistry_.InternVertexFormat(desc.vertexBuffer.format);
+
+            auto bufferGL = MakeUnique<GLVertexBuffer>(*vertexFormat);
             {
                 GLStateManager::active->BindBuffer(*bufferGL);
                 bufferGL->BufferData(initialData, desc.size, GetGLBufferUsage(desc.flags));
-                bufferGL->BuildVertexArray(desc.vertexBuffer.format);
+
+                if (auto vaoID = vertexFormatRegistry_.GetVertexArray({ vertexFormat }))
+                    bufferGL->UseSharedVertexArray(vaoID);
+                else
+                    bufferGL->BuildVertexArray();
             }
             return TakeOwnership(buffers_, std::move(bufferGL));
         }
@@ -75,9 +84,35 @@ BufferArray* GLRenderSystem::CreateBufferArray(unsigned int numBuffers, Buffer*
 
     if (type == BufferType::Vertex)
     {
-        /* Create vertex buffer array and build VAO */
+        /* Gather vertex formats of all vertex buffers */
+        std::vector<const VertexFormat*> vertexFormats;
+        vertexFormats.reserve(numBuffers);
+
+        for (unsigned int i = 0; i < numBuffers; ++i)
+        {
+            auto vertexBufferGL = LLGL_CAST(const GLVertexBuffer*, bufferArray[i]);
+            vertexFormats.push_back(&(vertexBufferGL->GetVertexFormat()));
+        }
+
+        /* Create vertex buffer array and either use the shared VAO of its vertex formats or a VAO from the cache */
         auto vertexBufferArray = MakeUnique<GLVertexBufferArray>();
-        vertexBufferArray->BuildVertexArray(numBuffers, bufferArray);
+
+        if (auto vaoID = vertexFormatRegistry_.GetVertexArray(vertexFormats))
+            vertexBufferArray->UseSharedVertexArray(vaoID, numBuffers, bufferArray);
+        else
+        {
+            bool cacheHit = false;
+            vertexBufferArray->UseCachedVertexArray(vertexArrayCache_.Acquire(numBuffers, bufferArray, cacheHit));
+
+            if (auto profiler = GetProfiler())
+            {
+                if (cacheHit)
+                    profiler->vertexArrayCacheHits.Inc();
+                else
+                    profiler->vertexArrayCacheMisses.Inc();
+            }
+        }
+
         return TakeOwnership(bufferArrays_, std::move(vertexBufferArray));
     }
 
@@ -86,11 +121,24 @@ BufferArray* GLRenderSystem::CreateBufferArray(unsigned int numBuffers, Buffer*
 
 void GLRenderSystem::Release(Buffer& buffer)
 {
+    /* Remove all cached VAOs of this vertex buffer, since its ID might be re-used */
+    if (buffer.GetType() == BufferType::Vertex)
+    {
+        auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+        vertexArrayCache_.InvalidateBuffer(bufferGL.GetID());
+    }
     RemoveFromUniqueSet(buffers_, &buffer);
 }
 
 void GLRenderSystem::Release(BufferArray& bufferArray)
 {
+    /* Release reference to the cached VAO */
+    if (bufferArray.GetType() == BufferType::Vertex)
+    {
+        auto& vertexBufferArrayGL = LLGL_CAST(GLVertexBufferArray&, bufferArray);
+        if (!vertexBufferArrayGL.HasSharedVertexArray())
+            vertexArrayCache_.Release(vertexBufferArrayGL.GetVaoID());
+    }
     RemoveFromUniqueSet(bufferArrays_, &bufferArray);
 }
 
@@ -119,6 +167,92 @@ void GLRenderSystem::UnmapBuffer(Buffer& buffer)
     BindAndGetGLBuffer(buffer).UnmapBuffer();
 }
 
+void* GLRenderSystem::MapBufferRange(Buffer& buffer, std::size_t offset, std::size_t size, long mapFlags)
+{
+    /* Bind and map buffer range */
+    return BindAndGetGLBuffer(buffer).MapBufferRange(
+        static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), mapFlags
+    );
+}
+
+void GLRenderSystem::FlushMappedRange(Buffer& buffer, std::size_t offset, std::size_t size)
+{
+    /* Bind buffer and flush mapped range */
+    BindAndGetGLBuffer(buffer).FlushMappedBufferRange(
+        static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size)
+    );
+}
+
+Readback* GLRenderSystem::ReadBufferAsync(const Buffer& buffer, std::size_t offset, std::size_t size)
+{
+    auto& bufferGL = LLGL_CAST(const GLBuffer&, buffer);
+
+    auto readback = MakeUnique<GLReadback>(size);
+
+    #ifndef __APPLE__
+    /* Make shader storage writes (e.g. from compute shaders) visible to the buffer copy */
+    if (buffer.GetType() == BufferType::Storage && HasExtension(GLExt::ARB_shader_image_load_store))
+        glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    #endif
+
+    if (HasExtension(GLExt::ARB_copy_buffer))
+    {
+        /* Copy buffer range into the staging buffer of the readback (executed asynchronously by the GPU) */
+        GLStateManager::active->BindBuffer(GLBufferTarget::COPY_READ_BUFFER, bufferGL.GetID());
+        GLStateManager::active->BindBuffer(GLBufferTarget::COPY_WRITE_BUFFER, readback->GetID());
+
+        glCopyBufferSubData(
+            GL_COPY_READ_BUFFER,
+            GL_COPY_WRITE_BUFFER,
+            static_cast<GLintptr>(offset),
+            0,
+            static_cast<GLsizeiptr>(size)
+        );
+    }
+    else
+    {
+        /* Read buffer range synchronously and upload it into the staging buffer of the readback */
+        std::vector<char> data(size);
+
+        GLStateManager::active->BindBuffer(GLBufferTarget::ARRAY_BUFFER, bufferGL.GetID());
+        glGetBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data.data());
+
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, readback->GetID());
+        glBufferSubData(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(size), data.data());
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+    }
+
+    /* Signal the readback once the GPU has finished the copy */
+    readback->InsertFence();
+
+    return TakeOwnership(readbacks_, std::move(readback));
+}
+
+/* ----- Streaming buffers ----- */
+
+StreamingBuffer* GLRenderSystem::CreateStreamingBuffer(const StreamingBufferDescriptor& desc)
+{
+    AssertCreateStreamingBuffer(desc);
+    return TakeOwnership(streamingBuffers_, MakeUnique<GLStreamingBuffer>(desc));
+}
+
+void GLRenderSystem::Release(StreamingBuffer& streamingBuffer)
+{
+    RemoveFromUniqueSet(streamingBuffers_, &streamingBuffer);
+}
+
+std::size_t GLRenderSystem::WriteStreamingBuffer(StreamingBuffer& streamingBuffer, const void* data, std::size_t dataSize)
+{
+    auto& streamingBufferGL = LLGL_CAST(GLStreamingBuffer&, streamingBuffer);
+    return streamingBufferGL.Write(data, dataSize);
+}
+
+void GLRenderSystem::AdvanceStreamingBuffer(StreamingBuffer& streamingBuffer)
+{
+    auto& streamingBufferGL = LLGL_CAST(GLStreamingBuffer&, streamingBuffer);
+    streamingBufferGL.Advance();
+}
+
 
 } // /namespace LLGL
 
@@ -188,6 +188,25 @@ void GLRenderSystem::Release(Query& query)
     RemoveFromUniqueSet(queries_, &query);
 }
 
+/* ----- Readbacks ----- */
+
+const void* GLRenderSystem::MapReadback(Readback& readback)
+{
+    auto& readbackGL = LLGL_CAST(GLReadback&, readback);
+    return readbackGL.Map();
+}
+
+void GLRenderSystem::UnmapReadback(Readback& readback)
+{
+    auto& readbackGL = LLGL_CAST(GLReadback&, readback);
+    readbackGL.Unmap();
+}
+
+void GLRenderSystem::Release(Readback& readback)
+{
+    RemoveFromUniqueSet(readbacks_, &readback);
+}
+
 
 /*
  * ======= Protected: =======
@@ -353,6 +372,7 @@ void GLRenderSystem::QueryRenderingCaps()
     caps.hasViewportArrays              = HasExtension(GLExt::ARB_viewport_array);
     caps.hasConservativeRasterization   = ( HasExtension(GLExt::NV_conservative_raster) || HasExtension(GLExt::INTEL_conservative_rasterization) );
     caps.hasStreamOutputs               = ( HasExtension(GLExt::EXT_transform_feedback) || HasExtension(GLExt::NV_transform_feedback) );
+    caps.hasIndirectDrawing             = HasExtension(GLExt::ARB_draw_indirect);
 
     /* Query integral attributes */
     auto GetInt = [](GLenum param)
@@ -378,6 +398,7 @@ void GLRenderSystem::QueryRenderingCaps()
     caps.maxNumTextureArrayLayers           = GetUInt(GL_MAX_ARRAY_TEXTURE_LAYERS);
     caps.maxNumRenderTargetAttachments      = GetUInt(GL_MAX_DRAW_BUFFERS);
     caps.maxConstantBufferSize              = GetUInt(GL_MAX_UNIFORM_BLOCK_SIZE);
+    caps.constantBufferOffsetAlignment      = GetUInt(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT);
     caps.maxPatchVertices                   = GetInt(GL_MAX_PATCH_VERTICES);
     caps.maxAnisotropy                      = 16;
     
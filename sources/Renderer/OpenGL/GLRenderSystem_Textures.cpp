@@ -11,12 +11,131 @@
 #include "../CheckedCast.h"
 #include "../../Core/Helper.h"
 #include "../Assertion.h"
+#include <LLGL/ImageCompression.h>
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
+/* ----- Compressed texture emulation ----- */
+
+// Returns true if the driver supports the S3TC (DXT) compressed texture formats.
+static bool HasCompressedTextureSupport()
+{
+    return (HasExtension(GLExt::ARB_texture_compression) && HasExtension(GLExt::EXT_texture_compression_s3tc));
+}
+
+// Returns the extent (width, height, and number of layers or cube faces) of the entire texture image.
+static Gs::Vector3ui GetTextureImageExtent(const TextureDescriptor& desc)
+{
+    switch (desc.type)
+    {
+        case TextureType::Texture1D:        return { desc.texture1D.width, 1u, 1u };
+        case TextureType::Texture2D:        return { desc.texture2D.width, desc.texture2D.height, 1u };
+        case TextureType::Texture3D:        return { desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth };
+        case TextureType::TextureCube:      return { desc.textureCube.width, desc.textureCube.height, 6u };
+        case TextureType::Texture1DArray:   return { desc.texture1D.width, 1u, desc.texture1D.layers };
+        case TextureType::Texture2DArray:   return { desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers };
+        case TextureType::TextureCubeArray: return { desc.textureCube.width, desc.textureCube.height, desc.textureCube.layers * 6 };
+        default:                            return { 0u, 0u, 0u };
+    }
+}
+
+// Returns the extent (width, height, and number of layers or cube faces) of the specified sub-texture image.
+static Gs::Vector3ui GetSubTextureImageExtent(const TextureType type, const SubTextureDescriptor& desc)
+{
+    switch (type)
+    {
+        case TextureType::Texture1D:        return { desc.texture1D.width, 1u, 1u };
+        case TextureType::Texture2D:        return { desc.texture2D.width, desc.texture2D.height, 1u };
+        case TextureType::Texture3D:        return { desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth };
+        case TextureType::TextureCube:      return { desc.textureCube.width, desc.textureCube.height, 1u };
+        case TextureType::Texture1DArray:   return { desc.texture1D.width, 1u, desc.texture1D.layers };
+        case TextureType::Texture2DArray:   return { desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers };
+        case TextureType::TextureCubeArray: return { desc.textureCube.width, desc.textureCube.height, desc.textureCube.cubeFaces };
+        default:                            return { 0u, 0u, 0u };
+    }
+}
+
+// Returns the extent of the specified MIP-map level for the extent of the entire texture image (array layers and cube faces are not reduced).
+static Gs::Vector3ui GetMipLevelImageExtent(const TextureType type, const Gs::Vector3ui& extent, unsigned int mipLevel)
+{
+    return
+    {
+        std::max(1u, extent.x >> mipLevel),
+        std::max(1u, extent.y >> mipLevel),
+        (type == TextureType::Texture3D ? std::max(1u, extent.z >> mipLevel) : extent.z)
+    };
+}
+
+/*
+Decompresses the specified image into RGBA with 8-bit components (the layers or cube faces must be tightly packed).
+The source buffer size is 'imageDesc.compressedSize' multiplied by 'numImages', since compressed cube images specify the size of a single face.
+*/
+static ByteBuffer DecompressTextureImage(
+    const TextureFormat compressedFormat, const ImageDescriptor& imageDesc, const Gs::Vector3ui& extent, unsigned int numImages, std::size_t threadCount)
+{
+    return DecompressImageBuffer(
+        compressedFormat, imageDesc.buffer, static_cast<std::size_t>(imageDesc.compressedSize) * numImages,
+        ImageFormat::RGBA, DataType::UInt8, extent.x, extent.y, extent.z, threadCount
+    );
+}
+
+// Sets the pixel unpack state for the row layout of the specified image (or tightly packed rows if no uncompressed image is specified).
+static void SetupPixelStoreUnpack(const ImageDescriptor* imageDesc)
+{
+    if (imageDesc && !IsCompressedFormat(imageDesc->format))
+    {
+        GLStateManager::active->SetPixelStoreUnpack(
+            static_cast<GLint>(imageDesc->rowLength),
+            static_cast<GLint>(imageDesc->imageHeight),
+            static_cast<GLint>(imageDesc->alignment)
+        );
+    }
+    else
+        GLStateManager::active->SetPixelStoreUnpack(0, 0, 1);
+}
+
+/* ----- Immutable texture storage ----- */
+
+// Returns true if immutable texture storage (i.e. "glTexStorage...") is supported for the specified texture type.
+static bool HasTextureStorageSupport(const TextureType type)
+{
+    if (IsMultiSampleTexture(type))
+        return HasExtension(GLExt::ARB_texture_storage_multisample);
+    else
+        return HasExtension(GLExt::ARB_texture_storage);
+}
+
+// Returns the sized internal format for the specified texture format, since immutable texture storage does not accept base internal formats.
+static GLenum GetSizedInternalFormat(const TextureFormat format)
+{
+    switch (format)
+    {
+        case TextureFormat::DepthComponent: return GL_DEPTH_COMPONENT24;
+        case TextureFormat::DepthStencil:   return GL_DEPTH24_STENCIL8;
+        case TextureFormat::R:              return GL_R8;
+        case TextureFormat::RG:             return GL_RG8;
+        case TextureFormat::RGB:            return GL_RGB8;
+        case TextureFormat::RGBA:           return GL_RGBA8;
+        default:                            return GLTypes::Map(format);
+    }
+}
+
+// Returns the internal format of the first MIP-map level of the texture, which is currently bound to the specified texture type.
+static GLenum GetBoundTextureInternalFormat(const TextureType type)
+{
+    /* Cube textures must be queried by one of their faces */
+    auto target = (type == TextureType::TextureCube ? GL_TEXTURE_CUBE_MAP_POSITIVE_X : GLTypes::Map(type));
+
+    GLint internalFormat = 0;
+    glGetTexLevelParameteriv(target, 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat);
+
+    return static_cast<GLenum>(internalFormat);
+}
+
 /* ----- Textures ----- */
 
 Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageDescriptor* imageDesc)
@@ -31,41 +150,85 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-    /* Build texture storage and upload image dataa */
-    switch (textureDesc.type)
+    /* Emulate compressed format with uncompressed RGBA format if the driver does not support it */
+    TextureDescriptor   emulatedTextureDesc;
+    ImageDescriptor     decompressedImageDesc;
+    ByteBuffer          decompressedImage;
+
+    if (IsCompressedFormat(textureDesc.format) && !HasCompressedTextureSupport())
     {
-        case TextureType::Texture1D:
-            BuildTexture1D(textureDesc, imageDesc);
-            break;
-        case TextureType::Texture2D:
-            BuildTexture2D(textureDesc, imageDesc);
-            break;
-        case TextureType::Texture3D:
-            BuildTexture3D(textureDesc, imageDesc);
-            break;
-        case TextureType::TextureCube:
-            BuildTextureCube(textureDesc, imageDesc);
-            break;
-        case TextureType::Texture1DArray:
-            BuildTexture1DArray(textureDesc, imageDesc);
-            break;
-        case TextureType::Texture2DArray:
-            BuildTexture2DArray(textureDesc, imageDesc);
-            break;
-        case TextureType::TextureCubeArray:
-            BuildTextureCubeArray(textureDesc, imageDesc);
-            break;
-        case TextureType::Texture2DMS:
-            BuildTexture2DMS(textureDesc);
-            break;
-        case TextureType::Texture2DMSArray:
-            BuildTexture2DMSArray(textureDesc);
-            break;
-        default:
-            throw std::invalid_argument("failed to create texture with invalid texture type");
-            break;
+        texture->SetEmulatedCompressedFormat(textureDesc.format);
+
+        emulatedTextureDesc         = textureDesc;
+        emulatedTextureDesc.format  = TextureFormat::RGBA8;
+
+        if (imageDesc && IsCompressedFormat(imageDesc->format))
+        {
+            /* Decompress image data on the CPU */
+            decompressedImage       = DecompressTextureImage(
+                textureDesc.format, *imageDesc, GetTextureImageExtent(textureDesc),
+                (textureDesc.type == TextureType::TextureCube ? 6u : 1u), GetConfiguration().threadCount
+            );
+            decompressedImageDesc   = ImageDescriptor(ImageFormat::RGBA, DataType::UInt8, decompressedImage.get());
+            imageDesc               = &decompressedImageDesc;
+        }
     }
 
+    const auto& desc = (texture->GetEmulatedCompressedFormat() != TextureFormat::Unknown ? emulatedTextureDesc : textureDesc);
+
+    SetupPixelStoreUnpack(imageDesc);
+
+    /* Build texture storage and upload image data */
+    if (HasTextureStorageSupport(desc.type))
+    {
+        /* Allocate immutable storage for the entire MIP-map chain at once */
+        BuildTextureStorage(desc, imageDesc);
+    }
+    else
+    {
+        switch (desc.type)
+        {
+            case TextureType::Texture1D:
+                BuildTexture1D(desc, imageDesc);
+                break;
+            case TextureType::Texture2D:
+                BuildTexture2D(desc, imageDesc);
+                break;
+            case TextureType::Texture3D:
+                BuildTexture3D(desc, imageDesc);
+                break;
+            case TextureType::TextureCube:
+                BuildTextureCube(desc, imageDesc);
+                break;
+            case TextureType::Texture1DArray:
+                BuildTexture1DArray(desc, imageDesc);
+                break;
+            case TextureType::Texture2DArray:
+                BuildTexture2DArray(desc, imageDesc);
+                break;
+            case TextureType::TextureCubeArray:
+                BuildTextureCubeArray(desc, imageDesc);
+                break;
+            case TextureType::Texture2DMS:
+                BuildTexture2DMS(desc);
+                break;
+            case TextureType::Texture2DMSArray:
+                BuildTexture2DMSArray(desc);
+                break;
+            default:
+                throw std::invalid_argument("failed to create texture with invalid texture type");
+                break;
+        }
+
+        /* Limit the MIP-map chain of the mutable texture to the requested number of levels */
+        if (desc.mipLevels > 0 && !IsMultiSampleTexture(desc.type))
+            glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(NumMipLevels(desc) - 1));
+    }
+
+    /* Initialize texture image with default color if no initial image data is specified */
+    if (!imageDesc && !GetConfiguration().leaveTexturesUninitialized)
+        InitTextureWithDefaultColor(*texture, desc);
+
     return TakeOwnership(textures_, std::move(texture));
 }
 
@@ -292,23 +455,13 @@ void GLRenderSystem::BuildTexture1D(const TextureDescriptor& desc, const ImageDe
             GLTypes::Map(imageDesc->format), GLTypes::Map(imageDesc->dataType), imageDesc->buffer, imageDesc->compressedSize
         );
     }
-    else if (IsCompressedFormat(desc.format))
-    {
-        /* Initialize compressed texture image with null pointer */
-        GLTexImage1D(
-            desc.format,
-            desc.texture1D.width,
-            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
-        );
-    }
     else
     {
-        /* Initialize texture image with default color */
-        auto image = GetDefaultTextureImageRGBAub(desc.texture1D.width);
+        /* Allocate texture image without initial data (it is initialized after the texture has been built) */
         GLTexImage1D(
             desc.format,
             desc.texture1D.width,
-            GL_RGBA, GL_UNSIGNED_BYTE, image.data()
+            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
         );
     }
 }
@@ -324,23 +477,13 @@ void GLRenderSystem::BuildTexture2D(const TextureDescriptor& desc, const ImageDe
             GLTypes::Map(imageDesc->format), GLTypes::Map(imageDesc->dataType), imageDesc->buffer, imageDesc->compressedSize
         );
     }
-    else if (IsCompressedFormat(desc.format))
-    {
-        /* Initialize compressed texture image with null pointer */
-        GLTexImage2D(
-            desc.format,
-            desc.texture2D.width, desc.texture2D.height,
-            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
-        );
-    }
     else
     {
-        /* Initialize texture image with default color */
-        auto image = GetDefaultTextureImageRGBAub(desc.texture2D.width * desc.texture2D.height);
+        /* Allocate texture image without initial data (it is initialized after the texture has been built) */
         GLTexImage2D(
             desc.format,
             desc.texture2D.width, desc.texture2D.height,
-            GL_RGBA, GL_UNSIGNED_BYTE, image.data()
+            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
         );
     }
 }
@@ -358,23 +501,13 @@ void GLRenderSystem::BuildTexture3D(const TextureDescriptor& desc, const ImageDe
             GLTypes::Map(imageDesc->format), GLTypes::Map(imageDesc->dataType), imageDesc->buffer, imageDesc->compressedSize
         );
     }
-    else if (IsCompressedFormat(desc.format))
-    {
-        /* Initialize compressed texture image with null pointer */
-        GLTexImage3D(
-            desc.format,
-            desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth,
-            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
-        );
-    }
     else
     {
-        /* Initialize texture image with default color */
-        auto image = GetDefaultTextureImageRGBAub(desc.texture3D.width * desc.texture3D.height * desc.texture3D.depth);
+        /* Allocate texture image without initial data (it is initialized after the texture has been built) */
         GLTexImage3D(
             desc.format,
             desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth,
-            GL_RGBA, GL_UNSIGNED_BYTE, image.data()
+            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
         );
     }
 }
@@ -397,7 +530,7 @@ void GLRenderSystem::BuildTextureCube(const TextureDescriptor& desc, const Image
     {
         /* Setup texture image cube-faces from descriptor */
         auto imageFace          = reinterpret_cast<const char*>(imageDesc->buffer);
-        auto imageFaceStride    = (desc.textureCube.width * desc.textureCube.height * ImageFormatSize(imageDesc->format) * DataTypeSize(imageDesc->dataType));
+        auto imageFaceStride    = imageDesc->GetImageStride(desc.textureCube.width, desc.textureCube.height);
 
         if (IsCompressedFormat(desc.format))
             imageFaceStride = imageDesc->compressedSize;
@@ -415,28 +548,15 @@ void GLRenderSystem::BuildTextureCube(const TextureDescriptor& desc, const Image
             imageFace += imageFaceStride;
         }
     }
-    else if (IsCompressedFormat(desc.format))
-    {
-        /* Initialize compressed texture image with null pointer */
-        for (auto face : cubeFaces)
-        {
-            GLTexImageCube(
-                desc.format,
-                desc.textureCube.width, desc.textureCube.height, face,
-                GL_RGBA, GL_UNSIGNED_BYTE, nullptr
-            );
-        }
-    }
     else
     {
-        /* Initialize texture image cube-faces with default color */
-        auto image = GetDefaultTextureImageRGBAub(desc.textureCube.width * desc.textureCube.height);
+        /* Allocate texture image without initial data (it is initialized after the texture has been built) */
         for (auto face : cubeFaces)
         {
             GLTexImageCube(
                 desc.format,
                 desc.textureCube.width, desc.textureCube.height, face,
-                GL_RGBA, GL_UNSIGNED_BYTE, image.data()
+                GL_RGBA, GL_UNSIGNED_BYTE, nullptr
             );
         }
     }
@@ -455,23 +575,13 @@ void GLRenderSystem::BuildTexture1DArray(const TextureDescriptor& desc, const Im
             GLTypes::Map(imageDesc->format), GLTypes::Map(imageDesc->dataType), imageDesc->buffer, imageDesc->compressedSize
         );
     }
-    else if (IsCompressedFormat(desc.format))
-    {
-        /* Initialize compressed texture image with null pointer */
-        GLTexImage1DArray(
-            desc.format,
-            desc.texture1D.width, desc.texture1D.layers,
-            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
-        );
-    }
     else
     {
-        /* Initialize texture image with default color */
-        auto image = GetDefaultTextureImageRGBAub(desc.texture1D.width * static_cast<int>(desc.texture1D.layers));
+        /* Allocate texture image without initial data (it is initialized after the texture has been built) */
         GLTexImage1DArray(
             desc.format,
             desc.texture1D.width, desc.texture1D.layers,
-            GL_RGBA, GL_UNSIGNED_BYTE, image.data()
+            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
         );
     }
 }
@@ -489,23 +599,13 @@ void GLRenderSystem::BuildTexture2DArray(const TextureDescriptor& desc, const Im
             GLTypes::Map(imageDesc->format), GLTypes::Map(imageDesc->dataType), imageDesc->buffer, imageDesc->compressedSize
         );
     }
-    else if (IsCompressedFormat(desc.format))
-    {
-        /* Initialize compressed texture image with null pointer */
-        GLTexImage2DArray(
-            desc.format,
-            desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers,
-            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
-        );
-    }
     else
     {
-        /* Initialize texture image with default color */
-        auto image = GetDefaultTextureImageRGBAub(desc.texture2D.width * desc.texture2D.height * static_cast<int>(desc.texture2D.layers));
+        /* Allocate texture image without initial data (it is initialized after the texture has been built) */
         GLTexImage2DArray(
             desc.format,
             desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers,
-            GL_RGBA, GL_UNSIGNED_BYTE, image.data()
+            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
         );
     }
 }
@@ -523,23 +623,13 @@ void GLRenderSystem::BuildTextureCubeArray(const TextureDescriptor& desc, const
             GLTypes::Map(imageDesc->format), GLTypes::Map(imageDesc->dataType), imageDesc->buffer, imageDesc->compressedSize
         );
     }
-    else if (IsCompressedFormat(desc.format))
-    {
-        /* Initialize compressed texture image with null pointer */
-        GLTexImageCubeArray(
-            desc.format,
-            desc.textureCube.width, desc.textureCube.height, desc.textureCube.layers,
-            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
-        );
-    }
     else
     {
-        /* Initialize texture image cube-faces with default color */
-        auto image = GetDefaultTextureImageRGBAub(desc.textureCube.width * desc.textureCube.height * static_cast<int>(desc.textureCube.layers*6));
+        /* Allocate texture image without initial data (it is initialized after the texture has been built) */
         GLTexImageCubeArray(
             desc.format,
             desc.textureCube.width, desc.textureCube.height, desc.textureCube.layers,
-            GL_RGBA, GL_UNSIGNED_BYTE, image.data()
+            GL_RGBA, GL_UNSIGNED_BYTE, nullptr
         );
     }
 }
@@ -576,37 +666,61 @@ void GLRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor&
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
     GLStateManager::active->BindTexture(textureGL);
 
+    /* Decompress image data on the CPU if the texture emulates a compressed format */
+    ImageDescriptor decompressedImageDesc;
+    ByteBuffer      decompressedImage;
+
+    auto emulatedFormat = textureGL.GetEmulatedCompressedFormat();
+    if (emulatedFormat != TextureFormat::Unknown && IsCompressedFormat(imageDesc.format))
+    {
+        decompressedImage       = DecompressTextureImage(emulatedFormat, imageDesc, GetSubTextureImageExtent(texture.GetType(), subTextureDesc), 1, GetConfiguration().threadCount);
+        decompressedImageDesc   = ImageDescriptor(ImageFormat::RGBA, DataType::UInt8, decompressedImage.get());
+    }
+
+    const auto& srcImageDesc = (decompressedImage ? decompressedImageDesc : imageDesc);
+
+    /* Compressed image data must be written with the compressed format the texture has been allocated with */
+    GLenum internalFormat = 0;
+    if (IsCompressedFormat(srcImageDesc.format))
+        internalFormat = GetBoundTextureInternalFormat(texture.GetType());
+
+    SetupPixelStoreUnpack(&srcImageDesc);
+
     /* Write data into specific texture type */
     switch (texture.GetType())
     {
         case TextureType::Texture1D:
-            WriteTexture1D(subTextureDesc, imageDesc);
+            WriteTexture1D(subTextureDesc, srcImageDesc, internalFormat);
             break;
         case TextureType::Texture2D:
-            WriteTexture2D(subTextureDesc, imageDesc);
+            WriteTexture2D(subTextureDesc, srcImageDesc, internalFormat);
             break;
         case TextureType::Texture3D:
-            WriteTexture3D(subTextureDesc, imageDesc);
+            WriteTexture3D(subTextureDesc, srcImageDesc, internalFormat);
             break;
         case TextureType::TextureCube:
-            WriteTextureCube(subTextureDesc, imageDesc);
+            WriteTextureCube(subTextureDesc, srcImageDesc, internalFormat);
             break;
         case TextureType::Texture1DArray:
-            WriteTexture1DArray(subTextureDesc, imageDesc);
+            WriteTexture1DArray(subTextureDesc, srcImageDesc, internalFormat);
             break;
         case TextureType::Texture2DArray:
-            WriteTexture2DArray(subTextureDesc, imageDesc);
+            WriteTexture2DArray(subTextureDesc, srcImageDesc, internalFormat);
             break;
         case TextureType::TextureCubeArray:
-            WriteTextureCubeArray(subTextureDesc, imageDesc);
+            WriteTextureCubeArray(subTextureDesc, srcImageDesc, internalFormat);
             break;
         default:
             break;
     }
 }
 
+/*
+Compressed image data must be uploaded with the compressed internal format of the texture storage,
+since the generic compressed formats (e.g. GL_COMPRESSED_RGBA) are rejected by the "glCompressedTexSubImage..." functions.
+*/
 static void GLTexSubImage1DBase(
-    GLenum target, unsigned int mipLevel, unsigned int x, unsigned int width, const ImageDescriptor& imageDesc)
+    GLenum target, unsigned int mipLevel, unsigned int x, unsigned int width, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
     if (IsCompressedFormat(imageDesc.format))
     {
@@ -615,7 +729,7 @@ static void GLTexSubImage1DBase(
             static_cast<GLint>(mipLevel),
             static_cast<GLint>(x),
             static_cast<GLsizei>(width),
-            GLTypes::Map(imageDesc.format),
+            internalFormat,
             static_cast<GLsizei>(imageDesc.compressedSize),
             imageDesc.buffer
         );
@@ -636,7 +750,7 @@ static void GLTexSubImage1DBase(
 
 static void GLTexSubImage2DBase(
     GLenum target, unsigned int mipLevel, unsigned int x, unsigned int y,
-    unsigned int width, unsigned int height, const ImageDescriptor& imageDesc)
+    unsigned int width, unsigned int height, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
     if (IsCompressedFormat(imageDesc.format))
     {
@@ -647,7 +761,7 @@ static void GLTexSubImage2DBase(
             static_cast<GLint>(y),
             static_cast<GLsizei>(width),
             static_cast<GLsizei>(height),
-            GLTypes::Map(imageDesc.format),
+            internalFormat,
             static_cast<GLsizei>(imageDesc.compressedSize), imageDesc.buffer
         );
     }
@@ -669,7 +783,7 @@ static void GLTexSubImage2DBase(
 
 static void GLTexSubImage3DBase(
     GLenum target, unsigned int mipLevel, unsigned int x, unsigned int y, unsigned int z,
-    unsigned int width, unsigned int height, unsigned int depth, const ImageDescriptor& imageDesc)
+    unsigned int width, unsigned int height, unsigned int depth, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
     if (IsCompressedFormat(imageDesc.format))
     {
@@ -682,7 +796,7 @@ static void GLTexSubImage3DBase(
             static_cast<GLsizei>(width),
             static_cast<GLsizei>(height),
             static_cast<GLsizei>(depth),
-            GLTypes::Map(imageDesc.format),
+            internalFormat,
             static_cast<GLsizei>(imageDesc.compressedSize),
             imageDesc.buffer
         );
@@ -706,121 +820,341 @@ static void GLTexSubImage3DBase(
 }
 
 static void GLTexSubImage1D(
-    unsigned int mipLevel, unsigned int x, unsigned int width, const ImageDescriptor& imageDesc)
+    unsigned int mipLevel, unsigned int x, unsigned int width, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
-    GLTexSubImage1DBase(GL_TEXTURE_1D, mipLevel, x, width, imageDesc);
+    GLTexSubImage1DBase(GL_TEXTURE_1D, mipLevel, x, width, imageDesc, internalFormat);
 }
 
 static void GLTexSubImage2D(
     unsigned int mipLevel, unsigned int x, unsigned int y,
-    unsigned int width, unsigned int height, const ImageDescriptor& imageDesc)
+    unsigned int width, unsigned int height, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
-    GLTexSubImage2DBase(GL_TEXTURE_2D, mipLevel, x, y, width, height, imageDesc);
+    GLTexSubImage2DBase(GL_TEXTURE_2D, mipLevel, x, y, width, height, imageDesc, internalFormat);
 }
 
 static void GLTexSubImage3D(
     unsigned int mipLevel, unsigned int x, unsigned int y, unsigned int z,
-    unsigned int width, unsigned int height, unsigned int depth, const ImageDescriptor& imageDesc)
+    unsigned int width, unsigned int height, unsigned int depth, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
-    GLTexSubImage3DBase(GL_TEXTURE_3D, mipLevel, x, y, z, width, height, depth, imageDesc);
+    GLTexSubImage3DBase(GL_TEXTURE_3D, mipLevel, x, y, z, width, height, depth, imageDesc, internalFormat);
 }
 
 static void GLTexSubImageCube(
     unsigned int mipLevel, unsigned int x, unsigned int y,
-    unsigned int width, unsigned int height, AxisDirection cubeFace, const ImageDescriptor& imageDesc)
+    unsigned int width, unsigned int height, AxisDirection cubeFace, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
-    GLTexSubImage2DBase(GLTypes::Map(cubeFace), mipLevel, x, y, width, height, imageDesc);
+    GLTexSubImage2DBase(GLTypes::Map(cubeFace), mipLevel, x, y, width, height, imageDesc, internalFormat);
 }
 
 static void GLTexSubImage1DArray(
     unsigned int mipLevel, unsigned int x, unsigned int layerOffset,
-    unsigned int width, unsigned int layers, const ImageDescriptor& imageDesc)
+    unsigned int width, unsigned int layers, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
-    GLTexSubImage2DBase(GL_TEXTURE_1D_ARRAY, mipLevel, x, layerOffset, width, layers, imageDesc);
+    GLTexSubImage2DBase(GL_TEXTURE_1D_ARRAY, mipLevel, x, layerOffset, width, layers, imageDesc, internalFormat);
 }
 
 static void GLTexSubImage2DArray(
     int mipLevel, int x, int y, unsigned int layerOffset,
-    int width, int height, unsigned int layers, const ImageDescriptor& imageDesc)
+    int width, int height, unsigned int layers, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
-    GLTexSubImage3DBase(GL_TEXTURE_2D_ARRAY, mipLevel, x, y, layerOffset, width, height, layers, imageDesc);
+    GLTexSubImage3DBase(GL_TEXTURE_2D_ARRAY, mipLevel, x, y, layerOffset, width, height, layers, imageDesc, internalFormat);
 }
 
 static void GLTexSubImageCubeArray(
     unsigned int mipLevel, unsigned int x, unsigned int y, unsigned int layerOffset, AxisDirection cubeFaceOffset,
-    unsigned int width, unsigned int height, unsigned int cubeFaces, const ImageDescriptor& imageDesc)
+    unsigned int width, unsigned int height, unsigned int cubeFaces, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
     layerOffset = layerOffset * 6 + static_cast<unsigned int>(cubeFaceOffset);
-    GLTexSubImage3DBase(GL_TEXTURE_CUBE_MAP_ARRAY, mipLevel, x, y, layerOffset, width, height, cubeFaces, imageDesc);
+    GLTexSubImage3DBase(GL_TEXTURE_CUBE_MAP_ARRAY, mipLevel, x, y, layerOffset, width, height, cubeFaces, imageDesc, internalFormat);
 }
 
-void GLRenderSystem::WriteTexture1D(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc)
+void GLRenderSystem::WriteTexture1D(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
-    GLTexSubImage1D(desc.mipLevel, desc.texture1D.x, desc.texture1D.width, imageDesc);
+    GLTexSubImage1D(desc.mipLevel, desc.texture1D.x, desc.texture1D.width, imageDesc, internalFormat);
 }
 
-void GLRenderSystem::WriteTexture2D(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc)
+void GLRenderSystem::WriteTexture2D(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
     GLTexSubImage2D(
         desc.mipLevel, desc.texture2D.x, desc.texture2D.y,
-        desc.texture2D.width, desc.texture2D.height, imageDesc
+        desc.texture2D.width, desc.texture2D.height, imageDesc, internalFormat
     );
 }
 
-void GLRenderSystem::WriteTexture3D(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc)
+void GLRenderSystem::WriteTexture3D(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
     LLGL_ASSERT_CAP(has3DTextures);
     GLTexSubImage3D(
         desc.mipLevel, desc.texture3D.x, desc.texture3D.y, desc.texture3D.z,
-        desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth, imageDesc
+        desc.texture3D.width, desc.texture3D.height, desc.texture3D.depth, imageDesc, internalFormat
     );
 }
 
-void GLRenderSystem::WriteTextureCube(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc)
+void GLRenderSystem::WriteTextureCube(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
     LLGL_ASSERT_CAP(hasCubeTextures);
     GLTexSubImageCube(
         desc.mipLevel, desc.textureCube.x, desc.textureCube.y,
-        desc.textureCube.width, desc.textureCube.height, desc.textureCube.cubeFaceOffset, imageDesc
+        desc.textureCube.width, desc.textureCube.height, desc.textureCube.cubeFaceOffset, imageDesc, internalFormat
     );
 }
 
-void GLRenderSystem::WriteTexture1DArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc)
+void GLRenderSystem::WriteTexture1DArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
     LLGL_ASSERT_CAP(hasTextureArrays);
     GLTexSubImage1DArray(
         desc.mipLevel, desc.texture1D.x, desc.texture1D.layerOffset,
-        desc.texture1D.width, desc.texture1D.layers, imageDesc
+        desc.texture1D.width, desc.texture1D.layers, imageDesc, internalFormat
     );
 }
 
-void GLRenderSystem::WriteTexture2DArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc)
+void GLRenderSystem::WriteTexture2DArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
     LLGL_ASSERT_CAP(hasTextureArrays);
     GLTexSubImage2DArray(
         desc.mipLevel, desc.texture2D.x, desc.texture2D.y, desc.texture2D.layerOffset,
-        desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers, imageDesc
+        desc.texture2D.width, desc.texture2D.height, desc.texture2D.layers, imageDesc, internalFormat
     );
 }
 
-void GLRenderSystem::WriteTextureCubeArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc)
+void GLRenderSystem::WriteTextureCubeArray(const SubTextureDescriptor& desc, const ImageDescriptor& imageDesc, GLenum internalFormat)
 {
     LLGL_ASSERT_CAP(hasCubeTextureArrays);
     GLTexSubImageCubeArray(
         desc.mipLevel, desc.textureCube.x, desc.textureCube.y, desc.textureCube.layerOffset, desc.textureCube.cubeFaceOffset,
-        desc.textureCube.width, desc.textureCube.height, desc.textureCube.cubeFaces, imageDesc
+        desc.textureCube.width, desc.textureCube.height, desc.textureCube.cubeFaces, imageDesc, internalFormat
     );
 }
 
+void GLRenderSystem::BuildTextureStorage(const TextureDescriptor& desc, const ImageDescriptor* imageDesc)
+{
+    auto target         = GLTypes::Map(desc.type);
+    auto levels         = static_cast<GLsizei>(NumMipLevels(desc));
+    auto internalFormat = GetSizedInternalFormat(desc.format);
+
+    /* Allocate immutable texture storage */
+    switch (desc.type)
+    {
+        case TextureType::Texture1D:
+            glTexStorage1D(
+                target, levels, internalFormat,
+                static_cast<GLsizei>(desc.texture1D.width)
+            );
+            break;
+
+        case TextureType::Texture2D:
+            glTexStorage2D(
+                target, levels, internalFormat,
+                static_cast<GLsizei>(desc.texture2D.width),
+                static_cast<GLsizei>(desc.texture2D.height)
+            );
+            break;
+
+        case TextureType::Texture3D:
+            LLGL_ASSERT_CAP(has3DTextures);
+            glTexStorage3D(
+                target, levels, internalFormat,
+                static_cast<GLsizei>(desc.texture3D.width),
+                static_cast<GLsizei>(desc.texture3D.height),
+                static_cast<GLsizei>(desc.texture3D.depth)
+            );
+            break;
+
+        case TextureType::TextureCube:
+            LLGL_ASSERT_CAP(hasCubeTextures);
+            glTexStorage2D(
+                target, levels, internalFormat,
+                static_cast<GLsizei>(desc.textureCube.width),
+                static_cast<GLsizei>(desc.textureCube.height)
+            );
+            break;
+
+        case TextureType::Texture1DArray:
+            LLGL_ASSERT_CAP(hasTextureArrays);
+            glTexStorage2D(
+                target, levels, internalFormat,
+                static_cast<GLsizei>(desc.texture1D.width),
+                static_cast<GLsizei>(desc.texture1D.layers)
+            );
+            break;
+
+        case TextureType::Texture2DArray:
+            LLGL_ASSERT_CAP(hasTextureArrays);
+            glTexStorage3D(
+                target, levels, internalFormat,
+                static_cast<GLsizei>(desc.texture2D.width),
+                static_cast<GLsizei>(desc.texture2D.height),
+                static_cast<GLsizei>(desc.texture2D.layers)
+            );
+            break;
+
+        case TextureType::TextureCubeArray:
+            LLGL_ASSERT_CAP(hasCubeTextureArrays);
+            glTexStorage3D(
+                target, levels, internalFormat,
+                static_cast<GLsizei>(desc.textureCube.width),
+                static_cast<GLsizei>(desc.textureCube.height),
+                static_cast<GLsizei>(desc.textureCube.layers * 6)
+            );
+            break;
+
+        case TextureType::Texture2DMS:
+            LLGL_ASSERT_CAP(hasMultiSampleTextures);
+            glTexStorage2DMultisample(
+                target, static_cast<GLsizei>(desc.texture2DMS.samples), internalFormat,
+                static_cast<GLsizei>(desc.texture2DMS.width),
+                static_cast<GLsizei>(desc.texture2DMS.height),
+                (desc.texture2DMS.fixedSamples ? GL_TRUE : GL_FALSE)
+            );
+            break;
+
+        case TextureType::Texture2DMSArray:
+            LLGL_ASSERT_CAP(hasMultiSampleTextures);
+            glTexStorage3DMultisample(
+                target, static_cast<GLsizei>(desc.texture2DMS.samples), internalFormat,
+                static_cast<GLsizei>(desc.texture2DMS.width),
+                static_cast<GLsizei>(desc.texture2DMS.height),
+                static_cast<GLsizei>(desc.texture2DMS.layers),
+                (desc.texture2DMS.fixedSamples ? GL_TRUE : GL_FALSE)
+            );
+            break;
+
+        default:
+            throw std::invalid_argument("failed to create texture with invalid texture type");
+            break;
+    }
+
+    /* Upload initial image data into the first MIP-map level */
+    if (imageDesc && !IsMultiSampleTexture(desc.type))
+    {
+        auto extent = GetTextureImageExtent(desc);
+
+        switch (desc.type)
+        {
+            case TextureType::Texture1D:
+                GLTexSubImage1DBase(target, 0, 0, extent.x, *imageDesc, internalFormat);
+                break;
+
+            case TextureType::Texture2D:
+                GLTexSubImage2DBase(target, 0, 0, 0, extent.x, extent.y, *imageDesc, internalFormat);
+                break;
+
+            case TextureType::Texture1DArray:
+                GLTexSubImage2DBase(target, 0, 0, 0, extent.x, extent.z, *imageDesc, internalFormat);
+                break;
+
+            case TextureType::TextureCube:
+            {
+                /* Upload each cube face separately (compressed images specify the size of a single face) */
+                auto imageFace = *imageDesc;
+                auto imageFaceStride = (IsCompressedFormat(desc.format) ? imageDesc->compressedSize : imageDesc->GetImageStride(extent.x, extent.y));
+
+                for (GLenum face = 0; face < 6; ++face)
+                {
+                    GLTexSubImage2DBase(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, 0, 0, extent.x, extent.y, imageFace, internalFormat);
+                    imageFace.buffer = reinterpret_cast<const char*>(imageFace.buffer) + imageFaceStride;
+                }
+            }
+            break;
+
+            default:
+                GLTexSubImage3DBase(target, 0, 0, 0, 0, extent.x, extent.y, extent.z, *imageDesc, internalFormat);
+                break;
+        }
+    }
+}
+
+/* ----- Default texture initialization ----- */
+
+// Maximal number of pixels of the image tile which is used to initialize a texture without the "GL_ARB_clear_texture" extension.
+static const unsigned int maxDefaultImageTileSize = 16384;
+
+void GLRenderSystem::InitTextureWithDefaultColor(const GLTexture& textureGL, const TextureDescriptor& desc)
+{
+    /* Compressed and depth-stencil textures have no color to initialize, and multi-sampled textures can not be written */
+    if (IsCompressedFormat(desc.format) || desc.format == TextureFormat::DepthComponent || desc.format == TextureFormat::DepthStencil)
+        return;
+    if (desc.type == TextureType::Texture2DMS || desc.type == TextureType::Texture2DMSArray)
+        return;
+
+    const auto& defaultImageColor = GetConfiguration().defaultImageColor;
+    auto internalFormat = GetSizedInternalFormat(desc.format);
+
+    /* Initialize all MIP-map levels of immutable storage (mutable storage only allocates the first MIP-map level at this point) */
+    auto numMipLevels = (HasTextureStorageSupport(desc.type) ? NumMipLevels(desc) : 1u);
+
+    if (HasExtension(GLExt::ARB_clear_texture))
+    {
+        /* Clear each MIP-map level without any intermediate image buffer */
+        for (unsigned int mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+            glClearTexImage(textureGL.GetID(), static_cast<GLint>(mipLevel), GL_RGBA, GL_UNSIGNED_BYTE, &defaultImageColor);
+    }
+    else
+    {
+        /* Fill the texture with a small image tile of entire rows, which is reused for each MIP-map level, block of rows, array layer, and depth slice */
+        auto extent     = GetTextureImageExtent(desc);
+        auto tileRows   = std::max(1u, std::min(extent.y, maxDefaultImageTileSize / std::max(1u, extent.x)));
+        auto tileImage  = GetDefaultTextureImageRGBAub(static_cast<int>(extent.x * tileRows));
+
+        ImageDescriptor tileImageDesc(ImageFormat::RGBA, DataType::UInt8, tileImage.data());
+        SetupPixelStoreUnpack(&tileImageDesc);
+
+        for (unsigned int mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+        {
+            auto mipExtent = GetMipLevelImageExtent(desc.type, extent, mipLevel);
+
+            for (unsigned int z = 0; z < mipExtent.z; ++z)
+            {
+                for (unsigned int y = 0; y < mipExtent.y; y += tileRows)
+                {
+                    auto height = std::min(tileRows, mipExtent.y - y);
+                    switch (desc.type)
+                    {
+                        case TextureType::Texture1D:
+                            GLTexSubImage1DBase(GL_TEXTURE_1D, mipLevel, 0, mipExtent.x, tileImageDesc, internalFormat);
+                            break;
+                        case TextureType::Texture2D:
+                            GLTexSubImage2DBase(GL_TEXTURE_2D, mipLevel, 0, y, mipExtent.x, height, tileImageDesc, internalFormat);
+                            break;
+                        case TextureType::TextureCube:
+                            GLTexSubImage2DBase(GL_TEXTURE_CUBE_MAP_POSITIVE_X + z, mipLevel, 0, y, mipExtent.x, height, tileImageDesc, internalFormat);
+                            break;
+                        case TextureType::Texture1DArray:
+                            GLTexSubImage2DBase(GL_TEXTURE_1D_ARRAY, mipLevel, 0, z, mipExtent.x, 1, tileImageDesc, internalFormat);
+                            break;
+                        case TextureType::Texture3D:
+                            GLTexSubImage3DBase(GL_TEXTURE_3D, mipLevel, 0, y, z, mipExtent.x, height, 1, tileImageDesc, internalFormat);
+                            break;
+                        case TextureType::Texture2DArray:
+                            GLTexSubImage3DBase(GL_TEXTURE_2D_ARRAY, mipLevel, 0, y, z, mipExtent.x, height, 1, tileImageDesc, internalFormat);
+                            break;
+                        case TextureType::TextureCubeArray:
+                            GLTexSubImage3DBase(GL_TEXTURE_CUBE_MAP_ARRAY, mipLevel, 0, y, z, mipExtent.x, height, 1, tileImageDesc, internalFormat);
+                            break;
+                        default:
+                            break;
+                    }
+                }
+            }
+        }
+    }
+}
+
 void GLRenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType, void* buffer)
 {
     LLGL_ASSERT_PTR(buffer);
 
+    if (IsCompressedFormat(imageFormat))
+        throw std::invalid_argument("can not read texture into compressed image format");
+
     /* Bind texture */
     auto& textureGL = LLGL_CAST(const GLTexture&, texture);
     GLStateManager::active->BindTexture(textureGL);
 
-    /* Read image data from texture */
+    /* Read image data with tightly packed rows */
+    GLStateManager::active->SetPixelStorePack(0, 0, 1);
+
+    /* Read image data from texture (compressed textures are decompressed by the driver) */
     glGetTexImage(
         GLTypes::Map(textureGL.GetType()),
         mipLevel,
@@ -830,6 +1164,52 @@ void GLRenderSystem::ReadTexture(const Texture& texture, int mipLevel, ImageForm
     );
 }
 
+Readback* GLRenderSystem::ReadTextureAsync(const Texture& texture, int mipLevel, ImageFormat imageFormat, DataType dataType)
+{
+    if (IsCompressedFormat(imageFormat))
+        throw std::invalid_argument("can not read texture into compressed image format");
+
+    /* Bind texture */
+    auto& textureGL = LLGL_CAST(const GLTexture&, texture);
+    GLStateManager::active->BindTexture(textureGL);
+
+    /* Query MIP-map level size (cube faces must be queried and read separately) */
+    auto isCubeMap  = (texture.GetType() == TextureType::TextureCube);
+    auto target     = (isCubeMap ? GL_TEXTURE_CUBE_MAP_POSITIVE_X : GLTypes::Map(texture.GetType()));
+
+    GLint texSize[3] = { 0 };
+    glGetTexLevelParameteriv(target, mipLevel, GL_TEXTURE_WIDTH,  &texSize[0]);
+    glGetTexLevelParameteriv(target, mipLevel, GL_TEXTURE_HEIGHT, &texSize[1]);
+    glGetTexLevelParameteriv(target, mipLevel, GL_TEXTURE_DEPTH,  &texSize[2]);
+
+    auto imageSize  = static_cast<std::size_t>(texSize[0]) * texSize[1] * texSize[2] * ImageFormatSize(imageFormat) * DataTypeSize(dataType);
+    auto numImages  = (isCubeMap ? 6u : 1u);
+
+    /* Copy image data from texture into the pixel pack buffer of the readback (the buffer offset is passed as pointer) */
+    auto readback = MakeUnique<GLReadback>(imageSize * numImages);
+
+    GLStateManager::active->SetPixelStorePack(0, 0, 1);
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, readback->GetID());
+
+    for (unsigned int i = 0; i < numImages; ++i)
+    {
+        glGetTexImage(
+            target + i,
+            mipLevel,
+            GLTypes::Map(imageFormat),
+            GLTypes::Map(dataType),
+            reinterpret_cast<void*>(imageSize * i)
+        );
+    }
+
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+
+    /* Signal the readback once the GPU has finished the copy */
+    readback->InsertFence();
+
+    return TakeOwnership(readbacks_, std::move(readback));
+}
+
 void GLRenderSystem::GenerateMips(Texture& texture)
 {
     /* Bind texture to active layer */
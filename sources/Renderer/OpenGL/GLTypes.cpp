@@ -55,6 +55,7 @@ GLenum Map(const DataType dataType)
         case DataType::UInt16:  return GL_UNSIGNED_SHORT;
         case DataType::Int32:   return GL_INT;
         case DataType::UInt32:  return GL_UNSIGNED_INT;
+        case DataType::Float16: return GL_HALF_FLOAT;
         case DataType::Float:   return GL_FLOAT;
         case DataType::Double:  return GL_DOUBLE;
     }
@@ -410,6 +411,7 @@ GLenum Map(const BufferType bufferType)
         case BufferType::Constant:      return GL_UNIFORM_BUFFER;
         case BufferType::Storage:       return GL_SHADER_STORAGE_BUFFER;
         case BufferType::StreamOutput:  return GL_TRANSFORM_FEEDBACK_BUFFER;
+        case BufferType::Indirect:      return GL_DRAW_INDIRECT_BUFFER;
     }
     MapFailed("BufferType");
 }
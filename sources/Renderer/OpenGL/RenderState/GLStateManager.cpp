@@ -595,6 +595,54 @@ void GLStateManager::SetLogicOp(GLenum opcode)
     }
 }
 
+/* ----- Pixel store ----- */
+
+void GLStateManager::SetPixelStoreUnpack(GLint rowLength, GLint imageHeight, GLint alignment)
+{
+    auto& state = commonState_.pixelStoreUnpack;
+
+    if (state.rowLength != rowLength)
+    {
+        state.rowLength = rowLength;
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, rowLength);
+    }
+
+    if (state.imageHeight != imageHeight)
+    {
+        state.imageHeight = imageHeight;
+        glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, imageHeight);
+    }
+
+    if (state.alignment != alignment)
+    {
+        state.alignment = alignment;
+        glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+    }
+}
+
+void GLStateManager::SetPixelStorePack(GLint rowLength, GLint imageHeight, GLint alignment)
+{
+    auto& state = commonState_.pixelStorePack;
+
+    if (state.rowLength != rowLength)
+    {
+        state.rowLength = rowLength;
+        glPixelStorei(GL_PACK_ROW_LENGTH, rowLength);
+    }
+
+    if (state.imageHeight != imageHeight)
+    {
+        state.imageHeight = imageHeight;
+        glPixelStorei(GL_PACK_IMAGE_HEIGHT, imageHeight);
+    }
+
+    if (state.alignment != alignment)
+    {
+        state.alignment = alignment;
+        glPixelStorei(GL_PACK_ALIGNMENT, alignment);
+    }
+}
+
 /* ----- Buffer binding ----- */
 
 void GLStateManager::BindBuffer(GLBufferTarget target, GLuint buffer)
@@ -616,6 +664,14 @@ void GLStateManager::BindBufferBase(GLBufferTarget target, GLuint index, GLuint
     bufferState_.boundBuffers[targetIdx] = buffer;
 }
 
+void GLStateManager::BindBufferRange(GLBufferTarget target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    /* Always bind buffer with an index and range */
+    auto targetIdx = static_cast<std::size_t>(target);
+    glBindBufferRange(bufferTargetsMap[targetIdx], index, buffer, offset, size);
+    bufferState_.boundBuffers[targetIdx] = buffer;
+}
+
 void GLStateManager::BindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers)
 {
     /* Always bind buffers with a base index */
@@ -683,6 +739,30 @@ void GLStateManager::DeferredBindIndexBuffer(GLuint buffer)
         BindBuffer(GLBufferTarget::ELEMENT_ARRAY_BUFFER, buffer);
 }
 
+void GLStateManager::BindVertexBuffer(GLuint bindingIndex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+    #ifndef __APPLE__
+    glBindVertexBuffer(bindingIndex, buffer, offset, stride);
+    #endif
+}
+
+void GLStateManager::BindVertexBuffers(GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides)
+{
+    #ifndef __APPLE__
+    if (HasExtension(GLExt::ARB_multi_bind))
+    {
+        /* Bind all vertex buffers at once */
+        glBindVertexBuffers(first, count, buffers, offsets, strides);
+    }
+    else
+    {
+        /* Bind each individual vertex buffer */
+        for (GLsizei i = 0; i < count; ++i)
+            glBindVertexBuffer(first + static_cast<GLuint>(i), buffers[i], offsets[i], strides[i]);
+    }
+    #endif
+}
+
 void GLStateManager::PushBoundBuffer(GLBufferTarget target)
 {
     bufferState_.boundBufferStack.push(
@@ -711,6 +791,7 @@ static GLBufferTarget GetGLBufferTarget(const BufferType type)
         case BufferType::Constant:      return GLBufferTarget::UNIFORM_BUFFER;
         case BufferType::Storage:       return GLBufferTarget::SHADER_STORAGE_BUFFER;
         case BufferType::StreamOutput:  return GLBufferTarget::TRANSFORM_FEEDBACK_BUFFER;
+        case BufferType::Indirect:      return GLBufferTarget::DRAW_INDIRECT_BUFFER;
     }
     throw std::invalid_argument("failed to map 'BufferType' to internal type 'GLBufferTarget'");
 }
@@ -91,10 +91,19 @@ class GLStateManager
         void SetBlendColor(const ColorRGBAf& color);
         void SetLogicOp(GLenum opcode);
 
+        /* ----- Pixel store ----- */
+
+        //! Sets the GL_UNPACK_ROW_LENGTH, GL_UNPACK_IMAGE_HEIGHT, and GL_UNPACK_ALIGNMENT states for image uploads.
+        void SetPixelStoreUnpack(GLint rowLength, GLint imageHeight, GLint alignment);
+
+        //! Sets the GL_PACK_ROW_LENGTH, GL_PACK_IMAGE_HEIGHT, and GL_PACK_ALIGNMENT states for image readbacks.
+        void SetPixelStorePack(GLint rowLength, GLint imageHeight, GLint alignment);
+
         /* ----- Buffer binding ----- */
 
         void BindBuffer(GLBufferTarget target, GLuint buffer);
         void BindBufferBase(GLBufferTarget target, GLuint index, GLuint buffer);
+        void BindBufferRange(GLBufferTarget target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
         void BindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers);
 
         void BindVertexArray(GLuint vertexArray);
@@ -105,6 +114,15 @@ class GLStateManager
         */
         void DeferredBindIndexBuffer(GLuint buffer);
 
+        /**
+        \brief Binds the specified vertex buffer to the binding point of the currently bound VAO (requires "GL_ARB_vertex_attrib_binding").
+        \remarks The vertex buffer binding points are part of the VAO state, so they are not cached.
+        */
+        void BindVertexBuffer(GLuint bindingIndex, GLuint buffer, GLintptr offset, GLsizei stride);
+
+        //! Binds the specified vertex buffers to consecutive binding points of the currently bound VAO (requires "GL_ARB_vertex_attrib_binding").
+        void BindVertexBuffers(GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides);
+
         void PushBoundBuffer(GLBufferTarget target);
         void PopBoundBuffer();
 
@@ -178,6 +196,13 @@ class GLStateManager
 
         /* ----- Structure ----- */
 
+        struct GLPixelStore
+        {
+            GLint rowLength     = 0;
+            GLint imageHeight   = 0;
+            GLint alignment     = 4;
+        };
+
         struct GLCommonState
         {
             GLenum      depthFunc       = GL_LESS;
@@ -190,6 +215,8 @@ class GLStateManager
             GLint       patchVertices_  = 0;
             ColorRGBAf  blendColor      = { 0.0f, 0.0f, 0.0f, 0.0f };
             GLenum      logicOpCode     = GL_COPY;
+            GLPixelStore pixelStoreUnpack;
+            GLPixelStore pixelStorePack;
         };
 
         struct GLRenderState
@@ -36,9 +36,25 @@ class GLTexture : public Texture
             return id_;
         }
 
+        /**
+        \brief Sets the compressed format which is emulated by this texture with the uncompressed format TextureFormat::RGBA8.
+        \remarks This is used when the driver does not support the compressed format. Compressed image data is then decompressed on the CPU.
+        */
+        inline void SetEmulatedCompressedFormat(const TextureFormat format)
+        {
+            emulatedCompressedFormat_ = format;
+        }
+
+        //! Returns the emulated compressed format, or TextureFormat::Unknown if this texture does not emulate a compressed format.
+        inline TextureFormat GetEmulatedCompressedFormat() const
+        {
+            return emulatedCompressedFormat_;
+        }
+
     private:
 
-        GLuint id_ = 0;
+        GLuint          id_                         = 0;
+        TextureFormat   emulatedCompressedFormat_   = TextureFormat::Unknown;
 
 };
 
@@ -115,6 +115,9 @@ std::shared_ptr<RenderSystem> RenderSystem::Load(
     /* Allocate render system */
     auto renderSystem   = std::shared_ptr<RenderSystem>(LoadRenderSystem(*module, moduleFilename));
 
+    /* Pass profiler to the render system for backend specific counters */
+    renderSystem->profiler_ = profiler;
+
     if (profiler != nullptr || debugger != nullptr)
     {
         #ifdef LLGL_ENABLE_DEBUG_LAYER
@@ -166,10 +169,18 @@ std::vector<ColorRGBAub> RenderSystem::GetDefaultTextureImageRGBAub(int numPixel
 
 void RenderSystem::AssertCreateBuffer(const BufferDescriptor& desc)
 {
-    if (desc.type < BufferType::Vertex || desc.type > BufferType::StreamOutput)
+    if (desc.type < BufferType::Vertex || desc.type > BufferType::Indirect)
         throw std::invalid_argument("can not create buffer of unknown type (0x" + ToHex(static_cast<unsigned char>(desc.type)) + ")");
 }
 
+void RenderSystem::AssertCreateStreamingBuffer(const StreamingBufferDescriptor& desc)
+{
+    if (desc.size == 0)
+        throw std::invalid_argument("can not create streaming buffer with zero size");
+    if (desc.numFrames == 0)
+        throw std::invalid_argument("can not create streaming buffer with zero frames");
+}
+
 static void AssertCreateResourceArrayCommon(unsigned int numResources, void* const * resourceArray, const std::string& resourceName)
 {
     /* Validate number of buffers */
@@ -16,6 +16,12 @@ void RenderingProfiler::ResetCounters()
 {
     writeBuffer.Reset();
     mapBuffer.Reset();
+    writeStreamingBuffer.Reset();
+    copyBuffer.Reset();
+    copyTexture.Reset();
+
+    vertexArrayCacheHits.Reset();
+    vertexArrayCacheMisses.Reset();
 
     setVertexBuffer.Reset();
     setIndexBuffer.Reset();
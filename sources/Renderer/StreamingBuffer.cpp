@@ -0,0 +1,24 @@
+/*
+ * StreamingBuffer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/StreamingBuffer.h>
+
+
+namespace LLGL
+{
+
+
+StreamingBuffer::~StreamingBuffer()
+{
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -6,6 +6,7 @@
  */
 
 #include <LLGL/TextureFlags.h>
+#include <algorithm>
 #include <cmath>
 
 
@@ -20,6 +21,38 @@ LLGL_EXPORT unsigned int NumMipLevels(unsigned int width, unsigned int height, u
     return (1 + log2Size);
 }
 
+LLGL_EXPORT unsigned int NumMipLevels(const TextureDescriptor& textureDesc)
+{
+    unsigned int numMipLevels = 1;
+
+    switch (textureDesc.type)
+    {
+        case TextureType::Texture1D:
+        case TextureType::Texture1DArray:
+            numMipLevels = NumMipLevels(textureDesc.texture1D.width);
+            break;
+        case TextureType::Texture2D:
+        case TextureType::Texture2DArray:
+            numMipLevels = NumMipLevels(textureDesc.texture2D.width, textureDesc.texture2D.height);
+            break;
+        case TextureType::Texture3D:
+            numMipLevels = NumMipLevels(textureDesc.texture3D.width, textureDesc.texture3D.height, textureDesc.texture3D.depth);
+            break;
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            numMipLevels = NumMipLevels(textureDesc.textureCube.width, textureDesc.textureCube.height);
+            break;
+        case TextureType::Texture2DMS:
+        case TextureType::Texture2DMSArray:
+            return 1;
+    }
+
+    if (textureDesc.mipLevels > 0)
+        return std::min(textureDesc.mipLevels, numMipLevels);
+    else
+        return numMipLevels;
+}
+
 LLGL_EXPORT bool IsCompressedFormat(const TextureFormat format)
 {
     return (format >= TextureFormat::RGB_DXT1);
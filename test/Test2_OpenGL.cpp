@@ -268,6 +268,7 @@ int main()
             textureDesc.format              = LLGL::TextureFormat::RGBA;
             textureDesc.texture2D.width     = 2;
             textureDesc.texture2D.height    = 2;
+            textureDesc.mipLevels           = 0;
         }
         auto& texture = *renderer->CreateTexture(textureDesc, &imageDesc);
 
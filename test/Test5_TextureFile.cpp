@@ -0,0 +1,166 @@
+/*
+ * Test5_TextureFile.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Helper.h"
+#include <LLGL/TextureFile.h>
+#include <LLGL/ImageCompression.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+
+static const char*          testFilename    = "Test5_TextureFile.dds";
+static const unsigned int   testWidth       = 128;
+static const unsigned int   testHeight      = 64;
+
+// Returns a color gradient image with RGBA 8-bit components, which differs for each MIP-map level
+static std::vector<std::uint8_t> GetTestImage(unsigned int width, unsigned int height, unsigned int mipLevel)
+{
+    std::vector<std::uint8_t> image(width * height * 4);
+
+    for (unsigned int y = 0, i = 0; y < height; ++y)
+    {
+        for (unsigned int x = 0; x < width; ++x, i += 4)
+        {
+            image[i    ] = static_cast<std::uint8_t>(x * 255 / width);
+            image[i + 1] = static_cast<std::uint8_t>(y * 255 / height);
+            image[i + 2] = static_cast<std::uint8_t>(mipLevel * 32);
+            image[i + 3] = 255;
+        }
+    }
+
+    return image;
+}
+
+// Writes a DXT1 compressed DDS file with an entire MIP-map chain
+static void WriteTestDDSFile(const std::string& filename, unsigned int width, unsigned int height)
+{
+    auto numMipLevels = LLGL::NumMipLevels(width, height);
+
+    std::uint32_t header[32] = { 0 };
+    {
+        header[ 0] = 0x20534444;                        // Magic number "DDS "
+        header[ 1] = 124;                               // Header size
+        header[ 2] = 0x00001007 | 0x00020000;           // DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT
+        header[ 3] = height;
+        header[ 4] = width;
+        header[ 7] = numMipLevels;
+        header[19] = 32;                                // Pixel format size
+        header[20] = 0x00000004;                        // DDPF_FOURCC
+        header[21] = 0x31545844;                        // FourCC "DXT1"
+        header[27] = 0x00401008;                        // DDSCAPS_COMPLEX | DDSCAPS_TEXTURE | DDSCAPS_MIPMAP
+    }
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.good())
+        throw std::runtime_error("failed to write file: \"" + filename + "\"");
+
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    LLGL::ImageCompressionDescriptor compressionDesc;
+    compressionDesc.format = LLGL::TextureFormat::RGBA_DXT1;
+
+    for (unsigned int mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+    {
+        auto mipWidth       = std::max(1u, width >> mipLevel);
+        auto mipHeight      = std::max(1u, height >> mipLevel);
+        auto image          = GetTestImage(mipWidth, mipHeight, mipLevel);
+        auto compressedSize = LLGL::CompressedImageSize(compressionDesc.format, mipWidth, mipHeight);
+        auto compressedData = LLGL::CompressImageBuffer(LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, image.data(), mipWidth, mipHeight, compressionDesc);
+
+        file.write(compressedData.get(), static_cast<std::streamsize>(compressedSize));
+    }
+}
+
+int main()
+{
+    int result = EXIT_SUCCESS;
+
+    try
+    {
+        // Setup profiler and debugger
+        auto profiler = std::make_shared<LLGL::RenderingProfiler>();
+        auto debugger = std::make_shared<TestDebugger>();
+
+        // Load render system module
+        auto renderer = LLGL::RenderSystem::Load("OpenGL", profiler.get(), debugger.get());
+
+        // Create render context
+        LLGL::RenderContextDescriptor contextDesc;
+        contextDesc.videoMode.resolution = { 800, 600 };
+
+        auto context = renderer->CreateRenderContext(contextDesc);
+
+        // Change window title
+        auto title = "LLGL Test 5: TextureFile ( " + renderer->GetName() + " )";
+        context->GetWindow().SetTitle(std::wstring(title.begin(), title.end()));
+
+        // Write DDS file and map it into memory
+        WriteTestDDSFile(testFilename, testWidth, testHeight);
+
+        LLGL::TextureFile textureFile(testFilename);
+
+        // Create texture and write every MIP-map level of the texture file
+        auto texture = renderer->CreateTexture(textureFile.GetTextureDescriptor());
+
+        for (unsigned int mipLevel = 0; mipLevel < textureFile.GetNumMipLevels(); ++mipLevel)
+        {
+            for (unsigned int layer = 0; layer < textureFile.GetNumLayers(); ++layer)
+            {
+                renderer->WriteTexture(
+                    *texture,
+                    textureFile.GetSubTextureDescriptor(mipLevel, layer),
+                    textureFile.GetImageDescriptor(mipLevel, layer)
+                );
+            }
+        }
+
+        // Read back every MIP-map level and compare it with the image which is decompressed on the CPU
+        const auto& textureDesc = textureFile.GetTextureDescriptor();
+
+        for (unsigned int mipLevel = 0; mipLevel < textureFile.GetNumMipLevels(); ++mipLevel)
+        {
+            auto mipWidth   = std::max(1u, testWidth >> mipLevel);
+            auto mipHeight  = std::max(1u, testHeight >> mipLevel);
+            auto imageDesc  = textureFile.GetImageDescriptor(mipLevel);
+
+            auto expectedImage = LLGL::DecompressImageBuffer(
+                textureDesc.format, imageDesc.buffer, imageDesc.compressedSize,
+                LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, mipWidth, mipHeight
+            );
+
+            std::vector<std::uint8_t> image(mipWidth * mipHeight * 4);
+            renderer->ReadTexture(*texture, static_cast<int>(mipLevel), LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, image.data());
+
+            // Allow small differences, since drivers may interpolate the DXT colors with a different rounding
+            int maxDiff = 0;
+            for (std::size_t i = 0; i < image.size(); ++i)
+                maxDiff = std::max(maxDiff, std::abs(static_cast<int>(image[i]) - static_cast<int>(static_cast<std::uint8_t>(expectedImage[i]))));
+
+            std::cout << "MIP-map level " << mipLevel << " (" << mipWidth << 'x' << mipHeight << "): ";
+            if (maxDiff <= 8)
+                std::cout << "ok" << std::endl;
+            else
+            {
+                std::cout << "FAILED (max. difference = " << maxDiff << ")" << std::endl;
+                result = EXIT_FAILURE;
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        result = EXIT_FAILURE;
+    }
+
+    #ifdef _WIN32
+    system("pause");
+    #endif
+
+    return result;
+}
@@ -117,6 +117,9 @@ public:
                 // Texture size
                 texDesc.texture2D.width     = texWidth;
                 texDesc.texture2D.height    = texHeight;
+
+                // Allocate the entire MIP-map chain
+                texDesc.mipLevels           = 0;
             }
             colorMap = renderer->CreateTexture(texDesc, &imageDesc);
         }
@@ -181,9 +181,10 @@ public:
         
         #else
         
-        renderTargetTex = renderer->CreateTexture(
-            LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA, renderTargetSize.x, renderTargetSize.y)
-        );
+        auto renderTargetTexDesc = LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA, renderTargetSize.x, renderTargetSize.y);
+        renderTargetTexDesc.mipLevels = 0;
+
+        renderTargetTex = renderer->CreateTexture(renderTargetTexDesc);
 
         #endif
 
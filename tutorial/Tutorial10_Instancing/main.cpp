@@ -230,10 +230,10 @@ private:
             arrayImageBuffer.data()
         );
 
-        arrayTexture = renderer->CreateTexture(
-            LLGL::Texture2DArrayDesc(LLGL::TextureFormat::RGBA, width, height, numImages),
-            &imageDesc
-        );
+        auto arrayTextureDesc = LLGL::Texture2DArrayDesc(LLGL::TextureFormat::RGBA, width, height, numImages);
+        arrayTextureDesc.mipLevels = 0;
+
+        arrayTexture = renderer->CreateTexture(arrayTextureDesc, &imageDesc);
 
         // Generate MIP-maps
         renderer->GenerateMips(*arrayTexture);
@@ -505,10 +505,11 @@ protected:
             imageDesc.buffer    = imageBuffer;
         }
 
-        // Create texture and upload image data onto hardware texture
-        auto tex = renderer->CreateTexture(
-            LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA, width, height), &imageDesc
-        );
+        // Create texture with the entire MIP-map chain and upload image data onto hardware texture
+        auto texDesc = LLGL::Texture2DDesc(LLGL::TextureFormat::RGBA, width, height);
+        texDesc.mipLevels = 0;
+
+        auto tex = renderer->CreateTexture(texDesc, &imageDesc);
 
         // Generate all MIP-maps (MIP = "Multum in Parvo", or "a multitude in a small space")
         // see https://developer.valvesoftware.com/wiki/MIP_Mapping